@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include <fastdds/dds/core/LoanableTypedCollection.hpp>
@@ -56,6 +57,11 @@ namespace dds {
  *     @li If has_ownership == false, the sequence does not have ownership on the buffer. This implies that
  *         the sequence is loaning the buffer. The sequence should not be destroyed until the loan is returned.
  *     @li A sequence with a zero maximum always has has_ownership == true
+ *
+ * The elements owned by the sequence are allocated in contiguous blocks, one for each time the sequence grows, and
+ * keep their address until the sequence is destroyed. A sequence pre-allocated with the maximum number of samples
+ * to be read or taken thus holds them (and their SampleInfo, when used as a SampleInfoSeq) contiguously, and can be
+ * reused across calls without further allocations.
  */
 template<typename T>
 class LoanableSequence : public LoanableTypedCollection<T>
@@ -80,7 +86,7 @@ public:
     /**
      * Pre-allocation constructor.
      *
-     * Creates the sequence with an initial number of allocated elements.
+     * Creates the sequence with an initial number of allocated elements, all of them on a single contiguous block.
      * When the input parameter is less than or equal to 0, the behavior is equivalent to the default constructor.
      * Otherwise, the post-conditions below will apply.
      *
@@ -192,10 +198,12 @@ private:
         data_.resize(maximum);
         elements_ = reinterpret_cast<element_type*>(data_.data());
 
-        // Allocate individual elements
+        // Allocate the new elements on a single block
+        blocks_.emplace_back(new T[maximum - maximum_]());
+        T* block = blocks_.back().get();
         while (maximum_ < maximum)
         {
-            data_[maximum_++] = new T();
+            data_[maximum_++] = block++;
         }
     }
 
@@ -203,11 +211,7 @@ private:
     {
         if (has_ownership_ && elements_)
         {
-            for (size_type n = 0; n < maximum_; ++n)
-            {
-                T* elem = data_[n];
-                delete elem;
-            }
+            std::vector<std::unique_ptr<T[]>>().swap(blocks_);
             std::vector<T*>().swap(data_);
         }
 
@@ -218,6 +222,7 @@ private:
     }
 
     std::vector<T*> data_;
+    std::vector<std::unique_ptr<T[]>> blocks_;
 };
 
 } // namespace dds
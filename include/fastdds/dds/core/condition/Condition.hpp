@@ -21,6 +21,7 @@
 #define _FASTDDS_CONDITION_HPP_
 
 #include <fastrtps/fastrtps_dll.h>
+#include <memory>
 #include <vector>
 #include <fastdds/dds/log/Log.hpp>
 
@@ -28,6 +29,12 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+namespace detail {
+
+struct ConditionNotifier;
+
+} // namespace detail
+
 /**
  * @brief The Condition class is the root base class for all the conditions that may be attached to a WaitSet.
  */
@@ -35,21 +42,49 @@ class Condition
 {
 public:
 
-    // Condition class not implemented.
-
     /**
      * @brief Retrieves the trigger_value of the Condition
      * @return true if trigger_value is set to 'true', 'false' otherwise
      */
-    RTPS_DllAPI bool get_trigger_value() const
+    RTPS_DllAPI virtual bool get_trigger_value() const
     {
         logWarning(CONDITION, "get_trigger_value public member function not implemented");
         return false; // TODO return trigger value
     }
 
+    /**
+     * @brief Retrieves the object used to wake up the WaitSets this Condition is attached to.
+     * @return Reference to the notifier of the Condition, which a WaitSet may keep after the Condition is deleted
+     */
+    const std::shared_ptr<detail::ConditionNotifier>& get_notifier() const
+    {
+        return notifier_;
+    }
+
+protected:
+
+    RTPS_DllAPI Condition();
+
+    /**
+     * Detaches the Condition from its WaitSets if a derived destructor has not done it yet.
+     * Derived classes should call notifier_->will_be_deleted(*this) first thing in their destructors, so no WaitSet
+     * evaluates get_trigger_value() on a partially destroyed object.
+     */
+    RTPS_DllAPI virtual ~Condition();
+
+    //! Keeps track of the WaitSets this Condition is attached to
+    std::shared_ptr<detail::ConditionNotifier> notifier_;
+
+private:
+
+    Condition(
+            const Condition&) = delete;
+
+    Condition& operator =(
+            const Condition&) = delete;
 };
 
-typedef std::vector<Condition> ConditionSeq;
+typedef std::vector<Condition*> ConditionSeq;
 
 } // namespace dds
 } // namespace fastdds
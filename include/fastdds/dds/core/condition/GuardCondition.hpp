@@ -20,6 +20,8 @@
 #ifndef _FASTDDS_GUARD_CONDITION_HPP_
 #define _FASTDDS_GUARD_CONDITION_HPP_
 
+#include <atomic>
+
 #include <fastdds/dds/core/condition/Condition.hpp>
 #include <fastrtps/fastrtps_dll.h>
 #include <fastrtps/types/TypesBase.h>
@@ -43,7 +45,15 @@ class GuardCondition : public Condition
 {
 public:
 
-    // GuardCondition not implemented.
+    RTPS_DllAPI GuardCondition();
+
+    RTPS_DllAPI ~GuardCondition();
+
+    /**
+     * @brief Retrieves the trigger_value of the Condition
+     * @return true if trigger_value is set to 'true', 'false' otherwise
+     */
+    RTPS_DllAPI bool get_trigger_value() const override;
 
     /**
      * @brief Set the trigger_value
@@ -51,15 +61,12 @@ public:
      * @return RETURN_OK
      */
     RTPS_DllAPI ReturnCode_t set_trigger_value(
-            bool value)
-    {
-        static_cast<void>(value);
-        return ReturnCode_t::RETCODE_UNSUPPORTED;
-    }
+            bool value);
 
-};
+private:
 
-typedef std::vector<Condition> ConditionSeq;
+    std::atomic<bool> trigger_value_;
+};
 
 } // namespace dds
 } // namespace fastdds
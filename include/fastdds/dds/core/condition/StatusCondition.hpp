@@ -20,6 +20,8 @@
 #ifndef _FASTDDS_STATUS_CONDITION_HPP_
 #define _FASTDDS_STATUS_CONDITION_HPP_
 
+#include <memory>
+
 #include <fastdds/dds/core/condition/Condition.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastrtps/fastrtps_dll.h>
@@ -31,17 +33,38 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+namespace detail {
+
+struct StatusConditionImpl;
+
+} // namespace detail
+
 class Entity;
 
 /**
  * @brief The StatusCondition class is a specific Condition that is associated with each Entity.
  *
+ * Its trigger_value is true whenever any of the enabled statuses of the Entity has changed since the last time the
+ * application read it.
  */
-class StatusCondition : public Condition
+class StatusCondition final : public Condition
 {
 public:
 
-    // StatusCondition not implemented.
+    /**
+     * @brief Constructor
+     * @param parent Entity this StatusCondition is associated to
+     */
+    RTPS_DllAPI StatusCondition(
+            Entity* parent);
+
+    RTPS_DllAPI ~StatusCondition() final;
+
+    /**
+     * @brief Retrieves the trigger_value of the Condition
+     * @return true if trigger_value is set to 'true', 'false' otherwise
+     */
+    RTPS_DllAPI bool get_trigger_value() const override;
 
     /**
      * @brief Defines the list of communication statuses that are taken into account to determine the trigger_value
@@ -55,7 +78,7 @@ public:
      * @brief Retrieves the list of communication statuses that are taken into account to determine the trigger_value
      * @return Status set or default status if it has not been set
      */
-    RTPS_DllAPI const StatusMask& get_enabled_statuses() const;
+    RTPS_DllAPI StatusMask get_enabled_statuses() const;
 
     /**
      * @brief Returns the Entity associated
@@ -63,10 +86,22 @@ public:
      */
     RTPS_DllAPI Entity* get_entity() const;
 
+    /**
+     * @brief Retrieves the object used to keep the state of the statuses of the associated Entity
+     * @return Pointer to the implementation object
+     */
+    detail::StatusConditionImpl* get_impl() const
+    {
+        return impl_.get();
+    }
+
 protected:
 
-    //! StatusMask with relevant statuses set to 1
-    StatusMask status_mask;
+    //! Class implementation
+    std::unique_ptr<detail::StatusConditionImpl> impl_;
+
+    //! Entity associated with this condition
+    Entity* entity_ = nullptr;
 
 };
 
@@ -20,6 +20,8 @@
 #ifndef _FASTDDS_WAIT_SET_HPP_
 #define _FASTDDS_WAIT_SET_HPP_
 
+#include <memory>
+
 #include <fastdds/dds/core/condition/Condition.hpp>
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastrtps/fastrtps_dll.h>
@@ -31,6 +33,12 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+namespace detail {
+
+struct WaitSetImpl;
+
+} // namespace detail
+
 /**
  * @brief The WaitSet class allows an application to wait until one or more of the attached Condition objects
  * has a trigger_value of TRUE or until timeout expires.
@@ -40,7 +48,9 @@ class WaitSet
 {
 public:
 
-    // WaitSet class not implemented.
+    RTPS_DllAPI WaitSet();
+
+    RTPS_DllAPI ~WaitSet();
 
     /**
      * @brief Attaches a Condition to the Wait Set.
@@ -62,7 +72,9 @@ public:
     /**
      * @brief Allows an application thread to wait for the occurrence of certain conditions.
      * If none of the conditions attached to the WaitSet have a trigger_value of true,
-     * the wait operation will block suspending the calling thread
+     * the wait operation will block suspending the calling thread.
+     * The thread is only woken up when an attached condition is triggered, or when the timeout expires.
+     * Reusing the same @c active_conditions collection across calls avoids any memory allocation.
      * @param active_conditions Reference to the collection of conditions which trigger_value are true
      * @param timeout Maximum time of the wait
      * @return RETCODE_OK if everything correct, PRECONDITION_NOT_MET if WaitSet already waiting, TIMEOUT if maximum
@@ -79,6 +91,16 @@ public:
      */
     RTPS_DllAPI ReturnCode_t get_conditions(
             ConditionSeq& attached_conditions) const;
+
+private:
+
+    WaitSet(
+            const WaitSet&) = delete;
+
+    WaitSet& operator =(
+            const WaitSet&) = delete;
+
+    std::unique_ptr<detail::WaitSetImpl> impl_;
 };
 
 } // namespace dds
@@ -74,9 +74,9 @@ class Subscriber;
 class SubscriberQos;
 class SubscriberListener;
 class TopicQos;
+class ContentFilteredTopic;
 
 // Not implemented classes
-class ContentFilteredTopic;
 class MultiTopic;
 
 /**
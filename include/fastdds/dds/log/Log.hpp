@@ -21,6 +21,11 @@
 #include <sstream>
 #include <atomic>
 #include <regex>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
 
 /**
  * eProsima log layer. Logging categories and verbosities can be specified dynamically at runtime.
@@ -33,6 +38,9 @@
  * * define LOG_NO_INFO
  *
  * Additionally. the lowest level (Info) is disabled by default on release branches.
+ *
+ * When built with LOG_BINARY, the macros do not format the messages on the calling thread. They record the call site
+ * and the raw value of the arguments on a per-thread buffer, and the logging thread formats and filters them.
  */
 
 // Logging API:
@@ -152,6 +160,310 @@ public:
             const Log::Context&,
             Log::Kind);
 
+    /**
+     * Call site of a log macro when built with LOG_BINARY.
+     * Each macro expansion has a static instance, whose address identifies the call site on the records.
+     * Only the logging thread modifies it after its initialization.
+     */
+    struct CallSite
+    {
+        Log::Context context;
+        Log::Kind kind;
+        //! Index of the category on the category filter mask. Assigned by the logging thread, zero until then.
+        uint32_t category_id;
+        //! Generation of the filters the filename verdict was computed with. Zero until computed.
+        uint32_t filter_generation;
+        //! Whether the filename of the call site passes the filename filter.
+        bool filename_passes;
+    };
+
+    /**
+     * Log entry recorded in binary form, used by the log macros when built with LOG_BINARY.
+     * Arguments of fundamental types, strings and stream manipulators are copied as they are, and formatted later on
+     * the logging thread. Arguments of other types are formatted when streamed, through their usual std::ostream
+     * operator. When that changes the format of the stream, as std::setw or std::setprecision do, the new format is
+     * recorded so the arguments formatted later are formatted with it.
+     * The entry is queued when the record is destroyed.
+     */
+    class Record
+    {
+    public:
+
+        RTPS_DllAPI explicit Record(
+                CallSite& site);
+
+        RTPS_DllAPI ~Record();
+
+        Record(
+                const Record&) = delete;
+
+        Record& operator =(
+                const Record&) = delete;
+
+        Record& operator <<(
+                bool value)
+        {
+            return put_value(arg_bool, static_cast<uint8_t>(value));
+        }
+
+        Record& operator <<(
+                char value)
+        {
+            return put_value(arg_char, value);
+        }
+
+        Record& operator <<(
+                signed char value)
+        {
+            return put_value(arg_signed_char, value);
+        }
+
+        Record& operator <<(
+                unsigned char value)
+        {
+            return put_value(arg_unsigned_char, value);
+        }
+
+        Record& operator <<(
+                short value)
+        {
+            return put_value(arg_int, static_cast<int64_t>(value));
+        }
+
+        Record& operator <<(
+                unsigned short value)
+        {
+            return put_value(arg_uint, static_cast<uint64_t>(value));
+        }
+
+        Record& operator <<(
+                int value)
+        {
+            return put_value(arg_int, static_cast<int64_t>(value));
+        }
+
+        Record& operator <<(
+                unsigned int value)
+        {
+            return put_value(arg_uint, static_cast<uint64_t>(value));
+        }
+
+        Record& operator <<(
+                long value)
+        {
+            return put_value(arg_int, static_cast<int64_t>(value));
+        }
+
+        Record& operator <<(
+                unsigned long value)
+        {
+            return put_value(arg_uint, static_cast<uint64_t>(value));
+        }
+
+        Record& operator <<(
+                long long value)
+        {
+            return put_value(arg_int, static_cast<int64_t>(value));
+        }
+
+        Record& operator <<(
+                unsigned long long value)
+        {
+            return put_value(arg_uint, static_cast<uint64_t>(value));
+        }
+
+        Record& operator <<(
+                float value)
+        {
+            return put_value(arg_float, value);
+        }
+
+        Record& operator <<(
+                double value)
+        {
+            return put_value(arg_double, value);
+        }
+
+        Record& operator <<(
+                long double value)
+        {
+            return put_value(arg_long_double, value);
+        }
+
+        Record& operator <<(
+                const void* value)
+        {
+            return put_value(arg_pointer, value);
+        }
+
+        Record& operator <<(
+                const char* value)
+        {
+            if (0 != stream_.width())
+            {
+                return format(value);
+            }
+            append_text(value, strlen(value));
+            return *this;
+        }
+
+        Record& operator <<(
+                const std::string& value)
+        {
+            if (0 != stream_.width())
+            {
+                return format(value);
+            }
+            append_text(value.c_str(), value.size());
+            return *this;
+        }
+
+        //! Manipulators like std::endl write their characters as text.
+        Record& operator <<(
+                std::ostream& (*manipulator)(std::ostream&))
+        {
+            manipulator(stream_);
+            return *this;
+        }
+
+        //! Format manipulators are recorded, and also applied to the arguments formatted when streamed.
+        Record& operator <<(
+                std::ios_base& (*manipulator)(std::ios_base&))
+        {
+            manipulator(stream_);
+            return put(arg_ios_manipulator, manipulator);
+        }
+
+        //! Arguments of other types, including manipulators taking arguments like std::setw, are formatted as text.
+        template<typename T, typename = decltype(std::declval<std::ostream&>() << std::declval<const T&>())>
+        Record& operator <<(
+                const T& value)
+        {
+            return format(value);
+        }
+
+        /**
+         * Formats as text the arguments whose operator is only visible where the macro is used.
+         * The remaining arguments of the entry are then formatted as text too.
+         */
+        operator std::ostream& ()
+        {
+            return stream_;
+        }
+
+        //! Type of an argument on the records.
+        enum ArgumentType : uint8_t
+        {
+            arg_bool,
+            arg_char,
+            arg_signed_char,
+            arg_unsigned_char,
+            arg_int,
+            arg_uint,
+            arg_float,
+            arg_double,
+            arg_long_double,
+            arg_pointer,
+            arg_string,
+            arg_ios_manipulator,
+            arg_format
+        };
+
+        //! Format of the stream, recorded when an argument formatted as text changes it.
+        struct FormatState
+        {
+            std::ios_base::fmtflags flags;
+            std::streamsize width;
+            std::streamsize precision;
+            char fill;
+        };
+
+    private:
+
+        //! Appends the text written on the stream of the thread to the record being built.
+        class TextBuffer;
+
+        template<typename T>
+        Record& put(
+                ArgumentType type,
+                const T& value)
+        {
+            text_length_pos_ = 0;
+            size_t pos = buffer_.size();
+            buffer_.resize(pos + 1 + sizeof(T));
+            buffer_[pos] = type;
+            memcpy(&buffer_[pos + 1], &value, sizeof(T));
+            return *this;
+        }
+
+        //! Values are padded to the width when formatted, consuming it as std::ostream does.
+        template<typename T>
+        Record& put_value(
+                ArgumentType type,
+                const T& value)
+        {
+            stream_.width(0);
+            return put(type, value);
+        }
+
+        //! Formats an argument as text, recording the format of the stream when the argument changes it.
+        template<typename T>
+        Record& format(
+                const T& value)
+        {
+            FormatState before = format_state();
+            stream_ << value;
+            FormatState after = format_state();
+            if (before.flags != after.flags || before.width != after.width || before.precision != after.precision ||
+                    before.fill != after.fill)
+            {
+                put(arg_format, after);
+            }
+            return *this;
+        }
+
+        FormatState format_state() const
+        {
+            FormatState state;
+            state.flags = stream_.flags();
+            state.width = stream_.width();
+            state.precision = stream_.precision();
+            state.fill = stream_.fill();
+            return state;
+        }
+
+        // Consecutive text is kept on a single string argument
+        void append_text(
+                const char* text,
+                size_t length)
+        {
+            uint32_t text_length = 0;
+            if (0 == text_length_pos_)
+            {
+                text_length_pos_ = buffer_.size() + 1;
+                buffer_.resize(text_length_pos_ + sizeof(text_length));
+                buffer_[text_length_pos_ - 1] = arg_string;
+            }
+            else
+            {
+                memcpy(&text_length, &buffer_[text_length_pos_], sizeof(text_length));
+            }
+
+            text_length += static_cast<uint32_t>(length);
+            memcpy(&buffer_[text_length_pos_], &text_length, sizeof(text_length));
+            buffer_.insert(buffer_.end(), text, text + length);
+        }
+
+        CallSite& site_;
+        std::vector<uint8_t>& buffer_;
+        //! Position of the length of the string argument text is appended to, zero when text starts a new one.
+        size_t text_length_pos_;
+        //! Stream of the thread, writing on this record.
+        std::ostream& stream_;
+        //! Record the stream wrote on before this one, when an argument logs while being formatted.
+        Record* previous_;
+    };
+
 private:
 
     struct Resources
@@ -192,6 +504,9 @@ private:
 
     static void run();
 
+    // Formats, filters and consumes the records queued by every thread.
+    static void consume_records();
+
     static void get_timestamp(
             std::string&);
 };
@@ -240,7 +555,23 @@ protected:
 #endif // if defined(WIN32)
 
 // Name of variables inside macros must be unique, or it could produce an error with external variables
-#if !HAVE_LOG_NO_ERROR
+#if HAVE_LOG_BINARY
+#define fastdds_log_record_(cat, msg, kind)                                                       \
+    {                                                                                             \
+        static Log::CallSite fastdds_log_site_tmp__ =                                             \
+        { {__FILE__, __LINE__, __func__, #cat}, kind, 0u, 0u, false};                             \
+        Log::Record fastdds_log_record_tmp__(fastdds_log_site_tmp__);                             \
+        fastdds_log_record_tmp__ << msg;                                                          \
+    }
+#endif // if HAVE_LOG_BINARY
+
+#if !HAVE_LOG_NO_ERROR && HAVE_LOG_BINARY
+#define logError_(cat, msg)                                                                                            \
+    {                                                                                                                  \
+        using namespace eprosima::fastdds::dds;                                                                        \
+        fastdds_log_record_(cat, msg, Log::Kind::Error);                                                               \
+    }
+#elif !HAVE_LOG_NO_ERROR
 #define logError_(cat, msg)                                                                                            \
     {                                                                                                                  \
         using namespace eprosima::fastdds::dds;                                                                        \
@@ -262,7 +593,16 @@ protected:
 #define logError_(cat, msg)
 #endif // ifndef LOG_NO_ERROR
 
-#if !HAVE_LOG_NO_WARNING
+#if !HAVE_LOG_NO_WARNING && HAVE_LOG_BINARY
+#define logWarning_(cat, msg)                                                                                       \
+    {                                                                                                               \
+        using namespace eprosima::fastdds::dds;                                                                     \
+        if (Log::GetVerbosity() >= Log::Kind::Warning)                                                              \
+        {                                                                                                           \
+            fastdds_log_record_(cat, msg, Log::Kind::Warning);                                                      \
+        }                                                                                                           \
+    }
+#elif !HAVE_LOG_NO_WARNING
 #define logWarning_(cat, msg)                                                                                       \
     {                                                                                                               \
         using namespace eprosima::fastdds::dds;                                                                     \
@@ -288,7 +628,16 @@ protected:
 #define logWarning_(cat, msg)
 #endif // ifndef LOG_NO_WARNING
 
-#if !HAVE_LOG_NO_INFO
+#if !HAVE_LOG_NO_INFO && HAVE_LOG_BINARY
+#define logInfo_(cat, msg)                                                                              \
+    {                                                                                                   \
+        using namespace eprosima::fastdds::dds;                                                         \
+        if (Log::GetVerbosity() >= Log::Kind::Info)                                                     \
+        {                                                                                               \
+            fastdds_log_record_(cat, msg, Log::Kind::Info);                                             \
+        }                                                                                               \
+    }
+#elif !HAVE_LOG_NO_INFO
 #define logInfo_(cat, msg)                                                                              \
     {                                                                                                   \
         using namespace eprosima::fastdds::dds;                                                         \
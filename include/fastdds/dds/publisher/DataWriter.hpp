@@ -162,6 +162,22 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write several samples at once.
+     *
+     * All the samples are added to the history while holding the writer lock only once, and, on synchronous
+     * DataWriters, their submessages are grouped on shared datagrams sent after the last sample has been added.
+     * The instance of each sample is deduced from its key.
+     *
+     * @param data Array of pointers to the samples.
+     * @param count Number of samples on the array.
+     * @return RETCODE_OK if all the samples are written. Otherwise the error of the first sample that could not be
+     * written. The samples before it remain written and the ones after it are not written.
+     */
+    RTPS_DllAPI ReturnCode_t write_many(
+            void* const* data,
+            size_t count);
+
     /** NOT YET IMPLEMENTED
      * @brief This operation performs the same function as write except that it also provides the value for the
      * @ref source_timestamp that is made available to DataReader objects by means of the @ref source_timestamp
@@ -289,7 +289,7 @@ public:
             ViewStateMask view_states = ANY_VIEW_STATE,
             InstanceStateMask instance_states = ANY_INSTANCE_STATE);
 
-    /** NOT YET IMPLEMENTED
+    /**
      * This operation accesses via ‘read’ the samples that match the criteria specified in the @ref ReadCondition.
      * This operation is especially useful in combination with @ref QueryCondition to filter data samples based on the
      * content.
@@ -426,7 +426,7 @@ public:
             ViewStateMask view_states = ANY_VIEW_STATE,
             InstanceStateMask instance_states = ANY_INSTANCE_STATE);
 
-    /** NOT YET IMPLEMENTED
+    /**
      * This operation accesses a collection of Data values from the DataReader. The behavior is identical to
      * @ref read_next_instance except that all samples returned satisfy the specified condition. In other words, on
      * success all returned samples belong to the same instance, and the instance is the instance with ‘smallest’
@@ -524,7 +524,7 @@ public:
             ViewStateMask view_states = ANY_VIEW_STATE,
             InstanceStateMask instance_states = ANY_INSTANCE_STATE);
 
-    /** NOT YET IMPLEMENTED
+    /**
      * This operation is analogous to @ref read_w_condition except it accesses samples via the ‘take’ operation.
      *
      * The specified ReadCondition must be attached to the DataReader; otherwise the operation will fail and return
@@ -627,7 +627,7 @@ public:
             ViewStateMask view_states = ANY_VIEW_STATE,
             InstanceStateMask instance_states = ANY_INSTANCE_STATE);
 
-    /** NOT YET IMPLEMENTED
+    /**
      * This operation accesses a collection of Data values from the DataReader. The behavior is identical to
      *  @ref read_next_instance except that all samples returned satisfy the specified condition. In other words, on
      * success all returned samples belong to the same instance, and the instance is the instance with ‘smallest’
@@ -936,7 +936,7 @@ public:
      * @param sample_states Vector of SampleStateKind
      * @param view_states Vector of ViewStateKind
      * @param instance_states Vector of InstanceStateKind
-     * @return ReadCondition pointer
+     * @return ReadCondition pointer, or nullptr if the DataReader is not enabled
      */
     RTPS_DllAPI ReadCondition* create_readcondition(
             const std::vector<SampleStateKind>& sample_states,
@@ -963,7 +963,7 @@ public:
     /**
      * @brief This operation deletes a ReadCondition attached to the DataReader.
      * @param a_condition pointer to a ReadCondition belonging to the DataReader
-     * @return RETCODE_OK
+     * @return RETCODE_OK, or RETCODE_PRECONDITION_NOT_MET if the condition was not created by this DataReader
      */
     RTPS_DllAPI ReturnCode_t delete_readcondition(
             ReadCondition* a_condition);
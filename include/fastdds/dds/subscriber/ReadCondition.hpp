@@ -0,0 +1,116 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.hpp
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_READCONDITION_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_READCONDITION_HPP_
+
+#include <atomic>
+
+#include <fastdds/dds/core/condition/Condition.hpp>
+#include <fastdds/dds/subscriber/InstanceState.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
+#include <fastrtps/fastrtps_dll.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataReader;
+class DataReaderImpl;
+
+/**
+ * @brief A ReadCondition is a specialized Condition associated with a DataReader.
+ *
+ * Its trigger_value is true whenever the DataReader holds at least one sample whose states match the ones given when
+ * the ReadCondition was created. ReadCondition objects are created and deleted through their DataReader.
+ */
+class ReadCondition : public Condition
+{
+    friend class DataReaderImpl;
+
+public:
+
+    /**
+     * @brief Retrieves the trigger_value of the Condition
+     * @return true if the DataReader has samples matching the states of this condition, false otherwise
+     */
+    RTPS_DllAPI bool get_trigger_value() const override;
+
+    /**
+     * @brief Retrieves the DataReader associated with the ReadCondition
+     * @return Pointer to the DataReader
+     */
+    RTPS_DllAPI DataReader* get_datareader() const;
+
+    /**
+     * @brief Retrieves the set of sample states taken into account to determine the trigger_value
+     * @return Mask of sample states
+     */
+    RTPS_DllAPI SampleStateMask get_sample_state_mask() const;
+
+    /**
+     * @brief Retrieves the set of view states taken into account to determine the trigger_value
+     * @return Mask of view states
+     */
+    RTPS_DllAPI ViewStateMask get_view_state_mask() const;
+
+    /**
+     * @brief Retrieves the set of instance states taken into account to determine the trigger_value
+     * @return Mask of instance states
+     */
+    RTPS_DllAPI InstanceStateMask get_instance_state_mask() const;
+
+protected:
+
+    ReadCondition(
+            DataReader* reader,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    ~ReadCondition();
+
+    /**
+     * @brief Updates the trigger_value, waking up the attached WaitSets when it turns true
+     * @param value New trigger value
+     */
+    void set_trigger_value(
+            bool value);
+
+    //! DataReader this condition belongs to
+    DataReader* reader_;
+
+    //! Sample states of the condition
+    SampleStateMask sample_states_;
+
+    //! View states of the condition
+    ViewStateMask view_states_;
+
+    //! Instance states of the condition
+    InstanceStateMask instance_states_;
+
+    //! Whether the reader holds samples matching the states of the condition
+    std::atomic<bool> trigger_value_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_DDS_SUBSCRIBER_READCONDITION_HPP_
@@ -0,0 +1,114 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopic.hpp
+ */
+
+#ifndef _FASTDDS_CONTENTFILTEREDTOPIC_HPP_
+#define _FASTDDS_CONTENTFILTEREDTOPIC_HPP_
+
+#include <fastrtps/fastrtps_dll.h>
+#include <fastrtps/types/TypesBase.h>
+#include <fastdds/dds/topic/TopicDescription.hpp>
+
+#include <string>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DomainParticipant;
+class DomainParticipantImpl;
+class ContentFilteredTopicImpl;
+class Topic;
+
+/**
+ * Specialization of TopicDescription that allows for content-based subscriptions.
+ *
+ * The filter expression uses the DDS-SQL syntax (i.e. "x > %0 AND color = 'RED'"). Samples not passing the filter
+ * are discarded by the matched writers whenever they support it, and always by the DataReader.
+ * @ingroup FASTDDS_MODULE
+ */
+class ContentFilteredTopic : public TopicDescription
+{
+    friend class DomainParticipantImpl;
+
+    ContentFilteredTopic(
+            const std::string& name,
+            Topic* related_topic,
+            ContentFilteredTopicImpl* impl);
+
+public:
+
+    /**
+     * @brief Destructor
+     */
+    RTPS_DllAPI virtual ~ContentFilteredTopic();
+
+    /**
+     * @brief Getter for the DomainParticipant
+     * @return DomainParticipant pointer
+     */
+    RTPS_DllAPI DomainParticipant* get_participant() const override;
+
+    /**
+     * Get the Topic this ContentFilteredTopic is based on.
+     * @return pointer to the related Topic.
+     */
+    RTPS_DllAPI Topic* get_related_topic() const;
+
+    /**
+     * Get the filter expression used on this ContentFilteredTopic.
+     * @return the filter expression.
+     */
+    RTPS_DllAPI const std::string& get_filter_expression() const;
+
+    /**
+     * Get the current values of the parameters of the filter expression.
+     * @param expression_parameters [out] Vector where the values are returned.
+     * @return RETCODE_OK
+     */
+    RTPS_DllAPI ReturnCode_t get_expression_parameters(
+            std::vector<std::string>& expression_parameters) const;
+
+    /**
+     * Change the values of the parameters of the filter expression.
+     * The new values are propagated to the DataReaders created on this ContentFilteredTopic, and announced to the
+     * writers matched with them.
+     * @param expression_parameters New values of the parameters.
+     * @return RETCODE_BAD_PARAMETER if the values are not valid for the filter expression, RETCODE_OK otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t set_expression_parameters(
+            const std::vector<std::string>& expression_parameters);
+
+    /**
+     * @brief Getter for the TopicDescriptionImpl
+     * @return pointer to TopicDescriptionImpl
+     */
+    TopicDescriptionImpl* get_impl() const override;
+
+protected:
+
+    ContentFilteredTopicImpl* impl_;
+};
+
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_CONTENTFILTEREDTOPIC_HPP_ */
@@ -37,6 +37,9 @@
 // This version of TypeSupport has `construct_sample()`
 #define TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
 
+// This version of TypeSupport has `copy_sample()`
+#define TOPIC_DATA_TYPE_API_HAS_COPY_SAMPLE
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -305,6 +308,26 @@ public:
         return false;
     }
 
+    /**
+     * Copy a sample into another one of this type.
+     *
+     * Types implementing this method let writers hand their samples to readers on the same process without
+     * serializing them.
+     *
+     * @param source Pointer to the sample to copy.
+     * @param destination Pointer to a sample created with createData() where the copy should be stored.
+     *
+     * @return whether this type supports copying samples or not.
+     */
+    RTPS_DllAPI virtual inline bool copy_sample(
+            const void* source,
+            void* destination) const
+    {
+        static_cast<void>(source);
+        static_cast<void>(destination);
+        return false;
+    }
+
     //! Maximum serialized size of the type in bytes.
     //! If the type has unbounded fields, and therefore cannot have a maximum size, use 0.
     uint32_t m_typeSize;
@@ -52,6 +52,7 @@ class WLP;
 class RTPSParticipantImpl;
 class RTPSWriter;
 class RTPSReader;
+struct ContentFilterProperty;
 
 /**
  * Class BuiltinProtocols that contains builtin endpoints implementing the discovery and liveliness protocols.
@@ -130,12 +131,14 @@ public:
      * @param R Pointer to the RTPSReader.
      * @param topicAtt Attributes of the associated topic
      * @param rqos QoS policies dictated by the subscriber
+     * @param content_filter Optional content filter applied by the reader
      * @return True if correct.
      */
     bool addLocalReader(
             RTPSReader* R,
             const TopicAttributes& topicAtt,
-            const fastdds::dds::ReaderQos& rqos);
+            const fastdds::dds::ReaderQos& rqos,
+            const ContentFilterProperty* content_filter = nullptr);
     /**
      * Update a local Writer QOS
      * @param W Writer to update
@@ -152,12 +155,14 @@ public:
      * @param R Reader to update
      * @param topicAtt Attributes of the associated topic
      * @param qos New Reader QoS
+     * @param content_filter Optional content filter applied by the reader
      * @return
      */
     bool updateLocalReader(
             RTPSReader* R,
             const TopicAttributes& topicAtt,
-            const fastdds::dds::ReaderQos& qos);
+            const fastdds::dds::ReaderQos& qos,
+            const ContentFilterProperty* content_filter = nullptr);
     /**
      * Remove a local Writer from the builtinProtocols.
      * @param W Pointer to the writer.
@@ -0,0 +1,79 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterProperty.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_BUILTIN_DATA_CONTENTFILTERPROPERTY_HPP_
+#define _FASTDDS_RTPS_BUILTIN_DATA_CONTENTFILTERPROPERTY_HPP_
+
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Information about the content filter being applied by a reader.
+ *
+ * It is sent on the PID_CONTENT_FILTER_PROPERTY parameter of the reader's discovery information, so matched writers
+ * can avoid sending the samples that would be discarded by the reader.
+ * @ingroup BUILTIN_MODULE
+ */
+struct ContentFilterProperty
+{
+    //! Name of the filter class used by the DDS-SQL subset.
+    static constexpr const char* DDSSQL_FILTER_CLASS = "DDSSQL";
+
+    ContentFilterProperty()
+        : filter_class_name(DDSSQL_FILTER_CLASS)
+    {
+    }
+
+    //! Name of the ContentFilteredTopic associated with the reader.
+    std::string content_filtered_topic_name;
+    //! Name of the Topic related to the ContentFilteredTopic (i.e. the one announced on discovery).
+    std::string related_topic_name;
+    //! Class of the filter being applied.
+    std::string filter_class_name;
+    //! Filter expression.
+    std::string filter_expression;
+    //! Values of the %N parameters on the filter expression.
+    std::vector<std::string> expression_parameters;
+
+    bool operator ==(
+            const ContentFilterProperty& other) const
+    {
+        return content_filtered_topic_name == other.content_filtered_topic_name &&
+               related_topic_name == other.related_topic_name &&
+               filter_class_name == other.filter_class_name &&
+               filter_expression == other.filter_expression &&
+               expression_parameters == other.expression_parameters;
+    }
+
+    bool operator !=(
+            const ContentFilterProperty& other) const
+    {
+        return !(*this == other);
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_BUILTIN_DATA_CONTENTFILTERPROPERTY_HPP_
@@ -26,6 +26,7 @@
 
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 
 #if HAVE_SECURITY
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
@@ -337,6 +338,31 @@ public:
         return m_type_information != nullptr;
     }
 
+    RTPS_DllAPI void content_filter(
+            const ContentFilterProperty& filter)
+    {
+        m_content_filter = filter;
+    }
+
+    RTPS_DllAPI const ContentFilterProperty& content_filter() const
+    {
+        return m_content_filter;
+    }
+
+    RTPS_DllAPI ContentFilterProperty& content_filter()
+    {
+        return m_content_filter;
+    }
+
+    /**
+     * Check whether the reader is applying a content filter.
+     * @return true when a filter expression has been set.
+     */
+    RTPS_DllAPI bool has_content_filter() const
+    {
+        return !m_content_filter.filter_expression.empty();
+    }
+
     inline bool disable_positive_acks() const
     {
         return m_qos.m_disablePositiveACKs.enabled;
@@ -457,6 +483,8 @@ private:
     xtypes::TypeInformation* m_type_information;
     //!
     ParameterPropertyList_t m_properties;
+    //!Content filter applied by the reader
+    ContentFilterProperty m_content_filter;
 };
 
 } // namespace rtps
@@ -20,6 +20,7 @@
 #define _FASTDDS_RTPS_CACHECHANGE_H_
 
 #include <cassert>
+#include <memory>
 
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/FragmentNumber.h>
@@ -32,6 +33,11 @@
 #include <fastdds/rtps/history/IPayloadPool.h>
 
 namespace eprosima {
+namespace fastdds {
+namespace dds {
+class TopicDataType;
+} // namespace dds
+} // namespace fastdds
 namespace fastrtps {
 namespace rtps {
 
@@ -61,6 +67,11 @@ struct RTPS_DllAPI CacheChange_t
     WriteParams write_params;
     bool is_untyped_ = true;
 
+    //!Sample handed to readers on the same process instead of a serialized payload (only used intraprocess)
+    std::shared_ptr<void> typed_sample;
+    //!Type able to copy and serialize typed_sample
+    fastdds::dds::TopicDataType* typed_sample_type = nullptr;
+
     /*!
      * @brief Default constructor.
      * Creates an empty CacheChange_t.
@@ -103,6 +114,8 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = ch_ptr->fragment_size_;
         fragment_count_ = ch_ptr->fragment_count_;
         first_missing_fragment_ = ch_ptr->first_missing_fragment_;
+        typed_sample = ch_ptr->typed_sample;
+        typed_sample_type = ch_ptr->typed_sample_type;
 
         return serializedPayload.copy(&ch_ptr->serializedPayload, !ch_ptr->is_untyped_);
     }
@@ -122,6 +135,8 @@ struct RTPS_DllAPI CacheChange_t
         sourceTimestamp = ch_ptr->sourceTimestamp;
         write_params = ch_ptr->write_params;
         isRead = ch_ptr->isRead;
+        typed_sample = ch_ptr->typed_sample;
+        typed_sample_type = ch_ptr->typed_sample_type;
 
         // Copy certain values from serializedPayload
         serializedPayload.encapsulation = ch_ptr->serializedPayload.encapsulation;
@@ -139,6 +154,15 @@ struct RTPS_DllAPI CacheChange_t
         assert(payload_owner_ == nullptr);
     }
 
+    /*!
+     * Checks if this change carries a typed sample in place of its serialized payload.
+     * @return true when the payload has not been serialized.
+     */
+    bool is_typed_only() const
+    {
+        return typed_sample && 0 == serializedPayload.length;
+    }
+
     /*!
      * Get the number of fragments this change is split into.
      * @return number of fragments.
@@ -22,9 +22,10 @@
 
 #include <fastdds/rtps/common/all_common.h>
 
-#include <unordered_map>
-#include <mutex>
+#include <atomic>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -66,14 +67,55 @@ public:
     // Functions to associate/remove associatedendpoints
     void associateEndpoint(
             Endpoint* to_add);
+
+    /**
+     * Remove an associated endpoint.
+     * When this function returns, no message is being dispatched to the endpoint, so it can be destroyed.
+     * @param to_remove Endpoint to remove.
+     */
     void removeEndpoint(
             Endpoint* to_remove);
 
+    /**
+     * Dispatch the messages of a writer addressed to unknown readers to a reader matched with it.
+     * Does nothing when the reader is not associated to this MessageReceiver.
+     * @param reader Reader matched with the writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void add_matched_writer(
+            const RTPSReader* reader,
+            const GUID_t& writer_guid);
+
+    /**
+     * Stop dispatching the messages of a writer addressed to unknown readers to a reader no longer matched with it.
+     * @param reader Reader that was matched with the writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void remove_matched_writer(
+            const RTPSReader* reader,
+            const GUID_t& writer_guid);
+
 private:
 
+    struct EndpointTable;
+    class DispatchGuard;
+
+    //! Protects the changes on the endpoint table.
     std::mutex mtx_;
-    std::vector<RTPSWriter*> associated_writers_;
-    std::unordered_map<EntityId_t, std::vector<RTPSReader*>> associated_readers_;
+    //! Serializes the waits for the dispatches still using a replaced endpoint table.
+    std::mutex synchronize_mtx_;
+    //! Endpoint table used by new dispatches. It is never modified, but replaced with a modified copy.
+    std::atomic<EndpointTable*> endpoints_;
+    //! Replaced endpoint tables that may still be in use by dispatches.
+    std::vector<EndpointTable*> retired_endpoints_;
+    //! Whether there are replaced endpoint tables to be freed.
+    std::atomic<bool> has_retired_endpoints_;
+    //! Epoch of the dispatches starting now.
+    std::atomic<uint32_t> dispatch_epoch_;
+    //! Number of dispatches in progress for even and odd epochs.
+    std::atomic<uint32_t> dispatches_[2];
+    //! Endpoint table used by the dispatch in progress.
+    const EndpointTable* current_endpoints_ = nullptr;
 
     RTPSParticipantImpl* participant_;
     //!Protocol version of the message
@@ -131,20 +173,48 @@ private:
             SubmessageHeader_t* smh);
 
     /**
-     * Find if there is a reader (in associated_readers_) that will accept a msg directed
-     * to the given entity ID.
+     * Replace the endpoint table used by new dispatches.
+     * The replaced table is freed when no dispatch is using it.
+     * @param endpoints New endpoint table.
+     */
+    void publish_endpoints_nts(
+            EndpointTable* endpoints);
+
+    /**
+     * Free the replaced endpoint tables when no dispatch is using them.
+     * Called when a dispatch finishes, it does nothing when the endpoint table is being changed.
+     */
+    void free_retired_endpoints();
+
+    /**
+     * Free the replaced endpoint tables when no dispatch is using them.
+     * Has to be called with the mutex taken.
+     */
+    void free_retired_endpoints_nts();
+
+    /**
+     * Wait until the dispatches that started before this call finish.
+     */
+    void wait_for_dispatches();
+
+    /**
+     * Find if there is a reader (in the current endpoint table) that will accept a msg directed
+     * to the given entity ID from the given writer.
      */
     bool willAReaderAcceptMsgDirectedTo(
             const EntityId_t& readerID,
+            const GUID_t& writerGUID,
             RTPSReader*& first_reader);
 
     /**
-     * Find all readers (in associated_readers_), with the given entity ID, and call the
-     * callback provided.
+     * Find all readers (in the current endpoint table), with the given entity ID, and call the
+     * callback provided. Messages directed to unknown readers are only given to the readers matched with the writer,
+     * and to the readers accepting messages from unknown writers.
      */
     template<typename Functor>
     void findAllReaders(
             const EntityId_t& readerID,
+            const GUID_t& writerGUID,
             const Functor& callback);
 
     /**@name Processing methods.
@@ -126,6 +126,12 @@ public:
             bool expectsInlineQos,
             InlineQosWriter* inlineQos);
 
+    /*
+     * On the addSubmessageData* methods, when payload_position is not nullptr the serialized payload is not
+     * copied into msg. The submessage header accounts for it, and the position of msg where it should be
+     * inserted is returned on payload_position, so it can be sent as a separate slice.
+     */
+
     static bool addSubmessageData(
             CDRMessage_t* msg,
             const CacheChange_t* change,
@@ -133,7 +139,8 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos,
-            bool* is_big_submessage);
+            bool* is_big_submessage,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageDataFrag(
             CDRMessage_t* msg,
@@ -152,7 +159,8 @@ public:
             TopicKind_t topicKind,
             const EntityId_t& readerId,
             bool expectsInlineQos,
-            InlineQosWriter* inlineQos);
+            InlineQosWriter* inlineQos,
+            uint32_t* payload_position = nullptr);
 
     static bool addMessageGap(
             CDRMessage_t* msg,
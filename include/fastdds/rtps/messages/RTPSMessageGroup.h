@@ -168,7 +168,26 @@ public:
 
     inline uint32_t get_current_bytes_processed() const
     { 
-        return currentBytesSent_ + full_msg_->length; 
+        return currentBytesSent_ + full_msg_->length + external_payloads_size_;
+    }
+
+    /**
+     * Makes the group copy every payload into its messages, instead of sending the large ones as separate slices.
+     * Needed when the changes added to the group may be released before the group is flushed.
+     */
+    void copy_payloads()
+    {
+        copy_payloads_ = true;
+    }
+
+    /**
+     * Marks the group as carrying only control submessages (HEARTBEAT, ACKNACK, GAP...).
+     * Its messages are then sent through RTPSMessageSenderInterface::send_control, which may coalesce them with the
+     * control messages of other endpoints.
+     */
+    void control_only()
+    {
+        control_only_ = true;
     }
 
     /**
@@ -192,6 +211,9 @@ private:
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
 
+    //! Payloads of at least this size are sent as separate slices instead of being copied into the message.
+    static constexpr uint32_t min_external_payload_size_ = 1024;
+
     void reset_to_header();
 
     void flush();
@@ -216,6 +238,20 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    /**
+     * Appends the current submessage, and the payload it references (if any), to the full message.
+     * @return false when the full message has no room for them.
+     */
+    bool append_submessage();
+
+    /**
+     * Checks whether a payload can be sent as a separate slice of the message.
+     * @param payload_size Size of the payload.
+     * @return true when the payload should not be copied into the submessage.
+     */
+    bool can_reference_payload(
+            uint32_t payload_size) const;
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -251,6 +287,21 @@ private:
     std::chrono::steady_clock::time_point max_blocking_time_point_;
 
     std::unique_ptr<RTPSMessageGroup_t> send_buffer_;
+
+    //! Payload referenced by the submessage being built.
+    NetworkBuffer pending_payload_;
+
+    //! Position of the submessage where pending_payload_ should be inserted.
+    uint32_t pending_payload_position_;
+
+    //! Sum of the sizes of the payloads referenced by the full message.
+    uint32_t external_payloads_size_;
+
+    //! Whether payloads are always copied into the messages.
+    bool copy_payloads_ = false;
+
+    //! Whether the group carries only control submessages.
+    bool control_only_ = false;
 };
 
 } /* namespace rtps */
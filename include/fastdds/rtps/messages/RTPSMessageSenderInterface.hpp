@@ -24,7 +24,9 @@
 
 #include <fastdds/rtps/messages/CDRMessage.h>
 #include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/network/NetworkBuffer.hpp>
 
+#include <cstring>
 #include <vector>
 
 namespace eprosima {
@@ -73,13 +75,58 @@ class RTPSMessageSenderInterface
 
         /**
          * Send a message through this interface.
+         * By default it is sent through send_slices as a single slice.
          *
          * @param message Pointer to the buffer with the message already serialized.
          * @param max_blocking_time_point Future timepoint where blocking send should end.
          */
         virtual bool send(
                 CDRMessage_t* message,
-                std::chrono::steady_clock::time_point& max_blocking_time_point) const = 0;
+                std::chrono::steady_clock::time_point& max_blocking_time_point) const
+        {
+            NetworkBufferList buffers(1, NetworkBuffer(message->buffer, message->length));
+            return send_slices(buffers, message->length, max_blocking_time_point);
+        }
+
+        /**
+         * Send a message given as a list of slices through this interface.
+         * By default the slices are copied into a single buffer sent through send.
+         * Implementations must override either this method or send.
+         *
+         * @param buffers List of slices composing the message already serialized.
+         * @param total_bytes Total size of the message.
+         * @param max_blocking_time_point Future timepoint where blocking send should end.
+         */
+        virtual bool send_slices(
+                const NetworkBufferList& buffers,
+                uint32_t total_bytes,
+                std::chrono::steady_clock::time_point& max_blocking_time_point) const
+        {
+            CDRMessage_t message(total_bytes);
+            for (const NetworkBuffer& slice : buffers)
+            {
+                memcpy(&message.buffer[message.length], slice.buffer, slice.size);
+                message.length += slice.size;
+            }
+            return send(&message, max_blocking_time_point);
+        }
+
+        /**
+         * Send a message carrying only control submessages (HEARTBEAT, ACKNACK, GAP...) through this interface.
+         * Implementations may hold it for a short time, so it shares its datagram with the control messages of
+         * other endpoints to the same destinations. By default it is sent right away.
+         *
+         * @param buffers List of slices composing the message already serialized.
+         * @param total_bytes Total size of the message.
+         * @param max_blocking_time_point Future timepoint where blocking send should end.
+         */
+        virtual bool send_control(
+                const NetworkBufferList& buffers,
+                uint32_t total_bytes,
+                std::chrono::steady_clock::time_point& max_blocking_time_point) const
+        {
+            return send_slices(buffers, total_bytes, max_blocking_time_point);
+        }
 };
 
 } /* namespace rtps */
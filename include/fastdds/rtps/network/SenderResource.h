@@ -15,9 +15,12 @@
 #ifndef _FASTDDS_RTPS_SENDER_RESOURCE_H
 #define _FASTDDS_RTPS_SENDER_RESOURCE_H
 
+#include <fastdds/rtps/network/NetworkBuffer.hpp>
+
 #include <functional>
 #include <vector>
 #include <chrono>
+#include <cstring>
 
 namespace eprosima{
 namespace fastrtps{
@@ -65,6 +68,55 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends a message given as a list of slices to a destination locator, through the channel managed by this
+     * resource.
+     * When the underlying transport does not support scatter-gather sending, the slices are first copied into an
+     * internal contiguous buffer, which is reused between calls. Callers should hence serialize calls to this
+     * method on the same resource.
+     * @param buffers List of slices composing the message, in order.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        LocatorsIterator* destination_locators_begin,
+        LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        if (send_buffers_lambda_)
+        {
+            return send_buffers_lambda_(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                    max_blocking_time_point);
+        }
+
+        if (buffers.size() == 1)
+        {
+            return send(buffers[0].buffer, buffers[0].size, destination_locators_begin, destination_locators_end,
+                    max_blocking_time_point);
+        }
+
+        // Fallback for transports that only accept contiguous buffers.
+        if (gather_buffer_.size() < total_bytes)
+        {
+            gather_buffer_.resize(total_bytes);
+        }
+
+        uint32_t pos = 0;
+        for (const NetworkBuffer& slice : buffers)
+        {
+            memcpy(&gather_buffer_[pos], slice.buffer, slice.size);
+            pos += slice.size;
+        }
+
+        return send(gather_buffer_.data(), pos, destination_locators_begin, destination_locators_end,
+                max_blocking_time_point);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -73,6 +125,8 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
+        gather_buffer_.swap(rValueResource.gather_buffer_);
     }
 
     virtual ~SenderResource() = default;
@@ -93,8 +147,20 @@ protected:
             LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point&)> send_lambda_;
 
+    //! Optional scatter-gather send implementation. When empty, messages are made contiguous before sending.
+    std::function<bool(
+            const NetworkBufferList&,
+            uint32_t,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point&)> send_buffers_lambda_;
+
 private:
 
+    //! Contiguous copy of the last message sent with the fallback path.
+    std::vector<octet> gather_buffer_;
+
+
     SenderResource()                                 = delete;
     SenderResource(const SenderResource&)            = delete;
     SenderResource& operator=(const SenderResource&) = delete;
@@ -51,6 +51,7 @@ class RTPSWriter;
 class RTPSReader;
 class WriterProxyData;
 class ReaderProxyData;
+struct ContentFilterProperty;
 class WriterAttributes;
 class ReaderAttributes;
 class ResourceEvent;
@@ -140,12 +141,14 @@ public:
      * @param Reader Pointer to the RTPSReader.
      * @param topicAtt Topic Attributes where you want to register it.
      * @param rqos ReaderQos.
+     * @param content_filter Optional content filter applied by the reader.
      * @return True if correctly registered.
      */
     bool registerReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Update writer QOS
@@ -164,12 +167,14 @@ public:
      * @param Reader to update
      * @param topicAtt Topic Attributes where you want to register it.
      * @param rqos New reader QoS
+     * @param content_filter Optional content filter applied by the reader.
      * @return true on success
      */
     bool updateReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Returns a list with the participant names.
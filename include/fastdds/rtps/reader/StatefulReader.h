@@ -262,13 +262,15 @@ public:
 
     /**
      * Use the participant of this reader to send a message to certain locator.
-     * @param message Message to be sent.
+     * @param buffers List of slices composing the message to be sent.
+     * @param total_bytes Total size of the message.
      * @param locators_begin Destination locators iterator begin.
      * @param locators_end Destination locators iterator end.
      * @param max_blocking_time_point Future time point where any blocking should end.
      */
     bool send_sync_nts(
-            CDRMessage_t* message,
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
             const Locators& locators_begin,
             const Locators& locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point);
@@ -114,11 +114,23 @@ private:
     //! The total number of created timers.
     size_t timers_count_ = 0;
 
-    //! Collection of events pending update action.
+    //! Entry of the active timers heap.
+    struct ActiveTimer
+    {
+        //! Trigger time of the event when it was scheduled.
+        std::chrono::steady_clock::time_point trigger_time;
+        //! The scheduled event.
+        TimedEventImpl* event;
+    };
+
+    //! Collection of events pending update action, in no particular order.
     std::vector<TimedEventImpl*> pending_timers_;
 
-    //! Collection of registered events waiting completion.
-    std::vector<TimedEventImpl*> active_timers_;
+    //! Binary heap of registered events waiting completion, with the first one to expire on top.
+    std::vector<ActiveTimer> active_timers_;
+
+    //! Events expired on the current iteration of the execution thread.
+    std::vector<TimedEventImpl*> expired_timers_;
 
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
@@ -138,8 +150,44 @@ private:
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
+    /*!
+     * @brief Removes an event from the pending collection, if it is there.
+     * Non thread safe.
+     * @param event Event to be removed.
+     * @return True if the event was pending.
+     */
+    bool remove_pending_nts(
+            TimedEventImpl* event);
+
+    /*!
+     * @brief Adds an event to the active timers, or moves it to its new trigger time if it is already active.
+     * @param event Event to be scheduled.
+     * @param trigger_time Time when the event expires.
+     */
+    void schedule_timer(
+            TimedEventImpl* event,
+            const std::chrono::steady_clock::time_point& trigger_time);
+
+    /*!
+     * @brief Removes an event from the active timers, if it is there.
+     * @param event Event to be removed.
+     * @return True if the event was active.
+     */
+    bool remove_active_timer(
+            TimedEventImpl* event);
+
+    //! Moves the active timer on a position towards the top of the heap until the heap order is restored.
+    void sift_up(
+            size_t position);
+
+    //! Moves the active timer on a position towards the bottom of the heap until the heap order is restored.
+    void sift_down(
+            size_t position);
+
+    //! Places an entry on a position of the active timers heap, updating the position kept on its event.
+    void place_active_timer(
+            size_t position,
+            const ActiveTimer& timer);
 
     //! Updates internal register of current time.
     void update_current_time();
@@ -152,6 +200,7 @@ private:
     {
         pending_timers_.reserve(timers_count_);
         active_timers_.reserve(timers_count_);
+        expired_timers_.reserve(timers_count_);
     }
 
 };
@@ -152,6 +152,14 @@ protected:
     void perform_listen_operation(
             fastrtps::rtps::Locator_t input_locator);
 
+    /**
+     * Function to be called from a new thread when batched reception is enabled. It performs blocking receive
+     * operations that retrieve several datagrams at once, and dispatches them in reception order.
+     * @param input_locator - Locator that triggered the creation of the resource
+     */
+    void perform_batched_listen_operation(
+            fastrtps::rtps::Locator_t input_locator);
+
     /**
     * Blocking Receive from the specified channel.
     * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
@@ -166,8 +174,21 @@ protected:
             uint32_t& receive_buffer_size,
             fastrtps::rtps::Locator_t& remote_locator);
 
+    /**
+     * Blocking receive of several datagrams from the specified channel.
+     * Waits until at least one datagram is available, and then retrieves as many pending datagrams as
+     * slots there are in the reception ring, without blocking again.
+     * @return Number of datagrams stored at the beginning of the reception ring.
+     */
+    size_t receive_batch();
+
 private:
 
+    //! Preallocated buffers (and their associated system structures) used on batched reception.
+    struct ReceiveBatch;
+
+    std::unique_ptr<ReceiveBatch> batch_;
+
     TransportReceiverInterface* message_receiver_; //Associated Readers/Writers inside of MessageReceiver
     eProsimaUDPSocket socket_;
     bool only_multicast_purpose_;
@@ -50,9 +50,28 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
     * specially useful on high-frequency best-effort writers.
     *
     * When set to false, calls to send_to() will block until the network buffer has space for the
-    * datagram. This may hinder performance on high-frequency writers.
+    * datagram, or until the maximum blocking time of the send expires, in which case the datagram is
+    * dropped. A send whose maximum blocking time has already expired is still attempted once, and is
+    * only dropped if the socket cannot accept the datagram right away. This may hinder performance on
+    * high-frequency writers.
+    *
+    * In both cases, dropped datagrams are reported by UDPTransportInterface::get_send_statistics().
     */
    bool non_blocking_send = false;
+
+   /**
+    * Maximum number of datagrams retrieved on each receive operation of the listening threads.
+    *
+    * When set to a value greater than 1, and the platform supports it (currently Linux, through recvmmsg()),
+    * each listening thread keeps a ring of this number of preallocated buffers, fills as many of them as
+    * datagrams are available with a single system call, and then dispatches them to the message receiver
+    * one after another. This greatly reduces the number of system calls on high-rate topics, at the cost of
+    * allocating one reception buffer of maxMessageSize bytes per slot and listening socket. Datagrams larger
+    * than a slot are discarded.
+    *
+    * When set to 0 or 1, a single datagram is retrieved on each receive operation.
+    */
+   uint32_t receive_batch_size = 1;
 } UDPTransportDescriptor;
 
 } // namespace rtps
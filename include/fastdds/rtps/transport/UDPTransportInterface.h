@@ -23,6 +23,7 @@
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <map>
@@ -32,6 +33,28 @@ namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+/**
+ * Statistics about the outgoing traffic of an UDP transport.
+ * @ingroup TRANSPORT_MODULE
+ */
+struct UDPSendStatistics
+{
+    //! Number of datagrams dropped because the socket could not accept them on time.
+    uint64_t dropped_would_block = 0;
+
+    //! Number of times a send had to wait for the socket to become writable.
+    uint64_t blocked_sends = 0;
+
+    //! Number of system calls that sent the same datagram to several destinations at once.
+    uint64_t fan_out_calls = 0;
+
+    //! Number of datagrams sent by those calls. Dividing it by fan_out_calls gives the average batch size.
+    uint64_t fan_out_datagrams = 0;
+
+    //! Largest number of datagrams sent by a single one of those calls.
+    uint64_t fan_out_max_batch = 0;
+};
+
 class UDPTransportInterface : public TransportInterface
 {
 public:
@@ -105,7 +128,8 @@ public:
      * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
      * so should not be reuse.
      * @param only_multicast_purpose
-     * @param max_blocking_time_point maximum blocking time.
+     * @param max_blocking_time_point maximum blocking time. When the socket cannot accept the datagram, the send waits
+     * until this time point and then drops the datagram. An already expired time point drops it without waiting.
      */
     virtual bool send(
             const fastrtps::rtps::octet* send_buffer,
@@ -116,6 +140,31 @@ public:
             bool only_multicast_purpose,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Blocking scatter-gather Send through the specified channel. The message is given as a sequence of buffers
+     * which are sent as a single datagram (using sendmsg() or its platform equivalent), so they do not need to be
+     * copied into a contiguous buffer beforehand.
+     * @param buffers Sequence of slices composing the message, in order.
+     * @param total_bytes Sum of the sizes of all the slices. It must not exceed the send_buffer_size fed to this class
+     * during construction.
+     * @param socket channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param only_multicast_purpose
+     * @param max_blocking_time_point maximum blocking time. When the socket cannot accept the datagram, the send waits
+     * until this time point and then drops the datagram. An already expired time point drops it without waiting.
+     */
+    virtual bool send(
+            const std::vector<asio::const_buffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -155,6 +204,12 @@ public:
         return configuration()->maxMessageSize;
     }
 
+    /**
+     * Gets a snapshot of the statistics about the outgoing traffic of this transport.
+     * @return Current values of the send statistics.
+     */
+    UDPSendStatistics get_send_statistics() const;
+
 protected:
 
     friend class UDPChannelResource;
@@ -169,6 +224,12 @@ protected:
     uint32_t mSendBufferSize;
     uint32_t mReceiveBufferSize;
 
+    std::atomic<uint64_t> dropped_would_block_;
+    std::atomic<uint64_t> blocked_sends_;
+    std::atomic<uint64_t> fan_out_calls_;
+    std::atomic<uint64_t> fan_out_datagrams_;
+    std::atomic<uint64_t> fan_out_max_batch_;
+
     UDPTransportInterface(
             int32_t transport_kind);
 
@@ -254,6 +315,42 @@ protected:
             const fastrtps::rtps::Locator_t& remote_locator,
             bool only_multicast_purpose,
             const std::chrono::microseconds& timeout);
+
+private:
+
+    //! Scratch storage used to send a datagram to several destinations at once. Each thread has its own.
+    struct SendBatch;
+
+    template<typename ConstBufferSequence>
+    bool send_to_locators(
+            const ConstBufferSequence& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+#if defined(__linux__)
+    /**
+     * Sends the datagram held by a batch to all its locators using sendmmsg().
+     */
+    bool send_fan_out(
+            SendBatch& batch,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            bool only_multicast_purpose,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+#endif // if defined(__linux__)
+
+    template<typename ConstBufferSequence>
+    bool send_to_locator(
+            const ConstBufferSequence& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            const fastrtps::rtps::Locator_t& remote_locator,
+            bool only_multicast_purpose,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
 };
 
 } // namespace rtps
@@ -79,6 +79,12 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         port_queue_capacity_ = port_queue_capacity;
     }
 
+    /**
+     * Time, in milliseconds, after which a listener not popping its port is considered hung.
+     * It also bounds how long a send waits for the listeners to release buffers when the segment is full. Sends
+     * without a writer deadline, as HEARTBEAT, ACKNACK, GAP and discovery messages, wait that long, holding the
+     * endpoint that sends them, before the buffers not yet received are discarded.
+     */
     RTPS_DllAPI uint32_t healthy_check_timeout_ms() const
     {
         return healthy_check_timeout_ms_;
@@ -101,12 +107,29 @@ typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterfac
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    /**
+     * Time, in microseconds, a listener busy-polls its port for new buffers before blocking on it.
+     * Spinning saves the wake-up of the listener when buffers arrive at a high rate, at the cost of CPU time.
+     * 0 (default) makes listeners always block.
+     */
+    RTPS_DllAPI uint32_t listener_spin_time_us() const
+    {
+        return listener_spin_time_us_;
+    }
+
+    RTPS_DllAPI void listener_spin_time_us(
+            uint32_t listener_spin_time_us)
+    {
+        listener_spin_time_us_ = listener_spin_time_us;
+    }
+
 private:
 
     uint32_t segment_size_;
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t listener_spin_time_us_;
 
 }SharedMemTransportDescriptor;
 
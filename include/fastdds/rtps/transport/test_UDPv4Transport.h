@@ -48,6 +48,18 @@ public:
             bool only_multicast_purpose,
             const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
 
+    /**
+     * Scatter-gather messages are made contiguous, so they go through the same dropping criteria.
+     */
+    virtual bool send(
+            const std::vector<asio::const_buffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
+
     RTPS_DllAPI static bool test_UDPv4Transport_ShutdownAllNetwork;
     // Handle to a persistent log of dropped packets. Defaults to length 0 (no logging) to prevent wasted resources.
     RTPS_DllAPI static std::vector<std::vector<fastrtps::rtps::octet>> test_UDPv4Transport_DropLog;
@@ -94,6 +106,7 @@ private:
     PercentageData percentage_of_messages_to_drop_;
     test_UDPv4TransportDescriptor::filter messages_filter_;
     std::vector<fastrtps::rtps::SequenceNumber_t> sequence_number_data_messages_to_drop_;
+    std::vector<fastrtps::rtps::octet> gather_buffer_;
 
 
     bool log_drop(
@@ -20,6 +20,7 @@
 #ifndef _FASTDDS_RTPS_IREADERDATA_FILTER_H_
 #define _FASTDDS_RTPS_IREADERDATA_FILTER_H_
 
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/Guid.h>
 
@@ -52,6 +53,20 @@ public:
         return true;
     }
 
+    /**
+     * This method is called when the content filter of a remote reader is discovered or changes.
+     * It is also called with a null filter when the reader is unmatched.
+     * @param reader_guid remote reader GUID_t
+     * @param filter Content filter announced by the reader, or nullptr if it is not filtering.
+     */
+    virtual void update_reader_filter(
+            const fastrtps::rtps::GUID_t& reader_guid,
+            const fastrtps::rtps::ContentFilterProperty* filter)
+    {
+        (void)reader_guid;
+        (void)filter;
+    }
+
 };
 
 } /* namespace rtps */
@@ -174,6 +174,16 @@ public:
         return true;
     }
 
+    /**
+     * Check if all the readers matched with this writer are on the same process, so changes reach them without
+     * being serialized for a transport.
+     * @return True when there are no remote or data-sharing readers, nor fixed destinations.
+     */
+    RTPS_DllAPI virtual bool has_only_local_readers() const
+    {
+        return false;
+    }
+
     /**
      * Update the Attributes of the Writer.
      * @param att New attributes
@@ -187,6 +197,20 @@ public:
      */
     RTPS_DllAPI virtual void send_any_unsent_changes() = 0;
 
+    /**
+     * Start grouping the submessages sent for the changes added to the history, so they share datagrams.
+     * Only synchronous writers group their submessages, which are sent when end_batch() is called, or before
+     * blocking on a full history. The writer mutex should be kept locked until end_batch() is called.
+     * @param max_blocking_time Future time point where sending the grouped submessages should end.
+     */
+    RTPS_DllAPI void begin_batch(
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Send the submessages grouped since begin_batch() was called, and stop grouping them.
+     */
+    RTPS_DllAPI void end_batch();
+
     /**
      * Get Min Seq Num in History.
      * @return Minimum sequence number in history
@@ -407,11 +431,24 @@ public:
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices composing the message already serialized.
+     * @param total_bytes Total size of the message.
+     * @param max_blocking_time_point Future timepoint where blocking send should end.
+     */
+    bool send_slices(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
+
+    /**
+     * Send a message carrying only control submessages, allowing the participant to coalesce it.
+     * @param buffers List of slices composing the message already serialized.
+     * @param total_bytes Total size of the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
-    bool send(
-            CDRMessage_t* message,
+    bool send_control(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
     /**
@@ -480,6 +517,14 @@ protected:
 
     bool is_pool_initialized() const;
 
+    /**
+     * Send the submessages grouped on batch_group_ so far.
+     */
+    virtual void flush_batch_nts();
+
+    //!Group of the submessages sent during a batch. Only set between begin_batch() and end_batch().
+    std::unique_ptr<RTPSMessageGroup> batch_group_;
+
 private:
 
     RTPSWriter& operator =(
@@ -274,6 +274,12 @@ public:
         return mp_RTPSParticipant;
     }
 
+    /**
+     * Check if all the readers matched with this writer are on the same process.
+     * @return True when there are no remote or data-sharing readers.
+     */
+    bool has_only_local_readers() const override;
+
     /**
      * Get the number of matched readers
      * @return Number of the matched readers
@@ -393,6 +399,8 @@ private:
     bool is_acked_by_all(
             const SequenceNumber_t seq) const;
 
+    void flush_batch_nts() override;
+
     void update_reader_info(
             bool create_sender_resources);
 
@@ -473,6 +481,9 @@ private:
     bool there_are_remote_readers_ = false;
     bool there_are_local_readers_ = false;
 
+    //! Whether changes were grouped on the current batch since its last heartbeat
+    bool batch_heartbeat_pending_ = false;
+
     StatefulWriter& operator =(
             const StatefulWriter&) = delete;
 
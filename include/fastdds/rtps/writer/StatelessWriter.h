@@ -161,13 +161,21 @@ public:
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers List of slices composing the message already serialized.
+     * @param total_bytes Total size of the message.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
-    bool send(
-            CDRMessage_t* message,
+    bool send_slices(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
+    /**
+     * Check if all the readers matched with this writer are on the same process.
+     * @return True when there are no remote or data-sharing readers, nor fixed destinations.
+     */
+    bool has_only_local_readers() const override;
+
     /**
      * Get the number of matched readers
      * @return Number of the matched readers
@@ -203,6 +211,10 @@ private:
     bool datasharing_delivery(
             CacheChange_t* change);
 
+    void add_change_to_group(
+            RTPSMessageGroup& group,
+            CacheChange_t* change);
+
     bool intraprocess_delivery(
             CacheChange_t* change,
             ReaderLocator& reader_locator);
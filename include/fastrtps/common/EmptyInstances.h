@@ -0,0 +1,137 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EmptyInstances.h
+ *
+ */
+
+#ifndef EMPTYINSTANCES_H_
+#define EMPTYINSTANCES_H_
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastrtps/common/KeyedChanges.h>
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief List of the instances of a history which have no changes, ordered by the time they became empty.
+ *
+ * Each instance keeps its position on the list (see KeyedChanges), so adding, removing and getting the
+ * least recently emptied instance are constant time operations.
+ * Nodes of removed instances are kept for later reuse, so no allocations are performed once the list has been
+ * reserved for the maximum number of instances.
+ * @ingroup FASTRTPS_MODULE
+ */
+class EmptyInstances
+{
+public:
+
+    /**
+     * @brief Preallocate nodes for a number of instances
+     * @param num_instances Number of instances to preallocate
+     */
+    void reserve(
+            size_t num_instances)
+    {
+        size_t current = empty_.size() + free_.size();
+        if (num_instances > current)
+        {
+            free_.resize(free_.size() + num_instances - current);
+        }
+    }
+
+    /**
+     * @brief Put an instance at the end of the list, if it is not already on it
+     * @param handle The instance handle
+     * @param instance The changes of the instance
+     */
+    void push(
+            const rtps::InstanceHandle_t& handle,
+            KeyedChanges& instance)
+    {
+        if (instance.is_empty_listed)
+        {
+            return;
+        }
+
+        if (free_.empty())
+        {
+            empty_.push_back(handle);
+        }
+        else
+        {
+            empty_.splice(empty_.end(), free_, free_.begin());
+            empty_.back() = handle;
+        }
+        instance.empty_position = std::prev(empty_.end());
+        instance.is_empty_listed = true;
+    }
+
+    /**
+     * @brief Take an instance out of the list, if it is on it
+     * @param instance The changes of the instance
+     */
+    void erase(
+            KeyedChanges& instance)
+    {
+        if (!instance.is_empty_listed)
+        {
+            return;
+        }
+
+        free_.splice(free_.end(), empty_, instance.empty_position);
+        instance.is_empty_listed = false;
+    }
+
+    /**
+     * @brief Get the instance which has been empty for the longest time
+     * @param handle The instance handle
+     * @return False if there are no empty instances
+     */
+    bool front(
+            rtps::InstanceHandle_t& handle) const
+    {
+        if (empty_.empty())
+        {
+            return false;
+        }
+
+        handle = empty_.front();
+        return true;
+    }
+
+    //! Number of empty instances
+    size_t size() const
+    {
+        return empty_.size();
+    }
+
+private:
+
+    //! Handles of the empty instances
+    std::list<rtps::InstanceHandle_t> empty_;
+    //! Nodes available for reuse
+    std::list<rtps::InstanceHandle_t> free_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* EMPTYINSTANCES_H_ */
@@ -21,7 +21,9 @@
 #define KEYEDCHANGES_H_
 
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
 #include <chrono>
+#include <list>
 
 namespace eprosima{
 namespace fastrtps{
@@ -36,6 +38,8 @@ struct KeyedChanges
     KeyedChanges()
         : cache_changes()
         , next_deadline_us()
+        , empty_position()
+        , is_empty_listed(false)
     {
     }
 
@@ -43,6 +47,8 @@ struct KeyedChanges
     KeyedChanges(const KeyedChanges& other)
         : cache_changes(other.cache_changes)
         , next_deadline_us(other.next_deadline_us)
+        , empty_position(other.empty_position)
+        , is_empty_listed(other.is_empty_listed)
     {
     }
 
@@ -55,6 +61,10 @@ struct KeyedChanges
     std::vector<rtps::CacheChange_t*> cache_changes;
     //! The time when the group will miss the deadline
     std::chrono::steady_clock::time_point next_deadline_us;
+    //! Position of the group on the list of groups without changes (only valid when is_empty_listed is true)
+    std::list<rtps::InstanceHandle_t>::iterator empty_position;
+    //! Whether the group is on the list of groups without changes
+    bool is_empty_listed;
 };
 
 } /* namespace  */
@@ -28,9 +28,13 @@
 #include <fastrtps/common/KeyedChanges.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 
+#include <memory>
+
 namespace eprosima {
 namespace fastrtps {
 
+class InstanceDeadlines;
+
 /**
  * Class PublisherHistory, implementing a WriterHistory with support for keyed topics and HistoryQOS.
  * This class is created by the PublisherImpl and should not be used by the user directly.
@@ -147,6 +151,8 @@ private:
 
     //!Map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
+    //!Instances of keyed_changes_ ordered by their next deadline
+    std::unique_ptr<InstanceDeadlines> instance_deadlines_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
     //!HistoryQosPolicy values.
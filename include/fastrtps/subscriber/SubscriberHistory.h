@@ -26,16 +26,20 @@
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastrtps/qos/QosPolicies.h>
+#include <fastrtps/common/EmptyInstances.h>
 #include <fastrtps/common/KeyedChanges.h>
 #include <fastrtps/subscriber/SampleInfo.h>
 #include <fastrtps/attributes/TopicAttributes.h>
 
 #include <chrono>
 #include <functional>
+#include <memory>
 
 namespace eprosima {
 namespace fastrtps {
 
+class InstanceDeadlines;
+
 /**
  * Class SubscriberHistory, container of the different CacheChanges of a subscriber
  *  @ingroup FASTRTPS_MODULE
@@ -164,6 +168,10 @@ private:
 
     //!Map where keys are instance handles and values vectors of cache changes
     t_m_Inst_Caches keyed_changes_;
+    //!Instances of keyed_changes_ ordered by their next deadline
+    std::unique_ptr<InstanceDeadlines> instance_deadlines_;
+    //!Instances of keyed_changes_ without changes, in the order they should be replaced by new instances
+    EmptyInstances empty_instances_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
     //!HistoryQosPolicy values.
@@ -233,7 +241,7 @@ private:
 
     bool add_received_change_with_key(
             rtps::CacheChange_t* a_change,
-            std::vector<rtps::CacheChange_t*>& instance_changes);
+            t_m_Inst_Caches::iterator instance);
 
     bool deserialize_change(
             rtps::CacheChange_t* change,
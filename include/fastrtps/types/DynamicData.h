@@ -45,6 +45,12 @@ protected:
 
     void create_members(const DynamicData* pData);
 
+    //! Replaces the type and the values of this data with a deep copy of the ones of pData.
+    void copy_from(const DynamicData* pData);
+
+    //! Deep copies the default array element and the union discriminator of pData.
+    void copy_owned_values(const DynamicData* pData);
+
     void clean();
 
     void clean_members();
@@ -145,6 +151,7 @@ protected:
     friend class DynamicDataFactory;
     friend class DynamicPubSubType;
     friend class DynamicDataHelper;
+    friend class DynamicTypeSerializationPlan;
 
 public:
 
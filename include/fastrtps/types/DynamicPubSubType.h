@@ -21,10 +21,14 @@
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/utils/md5.h>
 
+#include <memory>
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
 
+class DynamicTypeSerializationPlan;
+
 class DynamicPubSubType : public eprosima::fastdds::dds::TopicDataType
 {
 protected:
@@ -34,6 +38,8 @@ protected:
     DynamicType_ptr dynamic_type_;
     MD5 m_md5;
     unsigned char* m_keyBuffer;
+    //! Serialization steps of dynamic_type_, compiled when the type is set
+    std::shared_ptr<DynamicTypeSerializationPlan> serialization_plan_;
 
 public:
 
@@ -65,6 +71,10 @@ public:
             void* data,
             eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
 
+    RTPS_DllAPI bool copy_sample(
+            const void* source,
+            void* destination) const override;
+
     RTPS_DllAPI void CleanDynamicType();
 
     RTPS_DllAPI DynamicType_ptr GetDynamicType() const;
@@ -48,6 +48,7 @@ protected:
     friend class TypeObjectFactory;
     friend class DynamicTypeMember;
     friend class DynamicDataHelper;
+    friend class DynamicTypeSerializationPlan;
     friend class fastdds::dds::DomainParticipantImpl;
 
     DynamicType();
@@ -60,6 +60,7 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* RECEIVE_BATCH_SIZE;
 extern const char* WHITE_LIST;
 extern const char* MAX_MESSAGE_SIZE;
 extern const char* MAX_INITIAL_PEERS_RANGE;
@@ -81,6 +82,7 @@ extern const char* HEALTHY_CHECK_TIMEOUT_MS;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* LISTENER_SPIN_TIME_US;
 extern const char* ON;
 
 // IntraprocessDeliveryType
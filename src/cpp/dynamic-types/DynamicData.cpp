@@ -131,11 +131,13 @@ DynamicData::DynamicData(
     , wstring_value_(pData->wstring_value_)
 #endif // ifdef DYNAMIC_TYPES_CHECKING
     , key_element_(pData->key_element_)
-    , default_array_value_(pData->default_array_value_)
+    , default_array_value_(nullptr)
     , union_label_(pData->union_label_)
     , union_id_(pData->union_id_)
-    , union_discriminator_(pData->union_discriminator_)
+    , union_discriminator_(nullptr)
+    , discriminator_value_(pData->discriminator_value_)
 {
+    copy_owned_values(pData);
     create_members(pData);
 }
 
@@ -158,7 +160,12 @@ void DynamicData::create_members(
         complex_values_.insert(std::make_pair(it->first, DynamicDataFactory::get_instance()->create_copy(it->second)));
     }
 #else
-    if (type_->is_complex_kind())
+    if (type_->get_kind() == TK_BITMASK || type_->get_kind() == TK_ENUM)
+    {
+        // Bitmasks and enums register their members but only manages one value.
+        values_.insert(std::make_pair(MEMBER_ID_INVALID, pData->clone_value(MEMBER_ID_INVALID, type_->get_kind())));
+    }
+    else if (type_->is_complex_kind())
     {
         for (auto it = pData->values_.begin(); it != pData->values_.end(); ++it)
         {
@@ -180,6 +187,57 @@ void DynamicData::create_members(
 #endif // ifdef DYNAMIC_TYPES_CHECKING
 }
 
+void DynamicData::copy_from(
+        const DynamicData* pData)
+{
+    if (this == pData)
+    {
+        return;
+    }
+
+    clean();
+
+    type_ = pData->type_;
+#ifdef DYNAMIC_TYPES_CHECKING
+    int32_value_ = pData->int32_value_;
+    uint32_value_ = pData->uint32_value_;
+    int16_value_ = pData->int16_value_;
+    uint16_value_ = pData->uint16_value_;
+    int64_value_ = pData->int64_value_;
+    uint64_value_ = pData->uint64_value_;
+    float32_value_ = pData->float32_value_;
+    float64_value_ = pData->float64_value_;
+    float128_value_ = pData->float128_value_;
+    char8_value_ = pData->char8_value_;
+    char16_value_ = pData->char16_value_;
+    byte_value_ = pData->byte_value_;
+    bool_value_ = pData->bool_value_;
+    string_value_ = pData->string_value_;
+    wstring_value_ = pData->wstring_value_;
+#endif // ifdef DYNAMIC_TYPES_CHECKING
+    key_element_ = pData->key_element_;
+    union_label_ = pData->union_label_;
+    union_id_ = pData->union_id_;
+    discriminator_value_ = pData->discriminator_value_;
+
+    copy_owned_values(pData);
+    create_members(pData);
+}
+
+void DynamicData::copy_owned_values(
+        const DynamicData* pData)
+{
+    // Both are deleted by clean(), so they cannot be shared with pData
+    if (pData->default_array_value_ != nullptr)
+    {
+        default_array_value_ = DynamicDataFactory::get_instance()->create_copy(pData->default_array_value_);
+    }
+    if (pData->union_discriminator_ != nullptr)
+    {
+        union_discriminator_ = DynamicDataFactory::get_instance()->create_copy(pData->union_discriminator_);
+    }
+}
+
 void DynamicData::create_members(
         DynamicType_ptr pType)
 {
@@ -21,6 +21,7 @@
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastcdr/Cdr.h>
+#include "DynamicTypeSerializationPlan.hpp"
 
 namespace eprosima {
 namespace fastrtps {
@@ -50,6 +51,7 @@ DynamicPubSubType::~DynamicPubSubType()
 void DynamicPubSubType::CleanDynamicType()
 {
     dynamic_type_ = nullptr;
+    serialization_plan_.reset();
 }
 
 DynamicType_ptr DynamicPubSubType::GetDynamicType() const
@@ -110,7 +112,15 @@ bool DynamicPubSubType::deserialize(
 
     try
     {
-        ((DynamicData*)data)->deserialize(deser); //Deserialize the object:
+        //Deserialize the object:
+        if (serialization_plan_)
+        {
+            serialization_plan_->deserialize((DynamicData*)data, deser);
+        }
+        else
+        {
+            ((DynamicData*)data)->deserialize(deser);
+        }
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
     {
@@ -129,7 +139,8 @@ bool DynamicPubSubType::getKey(
         return false;
     }
     DynamicData* pDynamicData = (DynamicData*)data;
-    size_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_));
+    size_t keyBufferSize = serialization_plan_ ? serialization_plan_->key_max_serialized_size() :
+            static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(dynamic_type_));
 
     if (m_keyBuffer == nullptr)
     {
@@ -139,7 +150,14 @@ bool DynamicPubSubType::getKey(
 
     eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
-    pDynamicData->serializeKey(ser);
+    if (serialization_plan_)
+    {
+        serialization_plan_->serialize_key(pDynamicData, ser);
+    }
+    else
+    {
+        pDynamicData->serializeKey(ser);
+    }
     if (force_md5 || keyBufferSize > 16)
     {
         m_md5.init();
@@ -160,10 +178,32 @@ bool DynamicPubSubType::getKey(
     return true;
 }
 
+bool DynamicPubSubType::copy_sample(
+        const void* source,
+        void* destination) const
+{
+    const DynamicData* source_data = static_cast<const DynamicData*>(source);
+    DynamicData* destination_data = static_cast<DynamicData*>(destination);
+    if (dynamic_type_ == nullptr || source_data == nullptr || destination_data == nullptr ||
+            source_data->type_ == nullptr || !source_data->type_->equals(dynamic_type_.get()))
+    {
+        return false;
+    }
+
+    destination_data->copy_from(source_data);
+    return true;
+}
+
 std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(void* data)
 {
-    return [data]() -> uint32_t
+    // The provider is called while the type is alive, a plain pointer keeps it within the small buffer of std::function.
+    const DynamicTypeSerializationPlan* plan = serialization_plan_.get();
+    return [data, plan]() -> uint32_t
     {
+        if (plan != nullptr)
+        {
+            return (uint32_t)plan->serialized_size((DynamicData*)data) + 4 /*encapsulation*/;
+        }
         return (uint32_t)DynamicData::getCdrSerializedSize((DynamicData*)data) + 4 /*encapsulation*/;
     };
 }
@@ -184,7 +224,15 @@ bool DynamicPubSubType::serialize(
 
     try
     {
-        ((DynamicData*)data)->serialize(ser); // Serialize the object:
+        // Serialize the object:
+        if (serialization_plan_)
+        {
+            serialization_plan_->serialize((DynamicData*)data, ser);
+        }
+        else
+        {
+            ((DynamicData*)data)->serialize(ser);
+        }
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
     {
@@ -210,6 +258,7 @@ void DynamicPubSubType::UpdateDynamicTypeInfo()
 
         m_typeSize = static_cast<uint32_t>(DynamicData::getMaxCdrSerializedSize(dynamic_type_) + 4);
         setName(dynamic_type_->get_name().c_str());
+        serialization_plan_ = std::make_shared<DynamicTypeSerializationPlan>(dynamic_type_);
     }
 }
 
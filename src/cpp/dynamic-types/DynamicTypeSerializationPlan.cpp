@@ -0,0 +1,674 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicTypeSerializationPlan.cpp
+ */
+
+#include "DynamicTypeSerializationPlan.hpp"
+
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+#include <fastcdr/Cdr.h>
+
+#include <utility>
+
+// Access to the storage of a DynamicData, which depends on DYNAMIC_TYPES_CHECKING.
+#ifdef DYNAMIC_TYPES_CHECKING
+#define DYNAMIC_DATA_CHILDREN(data) (data)->complex_values_
+#define DYNAMIC_DATA_VALUE(data, type, field) ((data)->field)
+#else
+#define DYNAMIC_DATA_CHILDREN(data) (data)->values_
+#define DYNAMIC_DATA_VALUE(data, type, field) (*static_cast<type*>((data)->values_.begin()->second))
+#endif // ifdef DYNAMIC_TYPES_CHECKING
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+using eprosima::fastcdr::Cdr;
+
+DynamicTypeSerializationPlan::DynamicTypeSerializationPlan(
+        const DynamicType_ptr& type)
+{
+    compile(ops_, type, MEMBER_ID_INVALID);
+    compile_key(key_ops_, type, MEMBER_ID_INVALID);
+    fixed_size_ = is_fixed(ops_, 0) ? empty_serialized_size(ops_, 0, 0) : 0;
+    key_max_size_ = DynamicData::getKeyMaxCdrSerializedSize(type);
+}
+
+void DynamicTypeSerializationPlan::serialize(
+        const DynamicData* data,
+        Cdr& cdr) const
+{
+    serialize(ops_, 0, data, cdr);
+}
+
+void DynamicTypeSerializationPlan::deserialize(
+        DynamicData* data,
+        Cdr& cdr) const
+{
+    deserialize(ops_, 0, data, cdr);
+}
+
+void DynamicTypeSerializationPlan::serialize_key(
+        const DynamicData* data,
+        Cdr& cdr) const
+{
+    serialize(key_ops_, 0, data, cdr);
+}
+
+size_t DynamicTypeSerializationPlan::serialized_size(
+        const DynamicData* data) const
+{
+    if (fixed_size_ > 0 && data->type_.get() == ops_[0].type.get())
+    {
+        return fixed_size_;
+    }
+    return serialized_size(ops_, 0, data, 0);
+}
+
+DynamicType_ptr DynamicTypeSerializationPlan::resolve(
+        DynamicType_ptr type)
+{
+    // DynamicDataFactory creates the data of an alias with its base type.
+    while (type->get_kind() == TK_ALIAS && type->get_base_type() != nullptr)
+    {
+        type = type->get_base_type();
+    }
+    return type;
+}
+
+// DynamicData walks the members of a structure by index, so only structures whose ids go from zero to the number of
+// members get a dedicated operation.
+bool DynamicTypeSerializationPlan::has_indexed_members(
+        const DynamicType_ptr& type)
+{
+    MemberId expected = 0;
+    for (auto it = type->member_by_id_.begin(); it != type->member_by_id_.end(); ++it)
+    {
+        if (it->first != expected++)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DynamicTypeSerializationPlan::compile(
+        OpList& ops,
+        const DynamicType_ptr& type,
+        MemberId member_id)
+{
+    DynamicType_ptr resolved = resolve(type);
+    uint32_t index = static_cast<uint32_t>(ops.size());
+    ops.push_back({OP_LEGACY, member_id, 0, 0, resolved});
+
+    if (resolved->get_descriptor()->annotation_is_non_serialized())
+    {
+        ops[index].code = OP_SKIP;
+    }
+    else
+    {
+        switch (resolved->get_kind())
+        {
+            case TK_INT16: ops[index].code = OP_INT16; break;
+            case TK_UINT16: ops[index].code = OP_UINT16; break;
+            case TK_INT32: ops[index].code = OP_INT32; break;
+            case TK_UINT32: ops[index].code = OP_UINT32; break;
+            case TK_INT64: ops[index].code = OP_INT64; break;
+            case TK_UINT64: ops[index].code = OP_UINT64; break;
+            case TK_FLOAT32: ops[index].code = OP_FLOAT32; break;
+            case TK_FLOAT64: ops[index].code = OP_FLOAT64; break;
+            case TK_FLOAT128: ops[index].code = OP_FLOAT128; break;
+            case TK_CHAR8: ops[index].code = OP_CHAR8; break;
+            case TK_CHAR16: ops[index].code = OP_CHAR16; break;
+            case TK_BOOLEAN: ops[index].code = OP_BOOLEAN; break;
+            case TK_BYTE: ops[index].code = OP_BYTE; break;
+            case TK_STRING8: ops[index].code = OP_STRING8; break;
+            case TK_STRING16: ops[index].code = OP_STRING16; break;
+            case TK_ENUM: ops[index].code = OP_ENUM; break;
+            case TK_STRUCTURE:
+            {
+                // Derived structures keep the members of their base in the same data, leave them to DynamicData.
+                if (resolved->get_base_type() == nullptr && has_indexed_members(resolved))
+                {
+                    ops[index].code = OP_STRUCT;
+                    ops[index].count = static_cast<uint32_t>(resolved->member_by_id_.size());
+                    for (auto it = resolved->member_by_id_.begin(); it != resolved->member_by_id_.end(); ++it)
+                    {
+                        const MemberDescriptor* member = it->second->get_descriptor();
+                        if (!member->annotation_is_non_serialized())
+                        {
+                            compile(ops, member->get_type(), it->first);
+                        }
+                    }
+                }
+                break;
+            }
+            case TK_SEQUENCE:
+            {
+                ops[index].code = OP_SEQUENCE;
+                compile(ops, resolved->get_element_type(), MEMBER_ID_INVALID);
+                break;
+            }
+            case TK_ARRAY:
+            {
+                ops[index].code = OP_ARRAY;
+                ops[index].count = resolved->get_total_bounds();
+                compile(ops, resolved->get_element_type(), MEMBER_ID_INVALID);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    ops[index].end = static_cast<uint32_t>(ops.size());
+}
+
+void DynamicTypeSerializationPlan::compile_key(
+        OpList& ops,
+        const DynamicType_ptr& type,
+        MemberId member_id)
+{
+    DynamicType_ptr resolved = resolve(type);
+    uint32_t index = static_cast<uint32_t>(ops.size());
+
+    switch (resolved->get_kind())
+    {
+        case TK_STRUCTURE:
+        {
+            if (resolved->get_base_type() != nullptr || !has_indexed_members(resolved))
+            {
+                ops.push_back({OP_KEY_LEGACY, member_id, 0, index + 1, resolved});
+                return;
+            }
+
+            ops.push_back({OP_KEY_STRUCT, member_id, static_cast<uint32_t>(resolved->member_by_id_.size()), 0,
+                           resolved});
+            for (auto it = resolved->member_by_id_.begin(); it != resolved->member_by_id_.end(); ++it)
+            {
+                uint32_t child = static_cast<uint32_t>(ops.size());
+                compile_key(ops, it->second->get_descriptor()->get_type(), it->first);
+                if (ops[child].code == OP_SKIP)
+                {
+                    ops.resize(child);
+                }
+            }
+
+            if (ops.size() == index + 1u)
+            {
+                // No key member inside, nothing to visit.
+                ops[index].code = OP_SKIP;
+            }
+            ops[index].end = static_cast<uint32_t>(ops.size());
+            break;
+        }
+        case TK_BITSET:
+        {
+            ops.push_back({OP_KEY_LEGACY, member_id, 0, index + 1, resolved});
+            break;
+        }
+        default:
+        {
+            if (resolved->is_key_defined_)
+            {
+                compile(ops, resolved, member_id);
+            }
+            else
+            {
+                ops.push_back({OP_SKIP, member_id, 0, index + 1, resolved});
+            }
+            break;
+        }
+    }
+}
+
+bool DynamicTypeSerializationPlan::is_fixed(
+        const OpList& ops,
+        uint32_t index)
+{
+    for (uint32_t i = index; i < ops[index].end; ++i)
+    {
+        switch (ops[i].code)
+        {
+            case OP_STRING8:
+            case OP_STRING16:
+            case OP_KEY_STRUCT:
+            case OP_SEQUENCE:
+            case OP_LEGACY:
+            case OP_KEY_LEGACY:
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+// Returns the alignment after the default value of the operation, so the sizes of consecutive operations can be
+// chained. Operations of fixed size take the same room whatever their value.
+size_t DynamicTypeSerializationPlan::empty_serialized_size(
+        const OpList& ops,
+        uint32_t index,
+        size_t current_alignment)
+{
+    const Op& op = ops[index];
+    switch (op.code)
+    {
+        case OP_INT16:
+        case OP_UINT16:
+            return current_alignment + 2 + Cdr::alignment(current_alignment, 2);
+        case OP_INT32:
+        case OP_UINT32:
+        case OP_FLOAT32:
+        case OP_CHAR16: // WCHARS NEED 32 Bits on Linux & MacOS
+        case OP_ENUM:
+        case OP_SEQUENCE: // Elements count
+        case OP_STRING16: // string length
+            return current_alignment + 4 + Cdr::alignment(current_alignment, 4);
+        case OP_STRING8:
+            // string length + 1
+            return current_alignment + 4 + Cdr::alignment(current_alignment, 4) + 1;
+        case OP_INT64:
+        case OP_UINT64:
+        case OP_FLOAT64:
+            return current_alignment + 8 + Cdr::alignment(current_alignment, 8);
+        case OP_FLOAT128:
+            return current_alignment + 16 + Cdr::alignment(current_alignment, 8);
+        case OP_CHAR8:
+        case OP_BOOLEAN:
+        case OP_BYTE:
+            return current_alignment + 1;
+        case OP_STRUCT:
+        {
+            for (uint32_t child = index + 1; child < op.end; child = ops[child].end)
+            {
+                current_alignment = empty_serialized_size(ops, child, current_alignment);
+            }
+            return current_alignment;
+        }
+        case OP_ARRAY:
+        {
+            for (uint32_t idx = 0; idx < op.count; ++idx)
+            {
+                current_alignment = empty_serialized_size(ops, index + 1, current_alignment);
+            }
+            return current_alignment;
+        }
+        case OP_LEGACY:
+        case OP_KEY_LEGACY:
+        case OP_KEY_STRUCT:
+            return current_alignment + DynamicData::getEmptyCdrSerializedSize(op.type.get(), current_alignment);
+        default:
+            return current_alignment;
+    }
+}
+
+// Like DynamicData::serialize_empty_data, for the elements missing in an array.
+void DynamicTypeSerializationPlan::serialize_empty(
+        const OpList& ops,
+        uint32_t index,
+        const DynamicData* data,
+        Cdr& cdr)
+{
+    const Op& op = ops[index];
+    switch (op.code)
+    {
+        case OP_INT16: cdr << static_cast<int16_t>(0); break;
+        case OP_UINT16: cdr << static_cast<uint16_t>(0); break;
+        case OP_INT32: cdr << static_cast<int32_t>(0); break;
+        case OP_UINT32: cdr << static_cast<uint32_t>(0); break;
+        case OP_INT64: cdr << static_cast<int64_t>(0); break;
+        case OP_UINT64: cdr << static_cast<uint64_t>(0); break;
+        case OP_FLOAT32: cdr << static_cast<float>(0.0f); break;
+        case OP_FLOAT64: cdr << static_cast<double>(0.0); break;
+        case OP_FLOAT128: cdr << static_cast<long double>(0.0); break;
+        case OP_CHAR8: cdr << static_cast<char>(0); break;
+        case OP_CHAR16: cdr << static_cast<uint32_t>(0); break;
+        case OP_BOOLEAN: cdr << static_cast<uint8_t>(0); break;
+        case OP_BYTE: cdr << static_cast<uint8_t>(0); break;
+        case OP_STRING8: cdr << std::string(); break;
+        case OP_STRING16: cdr << std::wstring(); break;
+        case OP_ENUM: cdr << static_cast<uint32_t>(0); break;
+        case OP_SEQUENCE: cdr << static_cast<uint32_t>(0); break;
+        case OP_STRUCT:
+        {
+            for (uint32_t child = index + 1; child < op.end; child = ops[child].end)
+            {
+                serialize_empty(ops, child, data, cdr);
+            }
+            break;
+        }
+        case OP_ARRAY:
+        {
+            for (uint32_t idx = 0; idx < op.count; ++idx)
+            {
+                serialize_empty(ops, index + 1, data, cdr);
+            }
+            break;
+        }
+        case OP_SKIP:
+            break;
+        case OP_LEGACY:
+        case OP_KEY_LEGACY:
+        case OP_KEY_STRUCT:
+            data->serialize_empty_data(op.type, cdr);
+            break;
+    }
+}
+
+void DynamicTypeSerializationPlan::serialize(
+        const OpList& ops,
+        uint32_t index,
+        const DynamicData* data,
+        Cdr& cdr)
+{
+    const Op& op = ops[index];
+    const bool key = op.code == OP_KEY_STRUCT || op.code == OP_KEY_LEGACY;
+    if (data->type_.get() != op.type.get() ||
+            ((op.code == OP_STRUCT || op.code == OP_KEY_STRUCT) && DYNAMIC_DATA_CHILDREN(data).size() != op.count))
+    {
+        // Not created from the compiled type, or members were added by hand.
+        if (key)
+        {
+            data->serializeKey(cdr);
+        }
+        else
+        {
+            data->serialize(cdr);
+        }
+        return;
+    }
+
+    switch (op.code)
+    {
+        case OP_INT16: cdr << DYNAMIC_DATA_VALUE(data, int16_t, int16_value_); break;
+        case OP_UINT16: cdr << DYNAMIC_DATA_VALUE(data, uint16_t, uint16_value_); break;
+        case OP_INT32: cdr << DYNAMIC_DATA_VALUE(data, int32_t, int32_value_); break;
+        case OP_UINT32: cdr << DYNAMIC_DATA_VALUE(data, uint32_t, uint32_value_); break;
+        case OP_INT64: cdr << DYNAMIC_DATA_VALUE(data, int64_t, int64_value_); break;
+        case OP_UINT64: cdr << DYNAMIC_DATA_VALUE(data, uint64_t, uint64_value_); break;
+        case OP_FLOAT32: cdr << DYNAMIC_DATA_VALUE(data, float, float32_value_); break;
+        case OP_FLOAT64: cdr << DYNAMIC_DATA_VALUE(data, double, float64_value_); break;
+        case OP_FLOAT128: cdr << DYNAMIC_DATA_VALUE(data, long double, float128_value_); break;
+        case OP_CHAR8: cdr << DYNAMIC_DATA_VALUE(data, char, char8_value_); break;
+        case OP_CHAR16: cdr << DYNAMIC_DATA_VALUE(data, wchar_t, char16_value_); break;
+        case OP_BOOLEAN: cdr << DYNAMIC_DATA_VALUE(data, bool, bool_value_); break;
+        case OP_BYTE: cdr << DYNAMIC_DATA_VALUE(data, octet, byte_value_); break;
+        case OP_STRING8: cdr << DYNAMIC_DATA_VALUE(data, std::string, string_value_); break;
+        case OP_STRING16: cdr << DYNAMIC_DATA_VALUE(data, std::wstring, wstring_value_); break;
+        case OP_ENUM: cdr << DYNAMIC_DATA_VALUE(data, uint32_t, uint32_value_); break;
+        case OP_STRUCT:
+        case OP_KEY_STRUCT:
+        {
+            // Members are stored by id, skip the ones without operation.
+            const auto& children = DYNAMIC_DATA_CHILDREN(data);
+            auto it = children.begin();
+            for (uint32_t child = index + 1; child < op.end; child = ops[child].end)
+            {
+                while (it->first != ops[child].member_id)
+                {
+                    ++it;
+                }
+                serialize(ops, child, static_cast<const DynamicData*>(it->second), cdr);
+            }
+            break;
+        }
+        case OP_SEQUENCE:
+        {
+            const auto& children = DYNAMIC_DATA_CHILDREN(data);
+            cdr << static_cast<uint32_t>(children.size());
+            for (auto it = children.begin(); it != children.end(); ++it)
+            {
+                serialize(ops, index + 1, static_cast<const DynamicData*>(it->second), cdr);
+            }
+            break;
+        }
+        case OP_ARRAY:
+        {
+            // Only the elements which differ from the default value are stored.
+            const auto& children = DYNAMIC_DATA_CHILDREN(data);
+            auto it = children.begin();
+            for (uint32_t idx = 0; idx < op.count; ++idx)
+            {
+                if (it != children.end() && it->first == idx)
+                {
+                    serialize(ops, index + 1, static_cast<const DynamicData*>(it->second), cdr);
+                    ++it;
+                }
+                else
+                {
+                    serialize_empty(ops, index + 1, data, cdr);
+                }
+            }
+            break;
+        }
+        case OP_SKIP:
+            break;
+        case OP_LEGACY:
+            data->serialize(cdr);
+            break;
+        case OP_KEY_LEGACY:
+            data->serializeKey(cdr);
+            break;
+    }
+}
+
+void DynamicTypeSerializationPlan::deserialize(
+        const OpList& ops,
+        uint32_t index,
+        DynamicData* data,
+        Cdr& cdr)
+{
+    const Op& op = ops[index];
+    if (data->type_.get() != op.type.get() ||
+            (op.code == OP_STRUCT && DYNAMIC_DATA_CHILDREN(data).size() != op.count))
+    {
+        data->deserialize(cdr);
+        return;
+    }
+
+    switch (op.code)
+    {
+        case OP_INT16: cdr >> DYNAMIC_DATA_VALUE(data, int16_t, int16_value_); break;
+        case OP_UINT16: cdr >> DYNAMIC_DATA_VALUE(data, uint16_t, uint16_value_); break;
+        case OP_INT32: cdr >> DYNAMIC_DATA_VALUE(data, int32_t, int32_value_); break;
+        case OP_UINT32: cdr >> DYNAMIC_DATA_VALUE(data, uint32_t, uint32_value_); break;
+        case OP_INT64: cdr >> DYNAMIC_DATA_VALUE(data, int64_t, int64_value_); break;
+        case OP_UINT64: cdr >> DYNAMIC_DATA_VALUE(data, uint64_t, uint64_value_); break;
+        case OP_FLOAT32: cdr >> DYNAMIC_DATA_VALUE(data, float, float32_value_); break;
+        case OP_FLOAT64: cdr >> DYNAMIC_DATA_VALUE(data, double, float64_value_); break;
+        case OP_FLOAT128: cdr >> DYNAMIC_DATA_VALUE(data, long double, float128_value_); break;
+        case OP_CHAR8: cdr >> DYNAMIC_DATA_VALUE(data, char, char8_value_); break;
+        case OP_CHAR16: cdr >> DYNAMIC_DATA_VALUE(data, wchar_t, char16_value_); break;
+        case OP_BOOLEAN: cdr >> DYNAMIC_DATA_VALUE(data, bool, bool_value_); break;
+        case OP_BYTE: cdr >> DYNAMIC_DATA_VALUE(data, octet, byte_value_); break;
+        case OP_STRING8: cdr >> DYNAMIC_DATA_VALUE(data, std::string, string_value_); break;
+        case OP_STRING16: cdr >> DYNAMIC_DATA_VALUE(data, std::wstring, wstring_value_); break;
+        case OP_ENUM: cdr >> DYNAMIC_DATA_VALUE(data, uint32_t, uint32_value_); break;
+        case OP_STRUCT:
+        {
+            auto& children = DYNAMIC_DATA_CHILDREN(data);
+            auto it = children.begin();
+            for (uint32_t child = index + 1; child < op.end; child = ops[child].end)
+            {
+                while (it->first != ops[child].member_id)
+                {
+                    ++it;
+                }
+                deserialize(ops, child, static_cast<DynamicData*>(it->second), cdr);
+            }
+            break;
+        }
+        case OP_SEQUENCE:
+        {
+            // Like DynamicData, reuse the elements already there and create the missing ones.
+            auto& children = DYNAMIC_DATA_CHILDREN(data);
+            uint32_t size(0);
+            cdr >> size;
+            auto it = children.begin();
+            for (uint32_t idx = 0; idx < size; ++idx)
+            {
+                DynamicData* element = nullptr;
+                if (it != children.end() && it->first == idx)
+                {
+                    element = static_cast<DynamicData*>(it->second);
+                    ++it;
+                }
+                else
+                {
+                    element = DynamicDataFactory::get_instance()->create_data(data->type_->get_element_type());
+                    children.insert(it, std::make_pair(idx, element));
+                }
+                deserialize(ops, index + 1, element, cdr);
+                element->key_element_ = false;
+            }
+            break;
+        }
+        case OP_ARRAY:
+        {
+            // Like DynamicData, store only the elements which differ from the default value.
+            auto& children = DYNAMIC_DATA_CHILDREN(data);
+            DynamicData* input = nullptr;
+            auto it = children.begin();
+            for (uint32_t idx = 0; idx < op.count; ++idx)
+            {
+                if (it != children.end() && it->first == idx)
+                {
+                    deserialize(ops, index + 1, static_cast<DynamicData*>(it->second), cdr);
+                    ++it;
+                }
+                else
+                {
+                    if (input == nullptr)
+                    {
+                        input = DynamicDataFactory::get_instance()->create_data(data->type_->get_element_type());
+                    }
+
+                    deserialize(ops, index + 1, input, cdr);
+                    if (!input->equals(data->default_array_value_))
+                    {
+                        children.insert(it, std::make_pair(idx, input));
+                        input = nullptr;
+                    }
+                }
+            }
+            if (input != nullptr)
+            {
+                DynamicDataFactory::get_instance()->delete_data(input);
+            }
+            break;
+        }
+        case OP_SKIP:
+            break;
+        case OP_LEGACY:
+        case OP_KEY_LEGACY:
+        case OP_KEY_STRUCT:
+            data->deserialize(cdr);
+            break;
+    }
+}
+
+// Returns the alignment after the operation, like empty_serialized_size.
+size_t DynamicTypeSerializationPlan::serialized_size(
+        const OpList& ops,
+        uint32_t index,
+        const DynamicData* data,
+        size_t current_alignment)
+{
+    const Op& op = ops[index];
+    if (data->type_.get() != op.type.get() ||
+            (op.code == OP_STRUCT && DYNAMIC_DATA_CHILDREN(data).size() != op.count))
+    {
+        return current_alignment + DynamicData::getCdrSerializedSize(data, current_alignment);
+    }
+
+    switch (op.code)
+    {
+        case OP_STRING8:
+        {
+            // string content (length + characters + 1)
+            return current_alignment + 4 + Cdr::alignment(current_alignment, 4) +
+                   DYNAMIC_DATA_VALUE(data, std::string, string_value_).length() + 1;
+        }
+        case OP_STRING16:
+        {
+            // string content (length + (characters * 4) )
+            return current_alignment + 4 + Cdr::alignment(current_alignment, 4) +
+                   DYNAMIC_DATA_VALUE(data, std::wstring, wstring_value_).length() * 4;
+        }
+        case OP_STRUCT:
+        {
+            const auto& children = DYNAMIC_DATA_CHILDREN(data);
+            auto it = children.begin();
+            for (uint32_t child = index + 1; child < op.end; child = ops[child].end)
+            {
+                while (it->first != ops[child].member_id)
+                {
+                    ++it;
+                }
+                current_alignment = serialized_size(ops, child, static_cast<const DynamicData*>(it->second),
+                                current_alignment);
+            }
+            return current_alignment;
+        }
+        case OP_SEQUENCE:
+        {
+            // Elements count
+            current_alignment += 4 + Cdr::alignment(current_alignment, 4);
+            const auto& children = DYNAMIC_DATA_CHILDREN(data);
+            for (auto it = children.begin(); it != children.end(); ++it)
+            {
+                current_alignment = serialized_size(ops, index + 1, static_cast<const DynamicData*>(it->second),
+                                current_alignment);
+            }
+            return current_alignment;
+        }
+        case OP_ARRAY:
+        {
+            const auto& children = DYNAMIC_DATA_CHILDREN(data);
+            auto it = children.begin();
+            for (uint32_t idx = 0; idx < op.count; ++idx)
+            {
+                if (it != children.end() && it->first == idx)
+                {
+                    current_alignment = serialized_size(ops, index + 1, static_cast<const DynamicData*>(it->second),
+                                    current_alignment);
+                    ++it;
+                }
+                else
+                {
+                    current_alignment = empty_serialized_size(ops, index + 1, current_alignment);
+                }
+            }
+            return current_alignment;
+        }
+        case OP_LEGACY:
+        case OP_KEY_LEGACY:
+        case OP_KEY_STRUCT:
+            return current_alignment + DynamicData::getCdrSerializedSize(data, current_alignment);
+        default:
+            return empty_serialized_size(ops, index, current_alignment);
+    }
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,198 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DynamicTypeSerializationPlan.hpp
+ */
+
+#ifndef TYPES_DYNAMIC_TYPE_SERIALIZATION_PLAN_HPP
+#define TYPES_DYNAMIC_TYPE_SERIALIZATION_PLAN_HPP
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastrtps {
+namespace types {
+
+class DynamicData;
+
+/**
+ * Serialization steps of a DynamicType, resolved once when the type is registered.
+ *
+ * The type tree is flattened in preorder into a list of operations, so serializing a DynamicData no longer asks
+ * its type for the kind, annotations and member descriptors of every node it visits. Kinds without a dedicated
+ * operation (unions, maps, bitmasks, bitsets and derived structures) are handed over to DynamicData itself, as are
+ * the nodes whose data was not created from the compiled type.
+ * The plan is immutable once built and can be shared by several threads.
+ * @ingroup DYNAMIC_TYPES_MODULE
+ */
+class DynamicTypeSerializationPlan
+{
+public:
+
+    /**
+     * Compiles the plans to serialize the data and the key of a type.
+     * @param type Type the plan is built for.
+     */
+    explicit DynamicTypeSerializationPlan(
+            const DynamicType_ptr& type);
+
+    //! Serializes the data like DynamicData::serialize.
+    void serialize(
+            const DynamicData* data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Deserializes the data like DynamicData::deserialize.
+    void deserialize(
+            DynamicData* data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Serializes the key of the data like DynamicData::serializeKey.
+    void serialize_key(
+            const DynamicData* data,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Returns the CDR serialized size of the data, without encapsulation.
+    size_t serialized_size(
+            const DynamicData* data) const;
+
+    //! Returns the maximum CDR serialized size of the key of the type.
+    size_t key_max_serialized_size() const
+    {
+        return key_max_size_;
+    }
+
+private:
+
+    enum OpCode : uint8_t
+    {
+        OP_INT16,
+        OP_UINT16,
+        OP_INT32,
+        OP_UINT32,
+        OP_INT64,
+        OP_UINT64,
+        OP_FLOAT32,
+        OP_FLOAT64,
+        OP_FLOAT128,
+        OP_CHAR8,
+        OP_CHAR16,
+        OP_BOOLEAN,
+        OP_BYTE,
+        OP_STRING8,
+        OP_STRING16,
+        OP_ENUM,
+        //! Structure whose members are the following operations, up to end.
+        OP_STRUCT,
+        //! Structure visited only for its key members.
+        OP_KEY_STRUCT,
+        //! Sequence whose element is the next operation.
+        OP_SEQUENCE,
+        //! Array whose element is the next operation.
+        OP_ARRAY,
+        //! Non serialized type.
+        OP_SKIP,
+        //! Delegates to DynamicData.
+        OP_LEGACY,
+        //! Delegates the key to DynamicData.
+        OP_KEY_LEGACY
+    };
+
+    struct Op
+    {
+        OpCode code;
+        //! Id of the member inside the parent structure.
+        MemberId member_id;
+        //! Number of members of a structure, or total bounds of an array.
+        uint32_t count;
+        //! Index of the operation after the subtree of this one.
+        uint32_t end;
+        //! Type the data must have to be handled by this operation.
+        DynamicType_ptr type;
+    };
+
+    using OpList = std::vector<Op>;
+
+    static DynamicType_ptr resolve(
+            DynamicType_ptr type);
+
+    static bool has_indexed_members(
+            const DynamicType_ptr& type);
+
+    static void compile(
+            OpList& ops,
+            const DynamicType_ptr& type,
+            MemberId member_id);
+
+    static void compile_key(
+            OpList& ops,
+            const DynamicType_ptr& type,
+            MemberId member_id);
+
+    static bool is_fixed(
+            const OpList& ops,
+            uint32_t index);
+
+    static size_t empty_serialized_size(
+            const OpList& ops,
+            uint32_t index,
+            size_t current_alignment);
+
+    static void serialize_empty(
+            const OpList& ops,
+            uint32_t index,
+            const DynamicData* data,
+            eprosima::fastcdr::Cdr& cdr);
+
+    static void serialize(
+            const OpList& ops,
+            uint32_t index,
+            const DynamicData* data,
+            eprosima::fastcdr::Cdr& cdr);
+
+    static void deserialize(
+            const OpList& ops,
+            uint32_t index,
+            DynamicData* data,
+            eprosima::fastcdr::Cdr& cdr);
+
+    static size_t serialized_size(
+            const OpList& ops,
+            uint32_t index,
+            const DynamicData* data,
+            size_t current_alignment);
+
+    OpList ops_;
+
+    OpList key_ops_;
+
+    //! Serialized size of the data when it does not depend on the values, zero otherwise.
+    size_t fixed_size_;
+
+    size_t key_max_size_;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_DYNAMIC_TYPE_SERIALIZATION_PLAN_HPP
@@ -0,0 +1,34 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Entity.cpp
+ *
+ */
+
+#include <fastdds/dds/core/Entity.hpp>
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+StatusMask Entity::get_status_changes() const
+{
+    return status_condition_.get_impl()->get_raised_statuses();
+}
+
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
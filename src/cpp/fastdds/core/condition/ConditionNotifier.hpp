@@ -0,0 +1,80 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConditionNotifier.hpp
+ */
+
+#ifndef _FASTDDS_CORE_CONDITION_CONDITIONNOTIFIER_HPP_
+#define _FASTDDS_CORE_CONDITION_CONDITIONNOTIFIER_HPP_
+
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class Condition;
+
+namespace detail {
+
+struct WaitSetImpl;
+
+/**
+ * Keeps the list of WaitSets a Condition is attached to, and wakes them up when the Condition triggers.
+ *
+ * Lock order is ConditionNotifier before WaitSetImpl. WaitSetImpl never calls a notifier while holding its own mutex.
+ */
+struct ConditionNotifier
+{
+    /**
+     * Adds a WaitSet to the list of WaitSets to be woken up.
+     * @param wait_set The WaitSet being attached.
+     */
+    void attach_to(
+            WaitSetImpl* wait_set);
+
+    /**
+     * Removes a WaitSet from the list of WaitSets to be woken up.
+     * @param wait_set The WaitSet being detached.
+     */
+    void detach_from(
+            WaitSetImpl* wait_set);
+
+    /**
+     * Wakes up all the attached WaitSets.
+     * Should be called when the trigger value of the owning Condition changes to true.
+     */
+    void notify();
+
+    /**
+     * Detaches the owning Condition from all the attached WaitSets.
+     * @param condition The Condition being destroyed.
+     */
+    void will_be_deleted(
+            const Condition& condition);
+
+private:
+
+    std::mutex mutex_;
+    std::vector<WaitSetImpl*> entries_;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_CORE_CONDITION_CONDITIONNOTIFIER_HPP_
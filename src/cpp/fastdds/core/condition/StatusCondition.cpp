@@ -18,6 +18,8 @@
  */
 
 #include <fastdds/dds/core/condition/StatusCondition.hpp>
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
 #include <fastrtps/types/TypesBase.h>
 
 namespace eprosima {
@@ -26,23 +28,38 @@ namespace dds {
 
 using eprosima::fastrtps::types::ReturnCode_t;
 
+StatusCondition::StatusCondition(
+        Entity* parent)
+    : Condition()
+    , impl_(new detail::StatusConditionImpl(get_notifier().get()))
+    , entity_(parent)
+{
+}
+
+StatusCondition::~StatusCondition()
+{
+    notifier_->will_be_deleted(*this);
+}
+
+bool StatusCondition::get_trigger_value() const
+{
+    return impl_->get_trigger_value();
+}
+
 ReturnCode_t StatusCondition::set_enabled_statuses(
         const StatusMask& mask)
 {
-    static_cast<void>(mask);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->set_enabled_statuses(mask);
 }
 
-const StatusMask& StatusCondition::get_enabled_statuses() const
+StatusMask StatusCondition::get_enabled_statuses() const
 {
-    logWarning(CONDITION, "get_enabled_statuses public member function not implemented");
-    return status_mask;
+    return impl_->get_enabled_statuses();
 }
 
 Entity* StatusCondition::get_entity() const
 {
-    logWarning(CONDITION, "get_entity public member function not implemented");
-    return nullptr;
+    return entity_;
 }
 
 }  // namespace dds
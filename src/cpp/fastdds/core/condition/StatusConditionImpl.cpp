@@ -0,0 +1,92 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatusConditionImpl.cpp
+ */
+
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+StatusConditionImpl::StatusConditionImpl(
+        ConditionNotifier* notifier)
+    : trigger_value_(false)
+    , mask_(StatusMask::all())
+    , status_(StatusMask::none())
+    , notifier_(notifier)
+{
+}
+
+ReturnCode_t StatusConditionImpl::set_enabled_statuses(
+        const StatusMask& mask)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    mask_ = mask;
+    update_trigger_value(lock);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+StatusMask StatusConditionImpl::get_enabled_statuses() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return mask_;
+}
+
+StatusMask StatusConditionImpl::get_raised_statuses() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return status_;
+}
+
+void StatusConditionImpl::set_status(
+        const StatusMask& status,
+        bool trigger_value)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (trigger_value)
+    {
+        status_ |= status;
+    }
+    else
+    {
+        status_ &= ~status;
+    }
+    update_trigger_value(lock);
+}
+
+void StatusConditionImpl::update_trigger_value(
+        std::unique_lock<std::mutex>& lock)
+{
+    bool new_trigger = (mask_ & status_).any();
+    bool old_trigger = trigger_value_.exchange(new_trigger);
+
+    // WaitSets should be woken up without holding mutex_
+    lock.unlock();
+    if (new_trigger && !old_trigger)
+    {
+        notifier_->notify();
+    }
+}
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,107 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatusConditionImpl.hpp
+ */
+
+#ifndef _FASTDDS_CORE_CONDITION_STATUSCONDITIONIMPL_HPP_
+#define _FASTDDS_CORE_CONDITION_STATUSCONDITIONIMPL_HPP_
+
+#include <atomic>
+#include <mutex>
+
+#include <fastdds/dds/core/status/StatusMask.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+struct ConditionNotifier;
+
+/**
+ * Keeps the statuses of an Entity that have changed since the application last read them.
+ *
+ * The trigger value is updated every time a status is raised or cleared, so reading it is a single atomic load.
+ */
+struct StatusConditionImpl
+{
+    using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+
+    /**
+     * Construct a StatusConditionImpl object.
+     * @param notifier The notifier of the StatusCondition owning this object.
+     */
+    StatusConditionImpl(
+            ConditionNotifier* notifier);
+
+    /**
+     * @brief Retrieves the trigger_value of the StatusCondition
+     * @return true if any of the enabled statuses has been raised
+     */
+    bool get_trigger_value() const
+    {
+        return trigger_value_.load();
+    }
+
+    /**
+     * @brief Defines the list of communication statuses that are taken into account to determine the trigger_value
+     * @param mask defines the mask for the status
+     * @return RETCODE_OK
+     */
+    ReturnCode_t set_enabled_statuses(
+            const StatusMask& mask);
+
+    /**
+     * @brief Retrieves the list of communication statuses that are taken into account to determine the trigger_value
+     * @return Status set or default status if it has not been set
+     */
+    StatusMask get_enabled_statuses() const;
+
+    /**
+     * @brief Retrieves the list of communication statuses that have changed since they were last read
+     * @return Triggered status
+     */
+    StatusMask get_raised_statuses() const;
+
+    /**
+     * @brief Raises or clears some statuses of the associated Entity
+     * @param status The statuses being updated
+     * @param trigger_value Whether the statuses should be raised or cleared
+     */
+    void set_status(
+            const StatusMask& status,
+            bool trigger_value);
+
+private:
+
+    //! Updates trigger_value_, notifying the attached WaitSets when it turns true. mutex_ should be locked.
+    void update_trigger_value(
+            std::unique_lock<std::mutex>& lock);
+
+    mutable std::mutex mutex_;
+    std::atomic<bool> trigger_value_;
+    StatusMask mask_;
+    StatusMask status_;
+    ConditionNotifier* notifier_;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_CORE_CONDITION_STATUSCONDITIONIMPL_HPP_
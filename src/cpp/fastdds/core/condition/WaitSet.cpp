@@ -18,6 +18,7 @@
  */
 
 #include <fastdds/dds/core/condition/WaitSet.hpp>
+#include <fastdds/core/condition/WaitSetImpl.hpp>
 #include <fastrtps/types/TypesBase.h>
 
 namespace eprosima {
@@ -26,34 +27,38 @@ namespace dds {
 
 using eprosima::fastrtps::types::ReturnCode_t;
 
+WaitSet::WaitSet()
+    : impl_(new detail::WaitSetImpl())
+{
+}
+
+WaitSet::~WaitSet()
+{
+}
+
 ReturnCode_t WaitSet::attach_condition(
         const Condition& cond)
 {
-    static_cast<void>(cond);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->attach_condition(cond);
 }
 
 ReturnCode_t WaitSet::detach_condition(
         const Condition& cond)
 {
-    static_cast<void>(cond);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->detach_condition(cond);
 }
 
 ReturnCode_t WaitSet::wait(
         ConditionSeq& active_conditions,
         const fastrtps::Duration_t timeout) const
 {
-    static_cast<void>(active_conditions);
-    static_cast<void>(timeout);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->wait(active_conditions, timeout);
 }
 
 ReturnCode_t WaitSet::get_conditions(
         ConditionSeq& attached_conditions) const
 {
-    static_cast<void>(attached_conditions);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->get_conditions(attached_conditions);
 }
 
 }  // namespace dds
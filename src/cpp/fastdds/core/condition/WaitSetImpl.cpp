@@ -0,0 +1,194 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetImpl.cpp
+ */
+
+#include <fastdds/core/condition/WaitSetImpl.hpp>
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+WaitSetImpl::~WaitSetImpl()
+{
+    // Notifiers should not be called with mutex_ taken. A condition may be deleted once mutex_ is released, so its
+    // notifier is kept alive here. The destructor does not return while that notifier may still call this object.
+    std::vector<std::shared_ptr<ConditionNotifier>> notifiers;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (const Condition* condition : entries_)
+        {
+            notifiers.push_back(condition->get_notifier());
+        }
+        entries_.clear();
+    }
+
+    for (const std::shared_ptr<ConditionNotifier>& notifier : notifiers)
+    {
+        notifier->detach_from(this);
+    }
+}
+
+ReturnCode_t WaitSetImpl::attach_condition(
+        const Condition& condition)
+{
+    // Attach first to the notifier, so a trigger happening right after the condition is added to entries_ is not lost
+    condition.get_notifier()->attach_to(this);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (std::find(entries_.begin(), entries_.end(), &condition) == entries_.end())
+    {
+        entries_.push_back(&condition);
+
+        // A waiting thread should evaluate the new condition
+        if (is_waiting_ && condition.get_trigger_value())
+        {
+            woken_up_ = true;
+            cond_.notify_one();
+        }
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t WaitSetImpl::detach_condition(
+        const Condition& condition)
+{
+    bool was_attached = false;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = std::find(entries_.begin(), entries_.end(), &condition);
+        if (it != entries_.end())
+        {
+            entries_.erase(it);
+            was_attached = true;
+        }
+    }
+
+    if (!was_attached)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    condition.get_notifier()->detach_from(this);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t WaitSetImpl::wait(
+        ConditionSeq& active_conditions,
+        const fastrtps::Duration_t& timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (is_waiting_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    auto is_woken_up = [this]()
+            {
+                return woken_up_;
+            };
+
+    bool infinite = (fastrtps::c_TimeInfinite == timeout);
+    auto max_blocking_time_point = std::chrono::steady_clock::now();
+    if (!infinite)
+    {
+        max_blocking_time_point += std::chrono::nanoseconds(timeout.to_ns());
+    }
+
+    is_waiting_ = true;
+    woken_up_ = false;
+
+    bool triggered = collect_active_conditions(active_conditions);
+    while (!triggered)
+    {
+        if (infinite)
+        {
+            cond_.wait(lock, is_woken_up);
+        }
+        else if (!cond_.wait_until(lock, max_blocking_time_point, is_woken_up))
+        {
+            break;
+        }
+
+        woken_up_ = false;
+        triggered = collect_active_conditions(active_conditions);
+    }
+
+    is_waiting_ = false;
+
+    return triggered ? ReturnCode_t::RETCODE_OK : ReturnCode_t::RETCODE_TIMEOUT;
+}
+
+ReturnCode_t WaitSetImpl::get_conditions(
+        ConditionSeq& attached_conditions) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    attached_conditions.clear();
+    for (const Condition* condition : entries_)
+    {
+        attached_conditions.push_back(const_cast<Condition*>(condition));
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+void WaitSetImpl::wake_up()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (is_waiting_)
+    {
+        woken_up_ = true;
+        cond_.notify_one();
+    }
+}
+
+void WaitSetImpl::will_be_deleted(
+        const Condition& condition)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = std::find(entries_.begin(), entries_.end(), &condition);
+    if (it != entries_.end())
+    {
+        entries_.erase(it);
+    }
+}
+
+bool WaitSetImpl::collect_active_conditions(
+        ConditionSeq& active_conditions) const
+{
+    active_conditions.clear();
+    for (const Condition* condition : entries_)
+    {
+        if (condition->get_trigger_value())
+        {
+            active_conditions.push_back(const_cast<Condition*>(condition));
+        }
+    }
+    return !active_conditions.empty();
+}
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,122 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WaitSetImpl.hpp
+ */
+
+#ifndef _FASTDDS_CORE_CONDITION_WAITSETIMPL_HPP_
+#define _FASTDDS_CORE_CONDITION_WAITSETIMPL_HPP_
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/dds/core/condition/Condition.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastrtps/types/TypesBase.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Implementation of a WaitSet.
+ *
+ * The waiting thread sleeps on a condition variable, and is only woken up when an attached condition notifies that
+ * its trigger value has become true. The trigger values of the attached conditions are only evaluated when entering
+ * wait() and after each wake up, so no polling is performed.
+ */
+struct WaitSetImpl
+{
+    using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+
+    ~WaitSetImpl();
+
+    /**
+     * @brief Attach a condition to this WaitSet.
+     * @param condition The Condition to attach.
+     * @return RETCODE_OK
+     */
+    ReturnCode_t attach_condition(
+            const Condition& condition);
+
+    /**
+     * @brief Detach a condition from this WaitSet.
+     * @param condition The Condition to detach.
+     * @return RETCODE_OK if the condition was attached, RETCODE_PRECONDITION_NOT_MET otherwise.
+     */
+    ReturnCode_t detach_condition(
+            const Condition& condition);
+
+    /**
+     * @brief Wait for any of the attached conditions to be triggered.
+     *
+     * No memory is allocated when @c active_conditions already has enough capacity to hold all the triggered
+     * conditions, so reusing the same collection across calls keeps this method allocation free.
+     *
+     * @param[out] active_conditions Reference to the collection of conditions whose trigger_value are true.
+     * @param timeout Maximum time of the wait.
+     * @return RETCODE_OK if some conditions were triggered, RETCODE_PRECONDITION_NOT_MET if another thread is
+     * already waiting, RETCODE_TIMEOUT if the timeout expired.
+     */
+    ReturnCode_t wait(
+            ConditionSeq& active_conditions,
+            const fastrtps::Duration_t& timeout);
+
+    /**
+     * @brief Retrieve the list of attached conditions.
+     * @param[out] attached_conditions Reference to the collection of attached conditions.
+     * @return RETCODE_OK
+     */
+    ReturnCode_t get_conditions(
+            ConditionSeq& attached_conditions) const;
+
+    /**
+     * @brief Wake up this WaitSet so the trigger values of its conditions are evaluated.
+     * Called by the notifier of an attached condition.
+     */
+    void wake_up();
+
+    /**
+     * @brief Called from the destructor of an attached condition.
+     * @param condition The Condition being destroyed.
+     */
+    void will_be_deleted(
+            const Condition& condition);
+
+private:
+
+    /**
+     * Fills active_conditions with the attached conditions whose trigger value is true.
+     * mutex_ should be locked by the caller.
+     * @return Whether some condition has been triggered.
+     */
+    bool collect_active_conditions(
+            ConditionSeq& active_conditions) const;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::vector<const Condition*> entries_;
+    bool is_waiting_ = false;
+    bool woken_up_ = false;
+};
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_CORE_CONDITION_WAITSETIMPL_HPP_
@@ -21,8 +21,11 @@
 #define FASTDDS_CORE_POLICY__PARAMETERSERIALIZER_HPP_
 
 #include "ParameterList.hpp"
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.h>
 
+#include <limits>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -707,6 +710,92 @@ inline bool ParameterSerializer<ParameterSampleIdentity_t>::read_content_from_cd
     return valid;
 }
 
+template<>
+class ParameterSerializer<fastrtps::rtps::ContentFilterProperty>
+{
+public:
+
+    static uint32_t cdr_serialized_size(
+            const fastrtps::rtps::ContentFilterProperty& property)
+    {
+        // p_id + p_length
+        uint32_t ret_val = 2 + 2;
+        ret_val += string_serialized_size(property.content_filtered_topic_name);
+        ret_val += string_serialized_size(property.related_topic_name);
+        ret_val += string_serialized_size(property.filter_class_name);
+        ret_val += string_serialized_size(property.filter_expression);
+        // n_parameters
+        ret_val += 4;
+        for (const std::string& param : property.expression_parameters)
+        {
+            ret_val += string_serialized_size(param);
+        }
+        return ret_val;
+    }
+
+    static bool add_to_cdr_message(
+            const fastrtps::rtps::ContentFilterProperty& property,
+            fastrtps::rtps::CDRMessage_t* cdr_message)
+    {
+        uint32_t length = cdr_serialized_size(property) - 4;
+        if (length > std::numeric_limits<uint16_t>::max())
+        {
+            return false;
+        }
+
+        bool valid = fastrtps::rtps::CDRMessage::addUInt16(cdr_message, PID_CONTENT_FILTER_PROPERTY);
+        valid &= fastrtps::rtps::CDRMessage::addUInt16(cdr_message, static_cast<uint16_t>(length));
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, property.content_filtered_topic_name);
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, property.related_topic_name);
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, property.filter_class_name);
+        valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, property.filter_expression);
+        valid &= fastrtps::rtps::CDRMessage::addUInt32(cdr_message,
+                        static_cast<uint32_t>(property.expression_parameters.size()));
+        for (const std::string& param : property.expression_parameters)
+        {
+            valid &= fastrtps::rtps::CDRMessage::add_string(cdr_message, param);
+        }
+        return valid;
+    }
+
+    static bool read_from_cdr_message(
+            fastrtps::rtps::ContentFilterProperty& property,
+            fastrtps::rtps::CDRMessage_t* cdr_message,
+            const uint16_t parameter_length)
+    {
+        uint32_t pos_ref = cdr_message->pos;
+        uint32_t num_parameters = 0;
+        bool valid = fastrtps::rtps::CDRMessage::readString(cdr_message, &property.content_filtered_topic_name);
+        valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &property.related_topic_name);
+        valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &property.filter_class_name);
+        valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &property.filter_expression);
+        valid &= fastrtps::rtps::CDRMessage::readUInt32(cdr_message, &num_parameters);
+        // Each parameter takes at least 4 bytes
+        if (!valid || num_parameters > parameter_length / 4u)
+        {
+            return false;
+        }
+
+        property.expression_parameters.resize(num_parameters);
+        for (std::string& param : property.expression_parameters)
+        {
+            valid &= fastrtps::rtps::CDRMessage::readString(cdr_message, &param);
+        }
+
+        return valid && (cdr_message->pos - pos_ref) == parameter_length;
+    }
+
+private:
+
+    static uint32_t string_serialized_size(
+            const std::string& str)
+    {
+        // str_len + str_data + null_char, aligned to 4
+        return 4 + ((static_cast<uint32_t>(str.size()) + 1 + 3) & ~3);
+    }
+
+};
+
 #if HAVE_SECURITY
 
 template<>
@@ -28,6 +28,7 @@
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 
 #include <fastdds/rtps/RTPSDomain.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
@@ -49,6 +50,8 @@
 
 #include <fastdds/publisher/PublisherImpl.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterCompiler.hpp>
 #include <fastdds/topic/TopicImpl.hpp>
 
 #include <rtps/RTPSDomainImpl.hpp>
@@ -221,6 +224,13 @@ DomainParticipantImpl::~DomainParticipantImpl()
     {
         std::lock_guard<std::mutex> lock(mtx_topics_);
 
+        // Filtered topics reference their related topics, so they are deleted first
+        for (auto topic_it = filtered_topics_.begin(); topic_it != filtered_topics_.end(); ++topic_it)
+        {
+            delete topic_it->second;
+        }
+        filtered_topics_.clear();
+
         for (auto topic_it = topics_.begin(); topic_it != topics_.end(); ++topic_it)
         {
             delete topic_it->second;
@@ -448,6 +458,85 @@ ReturnCode_t DomainParticipantImpl::delete_topic(
     return ReturnCode_t::RETCODE_ERROR;
 }
 
+ContentFilteredTopic* DomainParticipantImpl::create_contentfilteredtopic(
+        const std::string& name,
+        const Topic* related_topic,
+        const std::string& filter_expression,
+        const std::vector<std::string>& expression_parameters)
+{
+    if (related_topic == nullptr || participant_ != related_topic->get_participant())
+    {
+        logError(PARTICIPANT, "Related topic of ContentFilteredTopic " << name <<
+                " does not belong to this participant");
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_topics_);
+
+    //Check there is no TopicDescription with the same name
+    if (topics_.find(name) != topics_.end() || filtered_topics_.find(name) != filtered_topics_.end())
+    {
+        logError(PARTICIPANT, "Topic with name : " << name << " already exists");
+        return nullptr;
+    }
+
+    auto related_it = topics_.find(related_topic->get_name());
+    if (related_it == topics_.end() || related_it->second != related_topic->impl_)
+    {
+        logError(PARTICIPANT, "Related topic " << related_topic->get_name() << " not found");
+        return nullptr;
+    }
+
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> filter;
+    ReturnCode_t ret = DDSSQLFilter::DDSFilterCompiler::compile(filter_expression, expression_parameters,
+                    related_it->second->get_type().get(), filter);
+    if (!ret)
+    {
+        logError(PARTICIPANT, "Could not compile filter expression of ContentFilteredTopic " << name);
+        return nullptr;
+    }
+
+    Topic* topic = related_it->second->user_topic_;
+    ContentFilteredTopicImpl* topic_impl = new ContentFilteredTopicImpl(this, topic, filter_expression,
+                    expression_parameters, std::move(filter));
+    ContentFilteredTopic* filtered_topic = new ContentFilteredTopic(name, topic, topic_impl);
+    topic_impl->user_topic_ = filtered_topic;
+
+    filtered_topics_[name] = topic_impl;
+
+    return filtered_topic;
+}
+
+ReturnCode_t DomainParticipantImpl::delete_contentfilteredtopic(
+        const ContentFilteredTopic* topic)
+{
+    if (topic == nullptr)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    if (participant_ != topic->get_participant())
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_topics_);
+    auto it = filtered_topics_.find(topic->get_name());
+
+    if (it != filtered_topics_.end())
+    {
+        if (it->second->is_referenced())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+        delete it->second;
+        filtered_topics_.erase(it);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    return ReturnCode_t::RETCODE_ERROR;
+}
+
 const InstanceHandle_t& DomainParticipantImpl::get_instance_handle() const
 {
     return static_cast<const InstanceHandle_t&>(guid_);
@@ -1003,6 +1092,13 @@ TopicDescription* DomainParticipantImpl::lookup_topicdescription(
         return it->second->user_topic_;
     }
 
+    auto filtered_it = filtered_topics_.find(topic_name);
+
+    if (filtered_it != filtered_topics_.end())
+    {
+        return filtered_it->second->user_topic_;
+    }
+
     return nullptr;
 }
 
@@ -1715,6 +1811,10 @@ bool DomainParticipantImpl::has_active_entities()
     {
         return true;
     }
+    if (!filtered_topics_.empty())
+    {
+        return true;
+    }
     return false;
 }
 
@@ -12,9 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <iomanip>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/dds/log/OStreamConsumer.hpp>
@@ -28,6 +32,300 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+namespace {
+
+// Bytes of the ring where each thread queues its records. Records not fitting fall back to Log::QueueLog.
+constexpr size_t record_ring_size = 64 * 1024;
+
+struct RecordHeader
+{
+    uint32_t size;
+    Log::CallSite* site;
+    std::chrono::system_clock::rep timestamp;
+};
+
+/**
+ * Single producer, single consumer ring of records.
+ * The owning thread pushes whole records, and the logging thread pops them.
+ */
+class RecordRing
+{
+public:
+
+    RecordRing()
+        : data_(new uint8_t[record_ring_size])
+    {
+    }
+
+    bool push(
+            const uint8_t* record,
+            size_t size)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        if (record_ring_size - (head - tail) < size)
+        {
+            return false;
+        }
+
+        copy_in(head, record, size);
+        head_.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(
+            std::vector<uint8_t>& record)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t head = head_.load(std::memory_order_acquire);
+        if (head == tail)
+        {
+            return false;
+        }
+
+        uint32_t size;
+        copy_out(tail, reinterpret_cast<uint8_t*>(&size), sizeof(size));
+        record.resize(size);
+        copy_out(tail, record.data(), size);
+        tail_.store(tail + size, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+
+    void copy_in(
+            size_t pos,
+            const uint8_t* src,
+            size_t size)
+    {
+        size_t offset = pos % record_ring_size;
+        size_t first = (std::min)(size, record_ring_size - offset);
+        memcpy(&data_[offset], src, first);
+        memcpy(&data_[0], src + first, size - first);
+    }
+
+    void copy_out(
+            size_t pos,
+            uint8_t* dst,
+            size_t size) const
+    {
+        size_t offset = pos % record_ring_size;
+        size_t first = (std::min)(size, record_ring_size - offset);
+        memcpy(dst, &data_[offset], first);
+        memcpy(dst + first, &data_[0], size - first);
+    }
+
+    std::unique_ptr<uint8_t[]> data_;
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+};
+
+struct RecordResources
+{
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<RecordRing>> rings;
+
+    // Whether records were queued since the logging thread last looked at the rings.
+    std::atomic<bool> pending{false};
+    // Records popped from the rings but not consumed yet.
+    std::atomic<uint32_t> held{0};
+
+    // Guarded by the configuration mutex of Log.
+    std::unordered_map<std::string, uint32_t> category_ids;
+    std::vector<std::string> category_names;
+    std::vector<bool> category_mask;
+    uint32_t filter_generation = 1;
+};
+
+// Defined before Log::resources_, so it outlives the logging thread.
+RecordResources records_;
+
+struct ThreadRecords
+{
+    // Buffers of the records being built. There is more than one when an argument logs while being formatted.
+    std::vector<std::unique_ptr<std::vector<uint8_t>>> buffers;
+    size_t depth = 0;
+    std::shared_ptr<RecordRing> ring;
+    // Stream where arguments of other types are formatted, and its Log::Record::TextBuffer
+    std::unique_ptr<std::streambuf> text;
+    std::unique_ptr<std::ostream> stream;
+
+    std::vector<uint8_t>& enter()
+    {
+        if (depth == buffers.size())
+        {
+            buffers.emplace_back(new std::vector<uint8_t>());
+        }
+        return *buffers[depth++];
+    }
+
+    RecordRing& get_ring()
+    {
+        if (!ring)
+        {
+            ring = std::make_shared<RecordRing>();
+            std::lock_guard<std::mutex> guard(records_.rings_mutex);
+            records_.rings.push_back(ring);
+        }
+        return *ring;
+    }
+
+};
+
+thread_local ThreadRecords thread_records_;
+
+void reset_stream(
+        std::ostringstream& stream)
+{
+    stream.str(std::string());
+    stream.clear();
+    stream.flags(std::ios_base::skipws | std::ios_base::dec);
+    stream.width(0);
+    stream.precision(6);
+    stream.fill(' ');
+}
+
+template<typename T>
+T read_argument(
+        const uint8_t* data,
+        size_t& pos)
+{
+    T value;
+    memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+void format_record(
+        const std::vector<uint8_t>& record,
+        std::ostringstream& stream,
+        std::string& message)
+{
+    reset_stream(stream);
+
+    const uint8_t* data = record.data();
+    size_t pos = sizeof(RecordHeader);
+    while (pos < record.size())
+    {
+        switch (data[pos++])
+        {
+            case Log::Record::arg_bool:
+                stream << (read_argument<uint8_t>(data, pos) != 0);
+                break;
+            case Log::Record::arg_char:
+                stream << read_argument<char>(data, pos);
+                break;
+            case Log::Record::arg_signed_char:
+                stream << read_argument<signed char>(data, pos);
+                break;
+            case Log::Record::arg_unsigned_char:
+                stream << read_argument<unsigned char>(data, pos);
+                break;
+            case Log::Record::arg_int:
+                stream << read_argument<int64_t>(data, pos);
+                break;
+            case Log::Record::arg_uint:
+                stream << read_argument<uint64_t>(data, pos);
+                break;
+            case Log::Record::arg_float:
+                stream << read_argument<float>(data, pos);
+                break;
+            case Log::Record::arg_double:
+                stream << read_argument<double>(data, pos);
+                break;
+            case Log::Record::arg_long_double:
+                stream << read_argument<long double>(data, pos);
+                break;
+            case Log::Record::arg_pointer:
+                stream << read_argument<const void*>(data, pos);
+                break;
+            case Log::Record::arg_string:
+            {
+                uint32_t length = read_argument<uint32_t>(data, pos);
+                stream.write(reinterpret_cast<const char*>(data + pos), length);
+                pos += length;
+                break;
+            }
+            case Log::Record::arg_ios_manipulator:
+                stream << read_argument<std::ios_base& (*)(std::ios_base&)>(data, pos);
+                break;
+            case Log::Record::arg_format:
+            {
+                Log::Record::FormatState state = read_argument<Log::Record::FormatState>(data, pos);
+                stream.flags(state.flags);
+                stream.width(state.width);
+                stream.precision(state.precision);
+                stream.fill(state.fill);
+                break;
+            }
+            default:
+                pos = record.size();
+                break;
+        }
+    }
+
+    message = stream.str();
+}
+
+void format_timestamp(
+        const std::chrono::system_clock::time_point& now,
+        std::string& timestamp)
+{
+    // Date and time are only formatted again when the second changes
+    thread_local std::time_t last_second = 0;
+    thread_local std::string last_prefix;
+
+    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
+    std::chrono::system_clock::duration tp = now.time_since_epoch();
+    tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
+    auto ms = static_cast<unsigned>(tp / std::chrono::milliseconds(1));
+
+    if (now_c != last_second || last_prefix.empty())
+    {
+        std::stringstream stream;
+#if defined(_WIN32)
+        struct tm timeinfo;
+        localtime_s(&timeinfo, &now_c);
+        stream << std::put_time(&timeinfo, "%F %T") << ".";
+        //#elif defined(__clang__) && !defined(std::put_time) // TODO arm64 doesn't seem to support std::put_time
+        //    (void)now_c;
+        //    (void)ms;
+#else
+        stream << std::put_time(localtime(&now_c), "%F %T") << ".";
+#endif // if defined(_WIN32)
+        last_prefix = stream.str();
+        last_second = now_c;
+    }
+
+    char millis[5] = {
+        static_cast<char>('0' + ms / 100), static_cast<char>('0' + (ms / 10) % 10), static_cast<char>('0' + ms % 10),
+        ' ', '\0'
+    };
+    timestamp = last_prefix;
+    timestamp += millis;
+}
+
+// Whether every record queued on the rings has been consumed.
+bool records_consumed()
+{
+    std::lock_guard<std::mutex> guard(records_.rings_mutex);
+    for (const auto& ring : records_.rings)
+    {
+        if (!ring->empty())
+        {
+            return false;
+        }
+    }
+    return records_.held == 0;
+}
+
+} // namespace
+
 struct Log::Resources Log::resources_;
 
 Log::Resources::Resources()
@@ -63,7 +361,7 @@ void Log::ClearConsumers()
     resources_.cv.wait(working,
             [&]()
             {
-                return resources_.logs.BothEmpty();
+                return resources_.logs.BothEmpty() && records_consumed();
             });
     std::unique_lock<std::mutex> guard(resources_.config_mutex);
     resources_.consumers.clear();
@@ -75,6 +373,8 @@ void Log::Reset()
     resources_.category_filter.reset();
     resources_.filename_filter.reset();
     resources_.error_string_filter.reset();
+    records_.category_mask.assign(records_.category_mask.size(), true);
+    ++records_.filter_generation;
     resources_.filenames = false;
     resources_.functions = true;
     resources_.verbosity = Log::Error;
@@ -104,7 +404,8 @@ void Log::Flush()
          Then, I must assure the new front queue content is consumed (second Run() loop).
      */
 
-    int last_loop = -1;
+    // A loop already running when Flush is called may have missed the latest entries
+    int last_loop = resources_.current_loop;
 
     for (int i = 0; i < 2; ++i)
     {
@@ -117,7 +418,8 @@ void Log::Flush()
                      */
                     return !resources_.logging ||
                     ( resources_.logs.Empty() &&
-                    ( last_loop != resources_.current_loop || resources_.logs.BothEmpty()));
+                    ( last_loop != resources_.current_loop ||
+                    (resources_.logs.BothEmpty() && records_consumed())));
                 });
 
         last_loop = resources_.current_loop;
@@ -155,6 +457,9 @@ void Log::run()
 
                 resources_.logs.Pop();
             }
+
+            records_.pending = false;
+            consume_records();
         }
         guard.lock();
 
@@ -228,6 +533,10 @@ void Log::KillThread()
 #endif // if !defined(_WIN32) || defined(FASTRTPS_STATIC_LINK) || _MSC_VER >= 1800
         resources_.logging_thread.reset();
     }
+
+    // Next record relaunches the thread
+    std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+    records_.pending = false;
 }
 
 void Log::QueueLog(
@@ -271,6 +580,10 @@ void Log::SetCategoryFilter(
 {
     std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
     resources_.category_filter.reset(new std::regex(filter));
+    for (size_t id = 0; id < records_.category_names.size(); ++id)
+    {
+        records_.category_mask[id] = regex_search(records_.category_names[id], filter);
+    }
 }
 
 void Log::SetFilenameFilter(
@@ -278,6 +591,7 @@ void Log::SetFilenameFilter(
 {
     std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
     resources_.filename_filter.reset(new std::regex(filter));
+    ++records_.filter_generation;
 }
 
 void Log::SetErrorStringFilter(
@@ -290,24 +604,203 @@ void Log::SetErrorStringFilter(
 void Log::get_timestamp(
         std::string& timestamp)
 {
-    std::stringstream stream;
-    auto now = std::chrono::system_clock::now();
-    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-    std::chrono::system_clock::duration tp = now.time_since_epoch();
-    tp -= std::chrono::duration_cast<std::chrono::seconds>(tp);
-    auto ms = static_cast<unsigned>(tp / std::chrono::milliseconds(1));
+    format_timestamp(std::chrono::system_clock::now(), timestamp);
+}
 
-#if defined(_WIN32)
-    struct tm timeinfo;
-    localtime_s(&timeinfo, &now_c);
-    stream << std::put_time(&timeinfo, "%F %T") << "." << std::setw(3) << std::setfill('0') << ms << " ";
-    //#elif defined(__clang__) && !defined(std::put_time) // TODO arm64 doesn't seem to support std::put_time
-    //    (void)now_c;
-    //    (void)ms;
-#else
-    stream << std::put_time(localtime(&now_c), "%F %T") << "." << std::setw(3) << std::setfill('0') << ms << " ";
-#endif // if defined(_WIN32)
-    timestamp = stream.str();
+void Log::consume_records()
+{
+    std::vector<std::shared_ptr<RecordRing>> rings;
+    {
+        std::lock_guard<std::mutex> guard(records_.rings_mutex);
+        // Rings of finished threads are dropped once empty
+        records_.rings.erase(std::remove_if(records_.rings.begin(), records_.rings.end(),
+                [](const std::shared_ptr<RecordRing>& ring)
+                {
+                    return ring.use_count() == 1 && ring->empty();
+                }), records_.rings.end());
+        rings = records_.rings;
+    }
+
+    std::vector<std::pair<std::chrono::system_clock::rep, Log::Entry>> entries;
+    std::vector<uint8_t> record;
+    std::ostringstream stream;
+    RecordHeader header;
+
+    for (const auto& ring : rings)
+    {
+        std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+        while (true)
+        {
+            ++records_.held;
+            if (!ring->pop(record))
+            {
+                --records_.held;
+                break;
+            }
+
+            memcpy(&header, record.data(), sizeof(header));
+            Log::CallSite& site = *header.site;
+
+            // Filters are evaluated once per category and call site, instead of once per entry
+            if (0 == site.category_id)
+            {
+                auto it = records_.category_ids.find(site.context.category);
+                if (it == records_.category_ids.end())
+                {
+                    records_.category_names.push_back(site.context.category);
+                    records_.category_mask.push_back(!resources_.category_filter ||
+                            regex_search(site.context.category, *resources_.category_filter));
+                    it = records_.category_ids.emplace(site.context.category,
+                                    static_cast<uint32_t>(records_.category_names.size())).first;
+                }
+                site.category_id = it->second;
+            }
+            if (site.filter_generation != records_.filter_generation)
+            {
+                site.filename_passes = !resources_.filename_filter ||
+                        regex_search(site.context.filename, *resources_.filename_filter);
+                site.filter_generation = records_.filter_generation;
+            }
+
+            if (!records_.category_mask[site.category_id - 1] || !site.filename_passes)
+            {
+                --records_.held;
+                continue;
+            }
+
+            Log::Entry entry{std::string(), site.context, site.kind, std::string()};
+
+            format_record(record, stream, entry.message);
+            if (resources_.error_string_filter && !regex_search(entry.message, *resources_.error_string_filter))
+            {
+                --records_.held;
+                continue;
+            }
+            if (!resources_.filenames)
+            {
+                entry.context.filename = nullptr;
+            }
+            if (!resources_.functions)
+            {
+                entry.context.function = nullptr;
+            }
+
+            entries.emplace_back(header.timestamp, std::move(entry));
+        }
+    }
+
+    // Entries of different threads are consumed in the order they were logged
+    std::stable_sort(entries.begin(), entries.end(),
+            [](const std::pair<std::chrono::system_clock::rep, Log::Entry>& a,
+            const std::pair<std::chrono::system_clock::rep, Log::Entry>& b)
+            {
+                return a.first < b.first;
+            });
+
+    for (auto& entry : entries)
+    {
+        format_timestamp(std::chrono::system_clock::time_point(std::chrono::system_clock::duration(entry.first)),
+                entry.second.timestamp);
+        std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+        for (auto& consumer : resources_.consumers)
+        {
+            consumer->Consume(entry.second);
+        }
+        --records_.held;
+    }
+}
+
+class Log::Record::TextBuffer : public std::streambuf
+{
+public:
+
+    Log::Record* record = nullptr;
+
+protected:
+
+    int_type overflow(
+            int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+            char text = traits_type::to_char_type(ch);
+            record->append_text(&text, 1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(
+            const char* text,
+            std::streamsize length) override
+    {
+        record->append_text(text, static_cast<size_t>(length));
+        return length;
+    }
+
+};
+
+Log::Record::Record(
+        CallSite& site)
+    : site_(site)
+    , buffer_(thread_records_.enter())
+    , text_length_pos_(0)
+    , stream_([]() -> std::ostream&
+            {
+                if (!thread_records_.stream)
+                {
+                    thread_records_.text.reset(new TextBuffer());
+                    thread_records_.stream.reset(new std::ostream(thread_records_.text.get()));
+                }
+                return *thread_records_.stream;
+            } ())
+{
+    TextBuffer* text = static_cast<TextBuffer*>(thread_records_.text.get());
+    previous_ = text->record;
+    text->record = this;
+
+    stream_.flags(std::ios_base::skipws | std::ios_base::dec);
+    stream_.width(0);
+    stream_.precision(6);
+    stream_.fill(' ');
+    buffer_.resize(sizeof(RecordHeader));
+}
+
+Log::Record::~Record()
+{
+    RecordHeader header;
+    header.size = static_cast<uint32_t>(buffer_.size());
+    header.site = &site_;
+    header.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+    memcpy(buffer_.data(), &header, sizeof(header));
+
+    if (thread_records_.get_ring().push(buffer_.data(), buffer_.size()))
+    {
+        // The logging thread is only woken up by the first record it has not been told about
+        if (!records_.pending.exchange(true))
+        {
+            {
+                std::unique_lock<std::mutex> guard(resources_.cv_mutex);
+                if (!resources_.logging && !resources_.logging_thread)
+                {
+                    resources_.logging = true;
+                    resources_.logging_thread.reset(new thread(Log::run));
+                }
+                resources_.work = true;
+            }
+            resources_.cv.notify_all();
+        }
+    }
+    else
+    {
+        // Ring full
+        std::ostringstream stream;
+        std::string message;
+        format_record(buffer_, stream, message);
+        QueueLog(message, site_.context, site_.kind);
+    }
+
+    static_cast<TextBuffer*>(thread_records_.text.get())->record = previous_;
+    --thread_records_.depth;
 }
 
 void LogConsumer::print_timestamp(
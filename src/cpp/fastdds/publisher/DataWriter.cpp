@@ -98,6 +98,13 @@ ReturnCode_t DataWriter::write(
     return impl_->write(data, handle);
 }
 
+ReturnCode_t DataWriter::write_many(
+        void* const* data,
+        size_t count)
+{
+    return impl_->write_many(data, count);
+}
+
 ReturnCode_t DataWriter::write_w_timestamp(
         void* data,
         const InstanceHandle_t& handle,
@@ -39,6 +39,7 @@
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
@@ -309,6 +310,20 @@ ReturnCode_t DataWriterImpl::enable()
                     },
                     qos_.lifespan().duration.to_ns() * 1e-6);
 
+    // Matched readers may ask for content filtering, which is done when checking the relevance of the changes
+    StatefulWriter* stateful_writer = dynamic_cast<StatefulWriter*>(writer_);
+    if (nullptr != stateful_writer)
+    {
+        reader_filters_.reset(new detail::ReaderFilterCollection(type_));
+        stateful_writer->reader_data_filter(reader_filters_.get());
+    }
+
+    // Samples are only handed to readers on this process without serializing them when no reader matched later may
+    // ask for them, and they are delivered before write returns
+    typed_delivery_ = !is_data_sharing_compatible_ &&
+            VOLATILE_DURABILITY_QOS == qos_.durability().kind &&
+            SYNCHRONOUS_PUBLISH_MODE == qos_.publish_mode().kind;
+
     // REGISTER THE WRITER
     WriterQos wqos = qos_.get_writerqos(get_publisher()->get_qos(), topic_->get_qos());
     if (!is_data_sharing_compatible_)
@@ -514,6 +529,60 @@ ReturnCode_t DataWriterImpl::write(
     return create_new_change_with_params(ALIVE, data, wparams, instance_handle);
 }
 
+ReturnCode_t DataWriterImpl::write_many(
+        void* const* data,
+        size_t count)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if (data == nullptr && count > 0)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    logInfo(DATA_WRITER, "Writing " << count << " new data");
+    ReturnCode_t ret_code = ReturnCode_t::RETCODE_OK;
+    writer_->begin_batch(max_blocking_time);
+    for (size_t i = 0; i < count && ReturnCode_t::RETCODE_OK == ret_code; ++i)
+    {
+        ret_code = check_new_change_preconditions(ALIVE, data[i]);
+        if (ReturnCode_t::RETCODE_OK == ret_code)
+        {
+            InstanceHandle_t handle;
+            if (type_->m_isGetKeyDefined)
+            {
+                bool is_key_protected = false;
+#if HAVE_SECURITY
+                is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+                type_->getKey(data[i], &handle, is_key_protected);
+            }
+
+            WriteParams wparams;
+            ret_code = perform_create_new_change_nts(ALIVE, data[i], wparams, handle, lock, max_blocking_time);
+        }
+    }
+    writer_->end_batch();
+
+    return ret_code;
+}
+
 InstanceHandle_t DataWriterImpl::register_instance(
         void* key)
 {
@@ -681,27 +750,56 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
+    return perform_create_new_change_nts(change_kind, data, wparams, handle, lock, max_blocking_time);
+}
+
+ReturnCode_t DataWriterImpl::perform_create_new_change_nts(
+        ChangeKind_t change_kind,
+        void* data,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
     PayloadInfo_t payload;
+    std::shared_ptr<void> typed_sample;
     bool was_loaned = check_and_remove_loan(data, payload);
     if (!was_loaned)
     {
-        if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload, max_blocking_time))
+        // When all the matched readers are on this process, they get a copy of the sample instead of a payload
+        if ((ALIVE == change_kind) && typed_delivery_ && writer_->has_only_local_readers())
         {
-            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+            typed_sample = copy_typed_sample(data);
         }
 
-        if ((ALIVE == change_kind) && !type_->serialize(data, &payload.payload))
+        if (!typed_sample)
         {
-            logWarning(RTPS_WRITER, "RTPSWriter:Serialization returns false");
-            return_payload_to_pool(payload);
-            return ReturnCode_t::RETCODE_ERROR;
+            if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload, max_blocking_time))
+            {
+                return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+            }
+
+            if ((ALIVE == change_kind) && !type_->serialize(data, &payload.payload))
+            {
+                logWarning(RTPS_WRITER, "RTPSWriter:Serialization returns false");
+                return_payload_to_pool(payload);
+                return ReturnCode_t::RETCODE_ERROR;
+            }
         }
     }
 
     CacheChange_t* ch = writer_->new_change(change_kind, handle);
     if (ch != nullptr)
     {
-        payload.move_into_change(*ch);
+        if (typed_sample)
+        {
+            ch->typed_sample = std::move(typed_sample);
+            ch->typed_sample_type = type_.get();
+        }
+        else
+        {
+            payload.move_into_change(*ch);
+        }
         set_fragment_size_on_change(wparams, ch, high_mark_for_frag_);
 
         if (!this->history_.add_pub_change(ch, wparams, lock, max_blocking_time))
@@ -750,6 +848,29 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
     return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
 }
 
+std::shared_ptr<void> DataWriterImpl::copy_typed_sample(
+        void* data)
+{
+    void* sample = type_->createData();
+    if (nullptr != sample && type_->copy_sample(data, sample))
+    {
+        // Changes may outlive this writer on the histories of the readers
+        TypeSupport type = type_;
+        return std::shared_ptr<void>(sample, [type](void* ptr)
+                       {
+                           type->deleteData(ptr);
+                       });
+    }
+
+    // Type does not support copying samples, so stop trying
+    if (nullptr != sample)
+    {
+        type_->deleteData(sample);
+    }
+    typed_delivery_ = false;
+    return nullptr;
+}
+
 ReturnCode_t DataWriterImpl::create_new_change_with_params(
         ChangeKind_t changeKind,
         void* data,
@@ -937,6 +1058,11 @@ void DataWriterImpl::InnerDataWriterListener::on_offered_incompatible_qos(
             listener->on_offered_incompatible_qos(data_writer_->user_datawriter_, callback_status);
         }
     }
+    else
+    {
+        data_writer_->user_datawriter_->get_statuscondition().get_impl()->set_status(
+            StatusMask::offered_incompatible_qos(), true);
+    }
 }
 
 void DataWriterImpl::InnerDataWriterListener::onWriterChangeReceivedByAll(
@@ -965,6 +1091,11 @@ void DataWriterImpl::InnerDataWriterListener::on_liveliness_lost(
         listener->on_liveliness_lost(
             data_writer_->user_datawriter_, status);
     }
+    else
+    {
+        data_writer_->user_datawriter_->get_statuscondition().get_impl()->set_status(
+            StatusMask::liveliness_lost(), true);
+    }
 }
 
 ReturnCode_t DataWriterImpl::wait_for_acknowledgments(
@@ -1015,6 +1146,7 @@ bool DataWriterImpl::deadline_missed()
     }
     publisher_->publisher_listener_.on_offered_deadline_missed(user_datawriter_, deadline_missed_status_);
     deadline_missed_status_.total_count_change = 0;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::offered_deadline_missed(), true);
 
     if (!history_.set_next_deadline(
                 timer_owner_,
@@ -1038,6 +1170,7 @@ ReturnCode_t DataWriterImpl::get_offered_deadline_missed_status(
 
     status = deadline_missed_status_;
     deadline_missed_status_.total_count_change = 0;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::offered_deadline_missed(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -1053,6 +1186,7 @@ ReturnCode_t DataWriterImpl::get_offered_incompatible_qos_status(
 
     status = offered_incompatible_qos_status_;
     offered_incompatible_qos_status_.total_count_change = 0u;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::offered_incompatible_qos(), false);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -1112,6 +1246,7 @@ ReturnCode_t DataWriterImpl::get_liveliness_lost_status(
     status.total_count_change = writer_->liveliness_lost_status_.total_count_change;
 
     writer_->liveliness_lost_status_.total_count_change = 0u;
+    user_datawriter_->get_statuscondition().get_impl()->set_status(StatusMask::liveliness_lost(), false);
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -1454,6 +1589,9 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         // Avoid calling the serialization size functors on PREALLOCATED mode
         fixed_payload_size_ = config.memory_policy == PREALLOCATED_MEMORY_MODE ? config.payload_initial_size : 0u;
 
+        // Backing of the preallocated payloads requested on the properties
+        config.payload_arena = PayloadArenaConfig::from_properties(qos_.properties());
+
         // Get payload pool reference and allocate space for our history
         if (is_data_sharing_compatible_)
         {
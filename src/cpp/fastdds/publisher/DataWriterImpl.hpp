@@ -40,6 +40,8 @@
 
 #include <fastrtps/types/TypesBase.h>
 
+#include <fastdds/publisher/DataWriterImpl/ReaderFilterCollection.hpp>
+
 #include <rtps/common/PayloadInfo_t.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
@@ -159,6 +161,16 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write several samples at once, adding all of them to the history under a single writer lock.
+     * @param data Array of pointers to the samples.
+     * @param count Number of samples on the array.
+     * @return RETCODE_OK if all the samples are written, or the error of the first one that could not be written.
+     */
+    ReturnCode_t write_many(
+            void* const* data,
+            size_t count);
+
     /*!
      * @brief Implementation of the DDS `register_instance` operation.
      * It deduces the instance's key and tries to get resources in the PublisherHistory.
@@ -341,6 +353,12 @@ protected:
 
     std::unique_ptr<LoanCollection> loans_;
 
+    //! Content filters of the matched readers, applied by stateful writers
+    std::unique_ptr<detail::ReaderFilterCollection> reader_filters_;
+
+    //! Whether samples may be handed to the readers on this process without serializing them
+    bool typed_delivery_ = false;
+
     /**
      *
      * @param kind
@@ -408,6 +426,27 @@ protected:
             fastrtps::rtps::WriteParams& wparams,
             const InstanceHandle_t& handle);
 
+    /**
+     * Same as perform_create_new_change, but with the writer mutex already taken.
+     * @param lock Lock held on the writer mutex. It may be released while waiting for space on the history.
+     * @param max_blocking_time Time point when waiting for resources should give up.
+     */
+    ReturnCode_t perform_create_new_change_nts(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Copy a sample to be handed to the readers on this process.
+     * @param data Pointer to the sample to copy.
+     * @return Shared copy of the sample, or nullptr when the type does not support copying samples.
+     */
+    std::shared_ptr<void> copy_typed_sample(
+            void* data);
+
     static fastrtps::TopicAttributes get_topic_attributes(
             const DataWriterQos& qos,
             const Topic& topic,
@@ -0,0 +1,173 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderFilterCollection.hpp
+ */
+
+#ifndef _FASTDDS_PUBLISHER_DATAWRITERIMPL_READERFILTERCOLLECTION_HPP_
+#define _FASTDDS_PUBLISHER_DATAWRITERIMPL_READERFILTERCOLLECTION_HPP_
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/writer/IReaderDataFilter.hpp>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterCompiler.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Content filters of the readers matched with a DataWriter.
+ *
+ * Readers announcing the same expression and parameters share a single compiled filter, and the result of the last
+ * evaluated change is kept on each filter, so a change is evaluated once per distinct filter regardless of the number
+ * of readers using it.
+ * Readers whose filter cannot be compiled for the type of the writer receive all the samples, and filter them locally.
+ */
+class ReaderFilterCollection : public fastdds::rtps::IReaderDataFilter
+{
+public:
+
+    explicit ReaderFilterCollection(
+            const TypeSupport& type)
+        : type_(type)
+    {
+    }
+
+    bool is_relevant(
+            const fastrtps::rtps::CacheChange_t& change,
+            const fastrtps::rtps::GUID_t& reader_guid) const override
+    {
+        // Samples handed to readers on the same process without a payload are filtered by the readers
+        if (fastrtps::rtps::ALIVE != change.kind || change.is_typed_only())
+        {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = readers_.find(reader_guid);
+        if (it == readers_.end())
+        {
+            return true;
+        }
+
+        ReaderFilter& filter = *it->second;
+        if (filter.last_sequence != change.sequenceNumber)
+        {
+            filter.last_result = filter.expression->evaluate(change.serializedPayload);
+            filter.last_sequence = change.sequenceNumber;
+        }
+        return filter.last_result;
+    }
+
+    void update_reader_filter(
+            const fastrtps::rtps::GUID_t& reader_guid,
+            const fastrtps::rtps::ContentFilterProperty* property) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        remove_reader(reader_guid);
+
+        if (nullptr == property || property->filter_expression.empty() ||
+                property->filter_class_name != fastrtps::rtps::ContentFilterProperty::DDSSQL_FILTER_CLASS)
+        {
+            return;
+        }
+
+        // Share the filter with other readers using the same expression and parameters
+        for (const std::shared_ptr<ReaderFilter>& filter : filters_)
+        {
+            if (filter->expression_text == property->filter_expression &&
+                    filter->parameters == property->expression_parameters)
+            {
+                readers_[reader_guid] = filter;
+                return;
+            }
+        }
+
+        std::shared_ptr<ReaderFilter> filter = std::make_shared<ReaderFilter>();
+        ReturnCode_t ret = DDSSQLFilter::DDSFilterCompiler::compile(property->filter_expression,
+                        property->expression_parameters, type_.get(), filter->expression);
+        if (!ret)
+        {
+            logWarning(DATA_WRITER, "Filter of reader " << reader_guid << " cannot be applied by the writer");
+            return;
+        }
+
+        filter->expression_text = property->filter_expression;
+        filter->parameters = property->expression_parameters;
+        filters_.push_back(filter);
+        readers_[reader_guid] = filter;
+    }
+
+private:
+
+    struct ReaderFilter
+    {
+        std::string expression_text;
+        std::vector<std::string> parameters;
+        std::unique_ptr<DDSSQLFilter::DDSFilterExpression> expression;
+        //! Sequence number of the last evaluated change
+        fastrtps::rtps::SequenceNumber_t last_sequence = fastrtps::rtps::SequenceNumber_t::unknown();
+        //! Result of the last evaluated change
+        bool last_result = true;
+    };
+
+    void remove_reader(
+            const fastrtps::rtps::GUID_t& reader_guid)
+    {
+        auto it = readers_.find(reader_guid);
+        if (it == readers_.end())
+        {
+            return;
+        }
+
+        std::shared_ptr<ReaderFilter> filter = it->second;
+        readers_.erase(it);
+
+        // Only filters_ and the local copy hold the filter when no other reader uses it
+        if (filter.use_count() == 2)
+        {
+            filters_.erase(std::remove(filters_.begin(), filters_.end(), filter), filters_.end());
+        }
+    }
+
+    TypeSupport type_;
+    mutable std::mutex mutex_;
+    std::map<fastrtps::rtps::GUID_t, std::shared_ptr<ReaderFilter>> readers_;
+    std::vector<std::shared_ptr<ReaderFilter>> filters_;
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_PUBLISHER_DATAWRITERIMPL_READERFILTERCOLLECTION_HPP_
@@ -95,11 +95,7 @@ ReturnCode_t DataReader::read_w_condition(
         int32_t max_samples,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->read_w_condition(data_values, sample_infos, max_samples, a_condition);
 }
 
 ReturnCode_t DataReader::read_instance(
@@ -135,12 +131,8 @@ ReturnCode_t DataReader::read_next_instance_w_condition(
         const InstanceHandle_t& previous_handle,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (previous_handle);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->read_next_instance_w_condition(data_values, sample_infos, max_samples, previous_handle,
+                   a_condition);
 }
 
 ReturnCode_t DataReader::take(
@@ -160,11 +152,7 @@ ReturnCode_t DataReader::take_w_condition(
         int32_t max_samples,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->take_w_condition(data_values, sample_infos, max_samples, a_condition);
 }
 
 ReturnCode_t DataReader::take_instance(
@@ -200,12 +188,8 @@ ReturnCode_t DataReader::take_next_instance_w_condition(
         const InstanceHandle_t& previous_handle,
         ReadCondition* a_condition)
 {
-    static_cast<void> (data_values);
-    static_cast<void> (sample_infos);
-    static_cast<void> (max_samples);
-    static_cast<void> (previous_handle);
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
+    return impl_->take_next_instance_w_condition(data_values, sample_infos, max_samples, previous_handle,
+                   a_condition);
 }
 
 ReturnCode_t DataReader::return_loan(
@@ -388,14 +372,25 @@ ReadCondition* DataReader::create_readcondition(
         const std::vector<ViewStateKind>& view_states,
         const std::vector<InstanceStateKind>& instance_states)
 {
-    logWarning(DATA_READER, "create_readcondition method not implemented");
-    static_cast<void> (sample_states);
-    static_cast<void> (view_states);
-    static_cast<void> (instance_states);
-    return nullptr;
-    /*
-       return impl_->create_readcondition(sample_states, view_states, instance_states);
-     */
+    SampleStateMask sample_mask = 0;
+    for (SampleStateKind kind : sample_states)
+    {
+        sample_mask |= kind;
+    }
+
+    ViewStateMask view_mask = 0;
+    for (ViewStateKind kind : view_states)
+    {
+        view_mask |= kind;
+    }
+
+    InstanceStateMask instance_mask = 0;
+    for (InstanceStateKind kind : instance_states)
+    {
+        instance_mask |= kind;
+    }
+
+    return impl_->create_readcondition(sample_mask, view_mask, instance_mask);
 }
 
 QueryCondition* DataReader::create_querycondition(
@@ -420,19 +415,12 @@ QueryCondition* DataReader::create_querycondition(
 ReturnCode_t DataReader::delete_readcondition(
         ReadCondition* a_condition)
 {
-    static_cast<void> (a_condition);
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->delete_readcondition(a_condition);
-     */
+    return impl_->delete_readcondition(a_condition);
 }
 
 ReturnCode_t DataReader::delete_contained_entities()
 {
-    return ReturnCode_t::RETCODE_UNSUPPORTED;
-    /*
-       return impl_->delete_contained_entities();
-     */
+    return impl_->delete_contained_entities();
 }
 
 const Subscriber* DataReader::get_subscriber() const
@@ -17,6 +17,8 @@
  *
  */
 
+#include <algorithm>
+
 #include <fastrtps/config.h>
 
 #include <fastdds/subscriber/DataReaderImpl.hpp>
@@ -24,9 +26,11 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/SubscriberListener.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
@@ -36,9 +40,12 @@
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/rtps/resources/TimedEvent.h>
 
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/subscriber/DataReaderImpl/ReadTakeCommand.hpp>
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+#include <fastdds/topic/TypedSample.hpp>
 
 #include <fastrtps/utils/TimeConversion.h>
 #include <utils/Host.hpp>
@@ -119,6 +126,11 @@ DataReaderImpl::DataReaderImpl(
     , sample_info_pool_(qos)
     , loan_manager_(qos)
 {
+    ContentFilteredTopic* filtered_topic = dynamic_cast<ContentFilteredTopic*>(topic_);
+    if (nullptr != filtered_topic)
+    {
+        filtered_topic_ = static_cast<ContentFilteredTopicImpl*>(filtered_topic->get_impl());
+    }
 }
 
 ReturnCode_t DataReaderImpl::enable()
@@ -158,7 +170,7 @@ ReturnCode_t DataReaderImpl::enable()
     // Insert topic_name and partitions
     Property property;
     property.name("topic_name");
-    property.value(topic_->get_name().c_str());
+    property.value(topic_->get_impl()->get_rtps_topic_name().c_str());
     att.endpoint.properties.properties().push_back(std::move(property));
     if (subscriber_->get_qos().partition().names().size() > 0)
     {
@@ -238,7 +250,14 @@ ReturnCode_t DataReaderImpl::enable()
     {
         rqos.data_sharing.off();
     }
-    subscriber_->rtps_participant()->registerReader(reader_, topic_attributes(), rqos);
+    ContentFilterProperty filter_property;
+    subscriber_->rtps_participant()->registerReader(reader_, topic_attributes(), rqos,
+            content_filter_property(filter_property));
+
+    if (nullptr != filtered_topic_)
+    {
+        filtered_topic_->add_reader(this);
+    }
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -254,9 +273,16 @@ void DataReaderImpl::disable()
 
 DataReaderImpl::~DataReaderImpl()
 {
+    delete_contained_entities();
+
     delete lifespan_timer_;
     delete deadline_timer_;
 
+    if (nullptr != filtered_topic_)
+    {
+        filtered_topic_->remove_reader(this);
+    }
+
     if (reader_ != nullptr)
     {
         logInfo(DATA_READER, guid().entityId << " in topic: " << topic_->get_name());
@@ -272,10 +298,14 @@ bool DataReaderImpl::can_be_deleted() const
     if (reader_ != nullptr)
     {
         std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
-        return !loan_manager_.has_outstanding_loans();
+        if (loan_manager_.has_outstanding_loans())
+        {
+            return false;
+        }
     }
 
-    return true;
+    std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+    return read_conditions_.empty();
 }
 
 bool DataReaderImpl::wait_for_unread_message(
@@ -435,6 +465,10 @@ ReturnCode_t DataReaderImpl::read_or_take(
     {
         cmd.add_instance(should_take);
     }
+
+    clear_status(StatusMask::data_available());
+    update_read_conditions();
+
     return cmd.return_value();
 }
 
@@ -590,6 +624,10 @@ ReturnCode_t DataReaderImpl::read_next_sample(
     if (history_.readNextData(data, &rtps_info, max_blocking_time))
     {
         sample_info_to_dds(rtps_info, info);
+
+        std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+        clear_status(StatusMask::data_available());
+        update_read_conditions();
         return ReturnCode_t::RETCODE_OK;
     }
     return ReturnCode_t::RETCODE_ERROR;
@@ -620,11 +658,180 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     if (history_.takeNextData(data, &rtps_info, max_blocking_time))
     {
         sample_info_to_dds(rtps_info, info);
+
+        std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+        clear_status(StatusMask::data_available());
+        update_read_conditions();
         return ReturnCode_t::RETCODE_OK;
     }
     return ReturnCode_t::RETCODE_ERROR;
 }
 
+ReturnCode_t DataReaderImpl::read_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        ReadCondition* a_condition)
+{
+    if (!is_own_read_condition(a_condition))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return read_or_take(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   a_condition->get_sample_state_mask(), a_condition->get_view_state_mask(),
+                   a_condition->get_instance_state_mask(), false, false, false);
+}
+
+ReturnCode_t DataReaderImpl::read_next_instance_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        const InstanceHandle_t& previous_handle,
+        ReadCondition* a_condition)
+{
+    if (!is_own_read_condition(a_condition))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return read_or_take(data_values, sample_infos, max_samples, previous_handle,
+                   a_condition->get_sample_state_mask(), a_condition->get_view_state_mask(),
+                   a_condition->get_instance_state_mask(), false, true, false);
+}
+
+ReturnCode_t DataReaderImpl::take_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        ReadCondition* a_condition)
+{
+    if (!is_own_read_condition(a_condition))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return read_or_take(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   a_condition->get_sample_state_mask(), a_condition->get_view_state_mask(),
+                   a_condition->get_instance_state_mask(), false, false, true);
+}
+
+ReturnCode_t DataReaderImpl::take_next_instance_w_condition(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        const InstanceHandle_t& previous_handle,
+        ReadCondition* a_condition)
+{
+    if (!is_own_read_condition(a_condition))
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return read_or_take(data_values, sample_infos, max_samples, previous_handle,
+                   a_condition->get_sample_state_mask(), a_condition->get_view_state_mask(),
+                   a_condition->get_instance_state_mask(), false, true, true);
+}
+
+ReadCondition* DataReaderImpl::create_readcondition(
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    if (reader_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    ReadCondition* condition = new ReadCondition(user_datareader_, sample_states, view_states, instance_states);
+
+    std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
+    {
+        std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+        read_conditions_.push_back(condition);
+    }
+    update_read_conditions();
+
+    return condition;
+}
+
+ReturnCode_t DataReaderImpl::delete_readcondition(
+        ReadCondition* a_condition)
+{
+    {
+        std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+        auto it = std::find(read_conditions_.begin(), read_conditions_.end(), a_condition);
+        if (it == read_conditions_.end())
+        {
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+        read_conditions_.erase(it);
+    }
+
+    // Deleting the condition detaches it from its WaitSets, so it is done outside of read_conditions_mutex_
+    delete a_condition;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataReaderImpl::delete_contained_entities()
+{
+    std::vector<ReadCondition*> conditions;
+    {
+        std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+        conditions.swap(read_conditions_);
+    }
+
+    for (ReadCondition* condition : conditions)
+    {
+        delete condition;
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DataReaderImpl::is_own_read_condition(
+        const ReadCondition* a_condition) const
+{
+    if (a_condition == nullptr)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+    return std::find(read_conditions_.begin(), read_conditions_.end(), a_condition) != read_conditions_.end();
+}
+
+void DataReaderImpl::update_read_conditions()
+{
+    std::lock_guard<std::mutex> guard(read_conditions_mutex_);
+    if (read_conditions_.empty())
+    {
+        return;
+    }
+
+    // Only the sample state is tracked by the history, so the trigger value is derived from the unread counter
+    uint64_t unread = reader_->get_unread_count();
+    uint64_t total = history_.getHistorySize();
+    for (ReadCondition* condition : read_conditions_)
+    {
+        SampleStateMask states = condition->get_sample_state_mask();
+        bool value = ((0 != (states & NOT_READ_SAMPLE_STATE)) && (unread > 0)) ||
+                ((0 != (states & READ_SAMPLE_STATE)) && (total > unread));
+        condition->set_trigger_value(value);
+    }
+}
+
+void DataReaderImpl::raise_status(
+        const StatusMask& status)
+{
+    user_datareader_->get_statuscondition().get_impl()->set_status(status, true);
+}
+
+void DataReaderImpl::clear_status(
+        const StatusMask& status)
+{
+    user_datareader_->get_statuscondition().get_impl()->set_status(status, false);
+}
+
 ReturnCode_t DataReaderImpl::get_first_untaken_info(
         SampleInfo* info)
 {
@@ -658,10 +865,17 @@ void DataReaderImpl::subscriber_qos_updated()
     {
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         ReaderQos rqos = qos_.get_readerqos(get_subscriber()->get_qos());
-        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos);
+        ContentFilterProperty filter_property;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(filter_property));
     }
 }
 
+void DataReaderImpl::filter_has_been_updated()
+{
+    subscriber_qos_updated();
+}
+
 ReturnCode_t DataReaderImpl::set_qos(
         const DataReaderQos& qos)
 {
@@ -697,7 +911,9 @@ ReturnCode_t DataReaderImpl::set_qos(
     {
         //NOTIFY THE BUILTIN PROTOCOLS THAT THE READER HAS CHANGED
         ReaderQos rqos = qos.get_readerqos(get_subscriber()->get_qos());
-        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos);
+        ContentFilterProperty filter_property;
+        subscriber_->rtps_participant()->updateReader(reader_, topic_attributes(), rqos,
+                content_filter_property(filter_property));
 
         // Deadline
         if (qos_.deadline().period != c_TimeInfinite)
@@ -737,6 +953,11 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
 {
     if (data_reader_->on_new_cache_change_added(change_in))
     {
+        {
+            std::lock_guard<RecursiveTimedMutex> lock(data_reader_->reader_->getMutex());
+            data_reader_->update_read_conditions();
+        }
+
         //First check if we can handle with on_data_on_readers
         SubscriberListener* subscriber_listener =
                 data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
@@ -752,6 +973,10 @@ void DataReaderImpl::InnerDataReaderListener::onNewCacheChangeAdded(
             {
                 listener->on_data_available(data_reader_->user_datareader_);
             }
+            else
+            {
+                data_reader_->raise_status(StatusMask::data_available());
+            }
         }
     }
 }
@@ -781,6 +1006,10 @@ void DataReaderImpl::InnerDataReaderListener::on_liveliness_changed(
             listener->on_liveliness_changed(data_reader_->user_datareader_, callback_status);
         }
     }
+    else
+    {
+        data_reader_->raise_status(StatusMask::liveliness_changed());
+    }
 }
 
 void DataReaderImpl::InnerDataReaderListener::on_requested_incompatible_qos(
@@ -797,11 +1026,27 @@ void DataReaderImpl::InnerDataReaderListener::on_requested_incompatible_qos(
             listener->on_requested_incompatible_qos(data_reader_->user_datareader_, callback_status);
         }
     }
+    else
+    {
+        data_reader_->raise_status(StatusMask::requested_incompatible_qos());
+    }
 }
 
 bool DataReaderImpl::on_new_cache_change_added(
         const CacheChange_t* const change)
 {
+    CacheChange_t* new_change = const_cast<CacheChange_t*>(change);
+
+    // Writers may not filter on behalf of this reader, so samples not passing the filter are removed here.
+    // Filters work on the serialized payload, which samples from writers on this process may not have yet.
+    if (nullptr != filtered_topic_ && fastrtps::rtps::ALIVE == change->kind &&
+            ((new_change->is_typed_only() && !detail::serialize_typed_sample(*new_change, *payload_pool_)) ||
+            !filtered_topic_->evaluate(change->serializedPayload)))
+    {
+        history_.remove_change_sub(new_change);
+        return false;
+    }
+
     if (qos_.deadline().period != c_TimeInfinite)
     {
         std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
@@ -822,8 +1067,6 @@ bool DataReaderImpl::on_new_cache_change_added(
         }
     }
 
-    CacheChange_t* new_change = const_cast<CacheChange_t*>(change);
-
     if (qos_.lifespan().duration == c_TimeInfinite)
     {
         return true;
@@ -895,6 +1138,7 @@ bool DataReaderImpl::deadline_missed()
     listener_->on_requested_deadline_missed(user_datareader_, deadline_missed_status_);
     subscriber_->subscriber_listener_.on_requested_deadline_missed(user_datareader_, deadline_missed_status_);
     deadline_missed_status_.total_count_change = 0;
+    raise_status(StatusMask::requested_deadline_missed());
 
     if (!history_.set_next_deadline(
                 timer_owner_,
@@ -918,6 +1162,7 @@ ReturnCode_t DataReaderImpl::get_requested_deadline_missed_status(
 
     status = deadline_missed_status_;
     deadline_missed_status_.total_count_change = 0;
+    clear_status(StatusMask::requested_deadline_missed());
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -941,6 +1186,7 @@ bool DataReaderImpl::lifespan_expired()
 
         // The earliest change has expired
         history_.remove_change_sub(earliest_change);
+        update_read_conditions();
 
         // Set the timer for the next change if there is one
         if (!history_.get_earliest_change(&earliest_change))
@@ -1026,6 +1272,7 @@ ReturnCode_t DataReaderImpl::get_liveliness_changed_status(
     status = liveliness_changed_status_;
     liveliness_changed_status_.alive_count_change = 0u;
     liveliness_changed_status_.not_alive_count_change = 0u;
+    clear_status(StatusMask::liveliness_changed());
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -1042,6 +1289,7 @@ ReturnCode_t DataReaderImpl::get_requested_incompatible_qos_status(
 
     status = requested_incompatible_qos_status_;
     requested_incompatible_qos_status_.total_count_change = 0u;
+    clear_status(StatusMask::requested_incompatible_qos());
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -1323,7 +1571,7 @@ fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
 {
     fastrtps::TopicAttributes topic_att;
     topic_att.topicKind = type_->m_isGetKeyDefined ? WITH_KEY : NO_KEY;
-    topic_att.topicName = topic_->get_name();
+    topic_att.topicName = topic_->get_impl()->get_rtps_topic_name();
     topic_att.topicDataType = topic_->get_type_name();
     topic_att.historyQos = qos_.history();
     topic_att.resourceLimitsQos = qos_.resource_limits();
@@ -1345,6 +1593,18 @@ fastrtps::TopicAttributes DataReaderImpl::topic_attributes() const
     return topic_att;
 }
 
+const ContentFilterProperty* DataReaderImpl::content_filter_property(
+        ContentFilterProperty& property) const
+{
+    if (nullptr == filtered_topic_)
+    {
+        return nullptr;
+    }
+
+    filtered_topic_->get_filter_property(property);
+    return &property;
+}
+
 DataReaderListener* DataReaderImpl::get_listener_for(
         const StatusMask& status)
 {
@@ -1359,10 +1619,11 @@ DataReaderListener* DataReaderImpl::get_listener_for(
 std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
 {
     PoolConfig config = PoolConfig::from_history_attributes(history_.m_att );
+    config.payload_arena = PayloadArenaConfig::from_properties(qos_.properties());
 
     if (!payload_pool_)
     {
-        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_impl()->get_rtps_topic_name(), config);
         sample_pool_ = std::make_shared<detail::SampleLoanManager>(config, type_);
     }
 
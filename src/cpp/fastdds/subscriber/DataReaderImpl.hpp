@@ -21,6 +21,9 @@
 #define _FASTRTPS_DATAREADERIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <mutex>
+#include <vector>
+
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
@@ -54,6 +57,7 @@ namespace rtps {
 
 class RTPSReader;
 class TimedEvent;
+struct ContentFilterProperty;
 
 } // namespace rtps
 } // namespace fastrtps
@@ -61,6 +65,8 @@ class TimedEvent;
 namespace fastdds {
 namespace dds {
 
+class ContentFilteredTopicImpl;
+class ReadCondition;
 class Subscriber;
 class SubscriberImpl;
 class TopicDescription;
@@ -179,8 +185,51 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t read_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            ReadCondition* a_condition);
+
+    ReturnCode_t read_next_instance_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            const InstanceHandle_t& previous_handle,
+            ReadCondition* a_condition);
+
+    ReturnCode_t take_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            ReadCondition* a_condition);
+
+    ReturnCode_t take_next_instance_w_condition(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            const InstanceHandle_t& previous_handle,
+            ReadCondition* a_condition);
+
     ///@}
 
+    /**
+     * Creates a ReadCondition attached to this DataReader.
+     * @param sample_states Mask of sample states of the condition.
+     * @param view_states Mask of view states of the condition.
+     * @param instance_states Mask of instance states of the condition.
+     * @return Pointer to the new condition, or nullptr if the reader is not enabled.
+     */
+    ReadCondition* create_readcondition(
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states);
+
+    ReturnCode_t delete_readcondition(
+            ReadCondition* a_condition);
+
+    ReturnCode_t delete_contained_entities();
+
     ReturnCode_t return_loan(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos);
@@ -293,6 +342,12 @@ public:
             const void* data,
             const SampleInfo* info) const;
 
+    /**
+     * Announces the current content filter to the matched writers.
+     * Called by the ContentFilteredTopic of this reader when its expression parameters change.
+     */
+    void filter_has_been_updated();
+
 protected:
 
     //!Subscriber
@@ -306,6 +361,9 @@ protected:
 
     TopicDescription* topic_ = nullptr;
 
+    //! Implementation of topic_ when the reader is on a ContentFilteredTopic
+    ContentFilteredTopicImpl* filtered_topic_ = nullptr;
+
     DataReaderQos qos_;
 
     //!History
@@ -380,6 +438,12 @@ protected:
     detail::SampleInfoPool sample_info_pool_;
     detail::DataReaderLoanManager loan_manager_;
 
+    //! Protects read_conditions_. When both are taken, the reader mutex is locked first.
+    mutable std::mutex read_conditions_mutex_;
+
+    //! ReadConditions created on this reader
+    std::vector<ReadCondition*> read_conditions_;
+
     ReturnCode_t check_collection_preconditions_and_calc_max_samples(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos,
@@ -402,6 +466,34 @@ protected:
             bool single_instance,
             bool should_take);
 
+    /**
+     * Checks that a ReadCondition was created by this reader.
+     * @param a_condition The condition to check.
+     * @return true if the condition belongs to this reader.
+     */
+    bool is_own_read_condition(
+            const ReadCondition* a_condition) const;
+
+    /**
+     * Recomputes the trigger value of the ReadConditions after the sample states of the history have changed.
+     * The mutex of the RTPSReader should be locked.
+     */
+    void update_read_conditions();
+
+    /**
+     * Raises a status on the StatusCondition of the DataReader.
+     * @param status The status being raised.
+     */
+    void raise_status(
+            const StatusMask& status);
+
+    /**
+     * Clears a status on the StatusCondition of the DataReader, after the application has read it.
+     * @param status The status being cleared.
+     */
+    void clear_status(
+            const StatusMask& status);
+
     /**
      * @brief A method called when a new cache change is added
      * @param change The cache change that has been added
@@ -427,6 +519,14 @@ protected:
 
     fastrtps::TopicAttributes topic_attributes() const;
 
+    /**
+     * Fills the content filter information announced on discovery.
+     * @param property Property to fill.
+     * @return Pointer to property when the reader is on a ContentFilteredTopic, nullptr otherwise.
+     */
+    const fastrtps::rtps::ContentFilterProperty* content_filter_property(
+            fastrtps::rtps::ContentFilterProperty& property) const;
+
     void subscriber_qos_updated();
 
     RequestedIncompatibleQosStatus& update_requested_incompatible_qos(
@@ -24,6 +24,7 @@
 
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 
@@ -35,6 +36,7 @@
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
 #include <fastdds/subscriber/DataReaderImpl/SampleInfoPool.hpp>
 #include <fastdds/subscriber/DataReaderImpl/SampleLoanManager.hpp>
+#include <fastdds/topic/TypedSample.hpp>
 
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
@@ -49,6 +51,7 @@ struct ReadTakeCommand
     using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
     using history_type = eprosima::fastrtps::SubscriberHistory;
     using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using IPayloadPool = eprosima::fastrtps::rtps::IPayloadPool;
     using RTPSReader = eprosima::fastrtps::rtps::RTPSReader;
     using WriterProxy = eprosima::fastrtps::rtps::WriterProxy;
     using SampleInfoSeq = LoanableSequence<SampleInfo>;
@@ -67,6 +70,7 @@ struct ReadTakeCommand
         , reader_(reader.reader_)
         , info_pool_(reader.sample_info_pool_)
         , sample_pool_(reader.sample_pool_)
+        , payload_pool_(reader.payload_pool_.get())
         , data_values_(data_values)
         , sample_infos_(sample_infos)
         , remaining_samples_(max_samples)
@@ -78,12 +82,14 @@ struct ReadTakeCommand
         assert(0 <= remaining_samples_);
 
         current_slot_ = data_values_.length();
+        first_slot_ = current_slot_;
         finished_ = nullptr == instance.second;
     }
 
     ~ReadTakeCommand()
     {
-        if (!data_values_.has_ownership() && ReturnCode_t::RETCODE_NO_DATA == return_value_)
+        if (!data_values_.has_ownership() &&
+                (ReturnCode_t::RETCODE_NO_DATA == return_value_ || ReturnCode_t::RETCODE_ERROR == return_value_))
         {
             loan_manager_.return_loan(data_values_, sample_infos_);
             data_values_.unloan();
@@ -132,6 +138,12 @@ struct ReadTakeCommand
                 // Add sample and info to collections
                 bool added = add_sample(*it);
                 reader_->end_sample_access_nts(change, wp, added);
+                if (sample_failed_)
+                {
+                    // The sample would fail again on every read, so its change is released
+                    history_.remove_change_sub(change, it);
+                    break;
+                }
                 if (added && take_samples)
                 {
                     // Remove from history
@@ -183,6 +195,7 @@ private:
     RTPSReader* reader_;
     SampleInfoPool& info_pool_;
     std::shared_ptr<detail::SampleLoanManager> sample_pool_;
+    IPayloadPool* payload_pool_;
     LoanableCollection& data_values_;
     SampleInfoSeq& sample_infos_;
     int32_t remaining_samples_;
@@ -195,6 +208,10 @@ private:
     ReturnCode_t return_value_ = ReturnCode_t::RETCODE_NO_DATA;
 
     LoanableCollection::size_type current_slot_ = 0;
+    //! Slot of the first sample added by this command.
+    LoanableCollection::size_type first_slot_ = 0;
+    //! Whether the last sample could not be added to the collections.
+    bool sample_failed_ = false;
 
     bool go_to_first_valid_instance()
     {
@@ -252,9 +269,10 @@ private:
 
             // Add information
             generate_info(change);
-            if (sample_infos_[current_slot_].valid_data)
+            if (sample_infos_[current_slot_].valid_data && !deserialize_sample(change))
             {
-                deserialize_sample(change);
+                discard_current_slot();
+                return false;
             }
 
             ++current_slot_;
@@ -267,22 +285,50 @@ private:
         return ret_val;
     }
 
-    void deserialize_sample(
+    bool deserialize_sample(
             CacheChange_t* change)
     {
-        auto payload = &(change->serializedPayload);
         if (data_values_.has_ownership())
         {
             // perform deserialization
-            type_->deserialize(payload, data_values_.buffer()[current_slot_]);
+            deserialize_change_sample(*change, type_.get(), data_values_.buffer()[current_slot_]);
         }
         else
         {
-            // loan
+            // loan, which is built from a payload, so samples from writers on this process are serialized first
+            if (change->is_typed_only() && !serialize_typed_sample(*change, *payload_pool_))
+            {
+                logWarning(DATA_READER, "Could not serialize sample " << change->sequenceNumber << " to loan it");
+                return false;
+            }
+
             void* sample;
             sample_pool_->get_loan(change, sample);
             const_cast<void**>(data_values_.buffer())[current_slot_] = sample;
         }
+
+        return true;
+    }
+
+    /**
+     * Removes from the collections the sample being added, which has no data to be loaned.
+     * The command finishes, returning an error when no other sample was added.
+     */
+    void discard_current_slot()
+    {
+        if (!sample_infos_.has_ownership())
+        {
+            info_pool_.return_item(&sample_infos_[current_slot_]);
+        }
+        data_values_.length(current_slot_);
+        sample_infos_.length(current_slot_);
+
+        sample_failed_ = true;
+        finished_ = true;
+        if (current_slot_ == first_slot_)
+        {
+            return_value_ = ReturnCode_t::RETCODE_ERROR;
+        }
     }
 
     void generate_info(
@@ -0,0 +1,81 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadCondition.cpp
+ */
+
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
+#include <fastdds/core/condition/ConditionNotifier.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ReadCondition::ReadCondition(
+        DataReader* reader,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+    : reader_(reader)
+    , sample_states_(sample_states)
+    , view_states_(view_states)
+    , instance_states_(instance_states)
+    , trigger_value_(false)
+{
+}
+
+ReadCondition::~ReadCondition()
+{
+    notifier_->will_be_deleted(*this);
+}
+
+bool ReadCondition::get_trigger_value() const
+{
+    return trigger_value_.load();
+}
+
+DataReader* ReadCondition::get_datareader() const
+{
+    return reader_;
+}
+
+SampleStateMask ReadCondition::get_sample_state_mask() const
+{
+    return sample_states_;
+}
+
+ViewStateMask ReadCondition::get_view_state_mask() const
+{
+    return view_states_;
+}
+
+InstanceStateMask ReadCondition::get_instance_state_mask() const
+{
+    return instance_states_;
+}
+
+void ReadCondition::set_trigger_value(
+        bool value)
+{
+    bool old_value = trigger_value_.exchange(value);
+    if (value && !old_value)
+    {
+        notifier_->notify();
+    }
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
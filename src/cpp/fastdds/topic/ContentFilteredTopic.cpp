@@ -0,0 +1,75 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredTopic.cpp
+ */
+
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ContentFilteredTopic::ContentFilteredTopic(
+        const std::string& name,
+        Topic* related_topic,
+        ContentFilteredTopicImpl* impl)
+    : TopicDescription(name, related_topic->get_type_name())
+    , impl_(impl)
+{
+}
+
+ContentFilteredTopic::~ContentFilteredTopic()
+{
+}
+
+DomainParticipant* ContentFilteredTopic::get_participant() const
+{
+    return impl_->get_participant();
+}
+
+Topic* ContentFilteredTopic::get_related_topic() const
+{
+    return impl_->get_related_topic();
+}
+
+const std::string& ContentFilteredTopic::get_filter_expression() const
+{
+    return impl_->get_filter_expression();
+}
+
+ReturnCode_t ContentFilteredTopic::get_expression_parameters(
+        std::vector<std::string>& expression_parameters) const
+{
+    impl_->get_expression_parameters(expression_parameters);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t ContentFilteredTopic::set_expression_parameters(
+        const std::vector<std::string>& expression_parameters)
+{
+    return impl_->set_expression_parameters(expression_parameters);
+}
+
+TopicDescriptionImpl* ContentFilteredTopic::get_impl() const
+{
+    return impl_;
+}
+
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,143 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * ContentFilteredTopicImpl.cpp
+ *
+ */
+
+#include <fastdds/topic/ContentFilteredTopicImpl.hpp>
+
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/domain/DomainParticipantImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+ContentFilteredTopicImpl::ContentFilteredTopicImpl(
+        DomainParticipantImpl* participant,
+        Topic* related_topic,
+        const std::string& filter_expression,
+        const std::vector<std::string>& expression_parameters,
+        std::unique_ptr<DDSSQLFilter::DDSFilterExpression>&& filter)
+    : participant_(participant)
+    , related_topic_(related_topic)
+    , filter_expression_(filter_expression)
+    , expression_parameters_(expression_parameters)
+    , user_topic_(nullptr)
+    , filter_(std::move(filter))
+{
+    related_topic_->get_impl()->reference();
+}
+
+ContentFilteredTopicImpl::~ContentFilteredTopicImpl()
+{
+    related_topic_->get_impl()->dereference();
+    delete user_topic_;
+}
+
+const std::string& ContentFilteredTopicImpl::get_rtps_topic_name() const
+{
+    return related_topic_->get_name();
+}
+
+DomainParticipant* ContentFilteredTopicImpl::get_participant() const
+{
+    return participant_->get_participant();
+}
+
+Topic* ContentFilteredTopicImpl::get_related_topic() const
+{
+    return related_topic_;
+}
+
+const std::string& ContentFilteredTopicImpl::get_filter_expression() const
+{
+    return filter_expression_;
+}
+
+void ContentFilteredTopicImpl::get_expression_parameters(
+        std::vector<std::string>& expression_parameters) const
+{
+    std::lock_guard<std::mutex> lock(filter_mutex_);
+    expression_parameters = expression_parameters_;
+}
+
+ReturnCode_t ContentFilteredTopicImpl::set_expression_parameters(
+        const std::vector<std::string>& expression_parameters)
+{
+    {
+        std::lock_guard<std::mutex> lock(filter_mutex_);
+        ReturnCode_t ret = filter_->set_parameters(expression_parameters);
+        if (!ret)
+        {
+            return ret;
+        }
+        expression_parameters_ = expression_parameters;
+    }
+
+    // Let the readers announce the new parameters to the matched writers.
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    for (DataReaderImpl* reader : readers_)
+    {
+        reader->filter_has_been_updated();
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+void ContentFilteredTopicImpl::get_filter_property(
+        fastrtps::rtps::ContentFilterProperty& property) const
+{
+    property.content_filtered_topic_name = user_topic_->get_name();
+    property.related_topic_name = related_topic_->get_name();
+    property.filter_class_name = fastrtps::rtps::ContentFilterProperty::DDSSQL_FILTER_CLASS;
+    property.filter_expression = filter_expression_;
+
+    std::lock_guard<std::mutex> lock(filter_mutex_);
+    property.expression_parameters = expression_parameters_;
+}
+
+bool ContentFilteredTopicImpl::evaluate(
+        const fastrtps::rtps::SerializedPayload_t& payload) const
+{
+    std::lock_guard<std::mutex> lock(filter_mutex_);
+    return filter_->evaluate(payload);
+}
+
+void ContentFilteredTopicImpl::add_reader(
+        DataReaderImpl* reader)
+{
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    readers_.insert(reader);
+}
+
+void ContentFilteredTopicImpl::remove_reader(
+        DataReaderImpl* reader)
+{
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    readers_.erase(reader);
+}
+
+const ContentFilteredTopic* ContentFilteredTopicImpl::get_topic() const
+{
+    return user_topic_;
+}
+
+} // dds
+} // fastdds
+} // eprosima
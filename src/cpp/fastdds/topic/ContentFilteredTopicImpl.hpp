@@ -0,0 +1,127 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * ContentFilteredTopicImpl.hpp
+ *
+ */
+
+#ifndef _FASTDDS_CONTENTFILTEREDTOPICIMPL_HPP_
+#define _FASTDDS_CONTENTFILTEREDTOPICIMPL_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+#include <fastdds/topic/TopicDescriptionImpl.hpp>
+#include <fastrtps/types/TypesBase.h>
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+using eprosima::fastrtps::types::ReturnCode_t;
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class ContentFilteredTopic;
+class DataReaderImpl;
+class DomainParticipant;
+class DomainParticipantImpl;
+class Topic;
+
+class ContentFilteredTopicImpl : public TopicDescriptionImpl
+{
+    friend class DomainParticipantImpl;
+
+    ContentFilteredTopicImpl(
+            DomainParticipantImpl* participant,
+            Topic* related_topic,
+            const std::string& filter_expression,
+            const std::vector<std::string>& expression_parameters,
+            std::unique_ptr<DDSSQLFilter::DDSFilterExpression>&& filter);
+
+public:
+
+    virtual ~ContentFilteredTopicImpl();
+
+    const std::string& get_rtps_topic_name() const override;
+
+    DomainParticipant* get_participant() const;
+
+    Topic* get_related_topic() const;
+
+    const std::string& get_filter_expression() const;
+
+    void get_expression_parameters(
+            std::vector<std::string>& expression_parameters) const;
+
+    ReturnCode_t set_expression_parameters(
+            const std::vector<std::string>& expression_parameters);
+
+    /**
+     * Fill the content filter information announced by the readers created on this topic.
+     * @param property [out] Content filter property to fill.
+     */
+    void get_filter_property(
+            fastrtps::rtps::ContentFilterProperty& property) const;
+
+    /**
+     * Check whether a received sample passes the filter.
+     * @param payload Serialized payload of the sample.
+     * @return true if the sample passes the filter.
+     */
+    bool evaluate(
+            const fastrtps::rtps::SerializedPayload_t& payload) const;
+
+    /**
+     * Register a reader that should be notified when the expression parameters change.
+     */
+    void add_reader(
+            DataReaderImpl* reader);
+
+    void remove_reader(
+            DataReaderImpl* reader);
+
+    const ContentFilteredTopic* get_topic() const;
+
+protected:
+
+    DomainParticipantImpl* participant_;
+    Topic* related_topic_;
+    std::string filter_expression_;
+    std::vector<std::string> expression_parameters_;
+    ContentFilteredTopic* user_topic_;
+
+private:
+
+    //! Protects filter_ and expression_parameters_.
+    mutable std::mutex filter_mutex_;
+    std::unique_ptr<DDSSQLFilter::DDSFilterExpression> filter_;
+
+    //! Protects readers_. When both are needed, it is taken before filter_mutex_.
+    std::mutex readers_mutex_;
+    std::set<DataReaderImpl*> readers_;
+};
+
+} // dds
+} // fastdds
+} // eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_CONTENTFILTEREDTOPICIMPL_HPP_ */
@@ -0,0 +1,913 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCompiler.cpp
+ */
+
+#include "DDSFilterCompiler.hpp"
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/TypeDescriptor.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include <cctype>
+#include <cstdlib>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using namespace fastrtps::types;
+
+namespace {
+
+constexpr size_t MAX_PARAMETERS = 100;
+
+DynamicType_ptr resolve_alias(
+        DynamicType_ptr type)
+{
+    while (type && type->get_kind() == TK_ALIAS)
+    {
+        type = type->get_descriptor()->get_base_type();
+    }
+    return type;
+}
+
+/**
+ * Get the serialized size of the types that have a fixed size.
+ * @return 0 for types with variable size, or that are not supported.
+ */
+uint32_t fixed_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_CHAR8:
+            return 1;
+        case TK_INT16:
+        case TK_UINT16:
+            return 2;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_FLOAT32:
+        case TK_ENUM:
+            return 4;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8;
+        case TK_FLOAT128:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+uint8_t alignment_of(
+        uint32_t size)
+{
+    return static_cast<uint8_t>(size > 8 ? 8 : size);
+}
+
+bool is_keyword(
+        const std::string& text,
+        const char* keyword)
+{
+    size_t i = 0;
+    for (; keyword[i] != '\0'; ++i)
+    {
+        if (i >= text.size() || std::toupper(static_cast<unsigned char>(text[i])) != keyword[i])
+        {
+            return false;
+        }
+    }
+    return i == text.size();
+}
+
+} // namespace
+
+ReturnCode_t DDSFilterCompiler::compile(
+        const std::string& expression,
+        const std::vector<std::string>& parameters,
+        const DynamicType_ptr& type,
+        std::unique_ptr<DDSFilterExpression>& filter)
+{
+    DynamicType_ptr struct_type = resolve_alias(type);
+    if (!struct_type || struct_type->get_kind() != TK_STRUCTURE)
+    {
+        logError(DDSSQLFILTER, "Filter expressions can only be applied to structures");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    std::unique_ptr<Expression> result(new Expression());
+    DDSFilterCompiler compiler(struct_type, result.get());
+
+    if (!compiler.tokenize(expression) ||
+            compiler.current().kind == Token::Kind::END ||
+            !compiler.parse_condition() ||
+            compiler.current().kind != Token::Kind::END)
+    {
+        logError(DDSSQLFILTER, "Invalid filter expression '" << expression << "'");
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    size_t pending_fields = result->fields_.size();
+    ReturnCode_t ret = compiler.build_plan(struct_type, "", result->plan_, true, pending_fields);
+    if (!ret)
+    {
+        logError(DDSSQLFILTER, "Type '" << struct_type->get_name() << "' cannot be filtered with '"
+                                        << expression << "'");
+        return ret;
+    }
+    result->field_values_.resize(result->fields_.size());
+
+    ret = result->set_parameters(parameters);
+    if (!ret)
+    {
+        logError(DDSSQLFILTER, "Invalid parameters for filter expression '" << expression << "'");
+        return ret;
+    }
+
+    filter = std::move(result);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DDSFilterCompiler::compile(
+        const std::string& expression,
+        const std::vector<std::string>& parameters,
+        const TopicDataType* type,
+        std::unique_ptr<DDSFilterExpression>& filter)
+{
+    DynamicType_ptr dynamic_type;
+
+    const DynamicPubSubType* dynamic_pubsub = dynamic_cast<const DynamicPubSubType*>(type);
+    if (nullptr != dynamic_pubsub)
+    {
+        dynamic_type = dynamic_pubsub->GetDynamicType();
+    }
+    else if (nullptr != type)
+    {
+        TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+        const TypeIdentifier* type_id = factory->get_type_identifier(type->getName(), true);
+        const TypeObject* type_obj = factory->get_type_object(type->getName(), true);
+        if (nullptr != type_obj && type_obj->_d() == EK_COMPLETE && type_obj->complete()._d() == TK_STRUCTURE &&
+                type_obj->complete().struct_type().struct_flags().IS_MUTABLE())
+        {
+            logError(DDSSQLFILTER, "Mutable type '" << type->getName() << "' is not supported by filter expressions");
+            return ReturnCode_t::RETCODE_UNSUPPORTED;
+        }
+        if (nullptr != type_id && nullptr != type_obj)
+        {
+            dynamic_type = factory->build_dynamic_type(type->getName(), type_id, type_obj);
+        }
+    }
+
+    if (!dynamic_type)
+    {
+        logError(DDSSQLFILTER, "No type information available for type '" <<
+                (nullptr != type ? type->getName() : "") << "'");
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    return compile(expression, parameters, dynamic_type, filter);
+}
+
+void DDSFilterCompiler::add_fixed_step(
+        std::vector<Expression::Step>& plan,
+        uint32_t size,
+        uint32_t count)
+{
+    using Step = Expression::Step;
+
+    uint8_t alignment = alignment_of(size);
+    if (!plan.empty() && plan.back().kind == Step::Kind::SKIP_FIXED &&
+            plan.back().size == size && plan.back().alignment == alignment)
+    {
+        plan.back().count += count;
+        return;
+    }
+
+    Step step;
+    step.kind = Step::Kind::SKIP_FIXED;
+    step.size = size;
+    step.alignment = alignment;
+    step.count = count;
+    plan.push_back(step);
+}
+
+void DDSFilterCompiler::add_strings_step(
+        std::vector<Expression::Step>& plan,
+        uint32_t count)
+{
+    using Step = Expression::Step;
+
+    if (!plan.empty() && plan.back().kind == Step::Kind::SKIP_STRINGS)
+    {
+        plan.back().count += count;
+        return;
+    }
+
+    Step step;
+    step.kind = Step::Kind::SKIP_STRINGS;
+    step.count = count;
+    plan.push_back(step);
+}
+
+bool DDSFilterCompiler::tokenize(
+        const std::string& expression)
+{
+    size_t i = 0;
+    size_t n = expression.size();
+
+    while (i < n)
+    {
+        char c = expression[i];
+        Token token;
+
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            ++i;
+            continue;
+        }
+
+        if (c == '(' || c == ')')
+        {
+            token.kind = c == '(' ? Token::Kind::LEFT_PAREN : Token::Kind::RIGHT_PAREN;
+            ++i;
+        }
+        else if (c == '=' || c == '<' || c == '>' || c == '!')
+        {
+            token.kind = Token::Kind::OPERATOR;
+            token.text = c;
+            ++i;
+            if (i < n && (expression[i] == '=' || (c == '<' && expression[i] == '>')))
+            {
+                token.text += expression[i++];
+            }
+            if (token.text == "!")
+            {
+                return false;
+            }
+        }
+        else if (c == '%')
+        {
+            size_t begin = ++i;
+            while (i < n && std::isdigit(static_cast<unsigned char>(expression[i])))
+            {
+                ++i;
+            }
+            if (i == begin || i - begin > 2)
+            {
+                return false;
+            }
+            token.kind = Token::Kind::PARAMETER;
+            token.text = expression.substr(begin, i - begin);
+        }
+        else if (c == '\'' || c == '"' || c == '`')
+        {
+            char closing = c == '`' ? '\'' : c;
+            size_t end = expression.find(closing, i + 1);
+            if (end == std::string::npos)
+            {
+                return false;
+            }
+            token.kind = Token::Kind::LITERAL;
+            token.text = expression.substr(i, end - i + 1);
+            i = end + 1;
+        }
+        else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                ((c == '-' || c == '+' || c == '.') && i + 1 < n &&
+                (std::isdigit(static_cast<unsigned char>(expression[i + 1])) || expression[i + 1] == '.')))
+        {
+            size_t begin = i++;
+            while (i < n)
+            {
+                char d = expression[i];
+                char prev = expression[i - 1];
+                if (std::isalnum(static_cast<unsigned char>(d)) || d == '.' ||
+                        ((d == '-' || d == '+') && (prev == 'e' || prev == 'E')))
+                {
+                    ++i;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            token.kind = Token::Kind::LITERAL;
+            token.text = expression.substr(begin, i - begin);
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            size_t begin = i++;
+            while (i < n && (std::isalnum(static_cast<unsigned char>(expression[i])) ||
+                    expression[i] == '_' || expression[i] == '.'))
+            {
+                ++i;
+            }
+            token.text = expression.substr(begin, i - begin);
+
+            if (is_keyword(token.text, "AND"))
+            {
+                token.kind = Token::Kind::AND;
+            }
+            else if (is_keyword(token.text, "OR"))
+            {
+                token.kind = Token::Kind::OR;
+            }
+            else if (is_keyword(token.text, "NOT"))
+            {
+                token.kind = Token::Kind::NOT;
+            }
+            else if (is_keyword(token.text, "BETWEEN"))
+            {
+                token.kind = Token::Kind::BETWEEN;
+            }
+            else if (is_keyword(token.text, "LIKE"))
+            {
+                token.kind = Token::Kind::LIKE;
+            }
+            else if (is_keyword(token.text, "TRUE") || is_keyword(token.text, "FALSE"))
+            {
+                token.kind = Token::Kind::LITERAL;
+            }
+            else
+            {
+                token.kind = Token::Kind::IDENTIFIER;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        tokens_.push_back(token);
+    }
+
+    tokens_.push_back(Token());
+    position_ = 0;
+    return true;
+}
+
+bool DDSFilterCompiler::parse_condition()
+{
+    if (!parse_and())
+    {
+        return false;
+    }
+
+    while (current().kind == Token::Kind::OR)
+    {
+        ++position_;
+        if (!parse_and())
+        {
+            return false;
+        }
+        Expression::Instruction instruction;
+        instruction.kind = Expression::Instruction::Kind::OR;
+        filter_->program_.push_back(instruction);
+    }
+
+    return true;
+}
+
+bool DDSFilterCompiler::parse_and()
+{
+    if (!parse_not())
+    {
+        return false;
+    }
+
+    while (current().kind == Token::Kind::AND)
+    {
+        ++position_;
+        if (!parse_not())
+        {
+            return false;
+        }
+        Expression::Instruction instruction;
+        instruction.kind = Expression::Instruction::Kind::AND;
+        filter_->program_.push_back(instruction);
+    }
+
+    return true;
+}
+
+bool DDSFilterCompiler::parse_not()
+{
+    if (current().kind == Token::Kind::NOT)
+    {
+        ++position_;
+        if (!parse_not())
+        {
+            return false;
+        }
+        Expression::Instruction instruction;
+        instruction.kind = Expression::Instruction::Kind::NOT;
+        filter_->program_.push_back(instruction);
+        return true;
+    }
+
+    return parse_primary();
+}
+
+bool DDSFilterCompiler::parse_primary()
+{
+    if (current().kind == Token::Kind::LEFT_PAREN)
+    {
+        ++position_;
+        if (!parse_condition() || current().kind != Token::Kind::RIGHT_PAREN)
+        {
+            return false;
+        }
+        ++position_;
+        return true;
+    }
+
+    return parse_predicate();
+}
+
+bool DDSFilterCompiler::parse_predicate()
+{
+    Expression::Predicate predicate;
+    std::string left_id;
+    std::string right_id;
+    std::string upper_id;
+
+    if (!parse_operand(predicate.left, left_id))
+    {
+        return false;
+    }
+
+    if (current().kind == Token::Kind::OPERATOR)
+    {
+        const std::string& op = current().text;
+        if (op == "=")
+        {
+            predicate.op = Expression::Operator::EQUAL;
+        }
+        else if (op == "<>" || op == "!=")
+        {
+            predicate.op = Expression::Operator::NOT_EQUAL;
+        }
+        else if (op == "<")
+        {
+            predicate.op = Expression::Operator::LESS_THAN;
+        }
+        else if (op == "<=")
+        {
+            predicate.op = Expression::Operator::LESS_EQUAL;
+        }
+        else if (op == ">")
+        {
+            predicate.op = Expression::Operator::GREATER_THAN;
+        }
+        else if (op == ">=")
+        {
+            predicate.op = Expression::Operator::GREATER_EQUAL;
+        }
+        else
+        {
+            return false;
+        }
+        ++position_;
+
+        if (!parse_operand(predicate.right, right_id))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        bool negated = false;
+        if (current().kind == Token::Kind::NOT)
+        {
+            negated = true;
+            ++position_;
+        }
+
+        if (current().kind == Token::Kind::BETWEEN)
+        {
+            ++position_;
+            predicate.op = negated ? Expression::Operator::NOT_BETWEEN : Expression::Operator::BETWEEN;
+            if (!parse_operand(predicate.right, right_id) || current().kind != Token::Kind::AND)
+            {
+                return false;
+            }
+            ++position_;
+            if (!parse_operand(predicate.upper, upper_id))
+            {
+                return false;
+            }
+        }
+        else if (current().kind == Token::Kind::LIKE)
+        {
+            ++position_;
+            predicate.op = negated ? Expression::Operator::NOT_LIKE : Expression::Operator::LIKE;
+            if (!parse_operand(predicate.right, right_id))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // The first field on the predicate is used to resolve enumerator names
+    bool is_between = predicate.op == Expression::Operator::BETWEEN ||
+            predicate.op == Expression::Operator::NOT_BETWEEN;
+    for (const Expression::Operand* operand : {&predicate.left, &predicate.right, &predicate.upper})
+    {
+        if (operand == &predicate.upper && !is_between)
+        {
+            break;
+        }
+        if (operand->kind == Expression::OperandKind::FIELD)
+        {
+            predicate.context_field = operand->index;
+            predicate.has_context_field = true;
+            break;
+        }
+    }
+
+    if (!resolve_operand(predicate.left, left_id, predicate) ||
+            !resolve_operand(predicate.right, right_id, predicate) ||
+            (is_between && !resolve_operand(predicate.upper, upper_id, predicate)))
+    {
+        return false;
+    }
+
+    // Predicates with parameters are checked when the parameters are set
+    bool has_parameters = predicate.left.kind == Expression::OperandKind::PARAMETER ||
+            predicate.right.kind == Expression::OperandKind::PARAMETER ||
+            (is_between && predicate.upper.kind == Expression::OperandKind::PARAMETER);
+    if (!has_parameters && !filter_->check_predicate(predicate))
+    {
+        return false;
+    }
+
+    Expression::Instruction instruction;
+    instruction.kind = Expression::Instruction::Kind::PREDICATE;
+    instruction.predicate = filter_->predicates_.size();
+    filter_->predicates_.push_back(predicate);
+    filter_->program_.push_back(instruction);
+    return true;
+}
+
+bool DDSFilterCompiler::parse_operand(
+        Expression::Operand& operand,
+        std::string& identifier)
+{
+    const Token& token = current();
+    switch (token.kind)
+    {
+        case Token::Kind::IDENTIFIER:
+        {
+            size_t index = 0;
+            if (lookup_field(token.text, index))
+            {
+                operand.kind = Expression::OperandKind::FIELD;
+                operand.index = index;
+            }
+            else
+            {
+                // Should be an enumerator name, resolved once the whole predicate is known
+                operand.kind = Expression::OperandKind::CONSTANT;
+                identifier = token.text;
+            }
+            break;
+        }
+
+        case Token::Kind::LITERAL:
+        {
+            Expression::Value value;
+            if (!Expression::parse_literal(token.text, value))
+            {
+                return false;
+            }
+            operand.kind = Expression::OperandKind::CONSTANT;
+            operand.index = filter_->constants_.size();
+            filter_->constants_.push_back(value);
+            break;
+        }
+
+        case Token::Kind::PARAMETER:
+        {
+            size_t index = static_cast<size_t>(std::strtoul(token.text.c_str(), nullptr, 10));
+            if (index >= MAX_PARAMETERS)
+            {
+                return false;
+            }
+            operand.kind = Expression::OperandKind::PARAMETER;
+            operand.index = index;
+            if (filter_->num_parameters_ <= index)
+            {
+                filter_->num_parameters_ = index + 1;
+            }
+            break;
+        }
+
+        default:
+            return false;
+    }
+
+    ++position_;
+    return true;
+}
+
+bool DDSFilterCompiler::resolve_operand(
+        Expression::Operand& operand,
+        const std::string& identifier,
+        const Expression::Predicate& predicate)
+{
+    if (identifier.empty())
+    {
+        // Enumerators may also be written as string literals
+        if (operand.kind == Expression::OperandKind::CONSTANT && predicate.has_context_field &&
+                filter_->fields_[predicate.context_field].encoding == Expression::FieldEncoding::ENUM &&
+                filter_->constants_[operand.index].kind == Expression::ValueKind::STRING &&
+                !Expression::resolve_identifier(filter_->fields_[predicate.context_field],
+                filter_->constants_[operand.index]))
+        {
+            logError(DDSSQLFILTER, "Unknown enumerator '" << filter_->constants_[operand.index].storage << "'");
+            return false;
+        }
+        return true;
+    }
+
+    if (!predicate.has_context_field)
+    {
+        logError(DDSSQLFILTER, "Unknown identifier '" << identifier << "'");
+        return false;
+    }
+
+    Expression::Value value;
+    value.kind = Expression::ValueKind::IDENTIFIER;
+    value.storage = identifier;
+    if (!Expression::resolve_identifier(filter_->fields_[predicate.context_field], value))
+    {
+        logError(DDSSQLFILTER, "Unknown identifier '" << identifier << "'");
+        return false;
+    }
+
+    operand.kind = Expression::OperandKind::CONSTANT;
+    operand.index = filter_->constants_.size();
+    filter_->constants_.push_back(value);
+    return true;
+}
+
+bool DDSFilterCompiler::lookup_field(
+        const std::string& name,
+        size_t& index)
+{
+    auto it = field_indexes_.find(name);
+    if (it != field_indexes_.end())
+    {
+        index = it->second;
+        return true;
+    }
+
+    DynamicType_ptr current_type = type_;
+    size_t begin = 0;
+    while (true)
+    {
+        if (!current_type || current_type->get_kind() != TK_STRUCTURE)
+        {
+            return false;
+        }
+
+        size_t end = name.find('.', begin);
+        std::string member_name = name.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+
+        std::map<std::string, DynamicTypeMember*> members;
+        current_type->get_all_members_by_name(members);
+        auto member = members.find(member_name);
+        if (member == members.end())
+        {
+            return false;
+        }
+        current_type = resolve_alias(member->second->get_descriptor()->get_type());
+
+        if (end == std::string::npos)
+        {
+            break;
+        }
+        begin = end + 1;
+    }
+
+    Expression::Field field;
+    field.name = name;
+    field.type = current_type;
+    switch (current_type->get_kind())
+    {
+        case TK_BOOLEAN:
+            field.encoding = Expression::FieldEncoding::BOOLEAN;
+            break;
+        case TK_CHAR8:
+            field.encoding = Expression::FieldEncoding::CHAR;
+            break;
+        case TK_BYTE:
+            field.encoding = Expression::FieldEncoding::UINT8;
+            break;
+        case TK_INT16:
+            field.encoding = Expression::FieldEncoding::INT16;
+            break;
+        case TK_UINT16:
+            field.encoding = Expression::FieldEncoding::UINT16;
+            break;
+        case TK_INT32:
+            field.encoding = Expression::FieldEncoding::INT32;
+            break;
+        case TK_UINT32:
+            field.encoding = Expression::FieldEncoding::UINT32;
+            break;
+        case TK_INT64:
+            field.encoding = Expression::FieldEncoding::INT64;
+            break;
+        case TK_UINT64:
+            field.encoding = Expression::FieldEncoding::UINT64;
+            break;
+        case TK_FLOAT32:
+            field.encoding = Expression::FieldEncoding::FLOAT32;
+            break;
+        case TK_FLOAT64:
+            field.encoding = Expression::FieldEncoding::FLOAT64;
+            break;
+        case TK_STRING8:
+            field.encoding = Expression::FieldEncoding::STRING;
+            break;
+        case TK_ENUM:
+            field.encoding = Expression::FieldEncoding::ENUM;
+            break;
+        default:
+            logError(DDSSQLFILTER, "Field '" << name << "' cannot be used on filter expressions");
+            return false;
+    }
+
+    index = filter_->fields_.size();
+    filter_->fields_.push_back(field);
+    field_indexes_[name] = index;
+    return true;
+}
+
+ReturnCode_t DDSFilterCompiler::build_plan(
+        const DynamicType_ptr& type,
+        const std::string& prefix,
+        std::vector<Expression::Step>& plan,
+        bool reading,
+        size_t& pending_fields)
+{
+    // Samples of mutable types are serialized as parameter lists, which the plan cannot walk
+    if (type->get_descriptor()->annotation_is_mutable())
+    {
+        logError(DDSSQLFILTER, "Mutable type '" << type->get_name() << "' is not supported by filter expressions");
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    // Members are ordered by id, which follows the declaration order (including the ones of the base type)
+    std::map<MemberId, DynamicTypeMember*> members;
+    type->get_all_members(members);
+
+    for (const auto& member : members)
+    {
+        if (reading && pending_fields == 0)
+        {
+            break;
+        }
+
+        ReturnCode_t ret = add_member(member.second->get_descriptor()->get_type(),
+                        prefix + member.second->get_name(), plan, reading, pending_fields);
+        if (!ret)
+        {
+            return ret;
+        }
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DDSFilterCompiler::add_member(
+        const DynamicType_ptr& member_type,
+        const std::string& name,
+        std::vector<Expression::Step>& plan,
+        bool reading,
+        size_t& pending_fields)
+{
+    using Step = Expression::Step;
+
+    DynamicType_ptr type = resolve_alias(member_type);
+    if (!type)
+    {
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    if (reading)
+    {
+        auto it = field_indexes_.find(name);
+        if (it != field_indexes_.end())
+        {
+            Step step;
+            step.kind = Step::Kind::READ_FIELD;
+            step.field = it->second;
+            plan.push_back(step);
+            --pending_fields;
+            return ReturnCode_t::RETCODE_OK;
+        }
+    }
+
+    TypeKind kind = type->get_kind();
+    uint32_t size = fixed_size(kind);
+    if (size > 0)
+    {
+        add_fixed_step(plan, size, 1);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    switch (kind)
+    {
+        case TK_STRING8:
+            add_strings_step(plan, 1);
+            return ReturnCode_t::RETCODE_OK;
+
+        case TK_STRUCTURE:
+            return build_plan(type, name + ".", plan, reading, pending_fields);
+
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        {
+            const TypeDescriptor* descriptor = type->get_descriptor();
+            DynamicType_ptr element = resolve_alias(descriptor->get_element_type());
+            if (!element)
+            {
+                return ReturnCode_t::RETCODE_UNSUPPORTED;
+            }
+
+            uint32_t element_size = fixed_size(element->get_kind());
+            Step step;
+            if (kind == TK_SEQUENCE)
+            {
+                step.kind = Step::Kind::SKIP_SEQUENCE;
+                step.size = element_size;
+                step.alignment = alignment_of(element_size);
+            }
+            else
+            {
+                uint32_t count = descriptor->get_total_bounds();
+                if (element_size > 0)
+                {
+                    add_fixed_step(plan, element_size, count);
+                    return ReturnCode_t::RETCODE_OK;
+                }
+                if (element->get_kind() == TK_STRING8)
+                {
+                    add_strings_step(plan, count);
+                    return ReturnCode_t::RETCODE_OK;
+                }
+                step.kind = Step::Kind::SKIP_COMPLEX;
+                step.count = count;
+            }
+
+            if (element_size == 0)
+            {
+                size_t no_fields = 0;
+                ReturnCode_t ret = add_member(element, "", step.element_plan, false, no_fields);
+                if (!ret)
+                {
+                    return ret;
+                }
+            }
+            plan.push_back(step);
+            return ReturnCode_t::RETCODE_OK;
+        }
+
+        default:
+            logError(DDSSQLFILTER, "Member '" << name << "' has a type not supported by filter expressions");
+            return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
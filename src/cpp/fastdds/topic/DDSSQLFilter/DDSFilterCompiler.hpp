@@ -0,0 +1,188 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterCompiler.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCOMPILER_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCOMPILER_HPP_
+
+#include "DDSFilterExpression.hpp"
+
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class TopicDataType;
+
+namespace DDSSQLFilter {
+
+/**
+ * Compiles DDS-SQL filter expressions into DDSFilterExpression objects.
+ *
+ * The supported grammar is the subset of DDS-SQL used on ContentFilteredTopic expressions:
+ * - Conditions combined with AND, OR, NOT and parentheses.
+ * - Predicates with the =, <>, !=, <, <=, >, >=, LIKE, NOT LIKE, BETWEEN and NOT BETWEEN operators.
+ * - Operands that are field names (nested members separated with dots), integer and floating point numbers,
+ *   quoted strings, TRUE and FALSE, enumerator names and %N parameters.
+ */
+class DDSFilterCompiler
+{
+public:
+
+    /**
+     * Compile a filter expression.
+     * @param expression The filter expression.
+     * @param parameters Values for the %N parameters on the expression.
+     * @param type Type of the data the expression will be evaluated on. Must be a structure.
+     * @param [out] filter The compiled expression.
+     * @return RETCODE_OK on success.
+     * RETCODE_BAD_PARAMETER when the expression is not valid for the type, or the parameters are not valid.
+     * RETCODE_UNSUPPORTED when the type is mutable, or has members that cannot be skipped before the referenced
+     * fields.
+     */
+    static fastrtps::types::ReturnCode_t compile(
+            const std::string& expression,
+            const std::vector<std::string>& parameters,
+            const fastrtps::types::DynamicType_ptr& type,
+            std::unique_ptr<DDSFilterExpression>& filter);
+
+    /**
+     * Compile a filter expression for the type of a topic.
+     * The structure of the type is taken from the DynamicType of DynamicPubSubType topics, and from the complete
+     * TypeObject registered with the type name otherwise.
+     * @param expression The filter expression.
+     * @param parameters Values for the %N parameters on the expression.
+     * @param type Type of the topic.
+     * @param [out] filter The compiled expression.
+     * @return Same as the DynamicType overload. RETCODE_UNSUPPORTED is also returned when there is no type
+     * information for the type.
+     */
+    static fastrtps::types::ReturnCode_t compile(
+            const std::string& expression,
+            const std::vector<std::string>& parameters,
+            const TopicDataType* type,
+            std::unique_ptr<DDSFilterExpression>& filter);
+
+private:
+
+    using Expression = DDSFilterExpression;
+
+    struct Token
+    {
+        enum class Kind
+        {
+            END,
+            IDENTIFIER,
+            LITERAL,
+            PARAMETER,
+            LEFT_PAREN,
+            RIGHT_PAREN,
+            OPERATOR,
+            AND,
+            OR,
+            NOT,
+            BETWEEN,
+            LIKE
+        };
+
+        Kind kind = Kind::END;
+        std::string text;
+    };
+
+    DDSFilterCompiler(
+            const fastrtps::types::DynamicType_ptr& type,
+            Expression* filter)
+        : type_(type)
+        , filter_(filter)
+    {
+    }
+
+    bool tokenize(
+            const std::string& expression);
+
+    const Token& current() const
+    {
+        return tokens_[position_];
+    }
+
+    bool parse_condition();
+
+    bool parse_and();
+
+    bool parse_not();
+
+    bool parse_primary();
+
+    bool parse_predicate();
+
+    bool parse_operand(
+            Expression::Operand& operand,
+            std::string& identifier);
+
+    bool resolve_operand(
+            Expression::Operand& operand,
+            const std::string& identifier,
+            const Expression::Predicate& predicate);
+
+    bool lookup_field(
+            const std::string& name,
+            size_t& index);
+
+    fastrtps::types::ReturnCode_t build_plan(
+            const fastrtps::types::DynamicType_ptr& type,
+            const std::string& prefix,
+            std::vector<Expression::Step>& plan,
+            bool reading,
+            size_t& pending_fields);
+
+    fastrtps::types::ReturnCode_t add_member(
+            const fastrtps::types::DynamicType_ptr& type,
+            const std::string& name,
+            std::vector<Expression::Step>& plan,
+            bool reading,
+            size_t& pending_fields);
+
+    static void add_fixed_step(
+            std::vector<Expression::Step>& plan,
+            uint32_t size,
+            uint32_t count);
+
+    static void add_strings_step(
+            std::vector<Expression::Step>& plan,
+            uint32_t count);
+
+    fastrtps::types::DynamicType_ptr type_;
+    Expression* filter_;
+    std::vector<Token> tokens_;
+    size_t position_ = 0;
+    //! Index on fields_ of each referenced field.
+    std::map<std::string, size_t> field_indexes_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTERCOMPILER_HPP_
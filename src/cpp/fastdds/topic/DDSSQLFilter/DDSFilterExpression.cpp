@@ -0,0 +1,769 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterExpression.cpp
+ */
+
+#include "DDSFilterExpression.hpp"
+
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using fastrtps::rtps::octet;
+using fastrtps::rtps::SerializedPayload_t;
+using fastrtps::types::ReturnCode_t;
+
+namespace {
+
+constexpr uint32_t ENCAPSULATION_SIZE = 4;
+
+inline bool align(
+        uint32_t& position,
+        uint32_t alignment,
+        uint32_t length)
+{
+    // Alignment is relative to the end of the encapsulation header
+    uint32_t offset = position - ENCAPSULATION_SIZE;
+    offset = (offset + alignment - 1) & ~(alignment - 1);
+    position = offset + ENCAPSULATION_SIZE;
+    return position <= length;
+}
+
+template<typename T>
+inline T read_raw(
+        const octet* buffer,
+        bool swap)
+{
+    T value;
+    if (swap)
+    {
+        octet* dst = reinterpret_cast<octet*>(&value);
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            dst[i] = buffer[sizeof(T) - 1 - i];
+        }
+    }
+    else
+    {
+        memcpy(&value, buffer, sizeof(T));
+    }
+    return value;
+}
+
+inline bool read_length(
+        const octet* buffer,
+        uint32_t length,
+        uint32_t& position,
+        bool swap,
+        uint32_t& value)
+{
+    if (!align(position, 4, length) || position + 4 > length)
+    {
+        return false;
+    }
+    value = read_raw<uint32_t>(&buffer[position], swap);
+    position += 4;
+    return true;
+}
+
+inline bool equals_no_case(
+        const std::string& str,
+        const char* keyword)
+{
+    size_t len = strlen(keyword);
+    if (str.size() != len)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < len; ++i)
+    {
+        if (std::toupper(static_cast<unsigned char>(str[i])) != keyword[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool DDSFilterExpression::evaluate(
+        const SerializedPayload_t& payload) const
+{
+    if (payload.data == nullptr || payload.length < ENCAPSULATION_SIZE || payload.data[0] != 0)
+    {
+        return true;
+    }
+
+    bool swap = false;
+    switch (payload.data[1])
+    {
+        case CDR_BE:
+            swap = fastrtps::rtps::DEFAULT_ENDIAN != fastrtps::rtps::BIGEND;
+            break;
+        case CDR_LE:
+            swap = fastrtps::rtps::DEFAULT_ENDIAN != fastrtps::rtps::LITTLEEND;
+            break;
+        default:
+            // Mutable types are rejected by the compiler, so only plain CDR is expected here
+            return true;
+    }
+
+    uint32_t position = ENCAPSULATION_SIZE;
+    if (!run_plan(plan_, payload.data, payload.length, position, swap))
+    {
+        return true;
+    }
+
+    stack_.clear();
+    for (const Instruction& instruction : program_)
+    {
+        switch (instruction.kind)
+        {
+            case Instruction::Kind::PREDICATE:
+                stack_.push_back(evaluate_predicate(predicates_[instruction.predicate]));
+                break;
+
+            case Instruction::Kind::NOT:
+                stack_.back() = !stack_.back();
+                break;
+
+            case Instruction::Kind::AND:
+            {
+                bool right = stack_.back();
+                stack_.pop_back();
+                stack_.back() = stack_.back() && right;
+                break;
+            }
+
+            case Instruction::Kind::OR:
+            {
+                bool right = stack_.back();
+                stack_.pop_back();
+                stack_.back() = stack_.back() || right;
+                break;
+            }
+        }
+    }
+
+    return stack_.empty() || stack_.back();
+}
+
+ReturnCode_t DDSFilterExpression::set_parameters(
+        const std::vector<std::string>& parameters)
+{
+    if (parameters.size() < num_parameters_)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    std::vector<Value> new_values(parameters.size());
+    for (size_t i = 0; i < parameters.size(); ++i)
+    {
+        if (!parse_literal(parameters[i], new_values[i]))
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+    }
+
+    std::vector<Value> old_values;
+    old_values.swap(parameters_);
+    parameters_.swap(new_values);
+
+    // Resolve symbolic values and check they can be compared with the fields they are applied to
+    for (const Predicate& predicate : predicates_)
+    {
+        if (predicate.has_context_field)
+        {
+            const Field& field = fields_[predicate.context_field];
+            for (const Operand* operand : {&predicate.left, &predicate.right, &predicate.upper})
+            {
+                if (operand->kind != OperandKind::PARAMETER)
+                {
+                    continue;
+                }
+
+                // Enumerators may be given as identifiers or as strings
+                Value& value = parameters_[operand->index];
+                bool is_symbolic = value.kind == ValueKind::IDENTIFIER ||
+                        (value.kind == ValueKind::STRING && field.encoding == FieldEncoding::ENUM);
+                if (is_symbolic && !resolve_identifier(field, value))
+                {
+                    parameters_.swap(old_values);
+                    return ReturnCode_t::RETCODE_BAD_PARAMETER;
+                }
+            }
+        }
+
+        if (!check_predicate(predicate))
+        {
+            parameters_.swap(old_values);
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DDSFilterExpression::run_plan(
+        const std::vector<Step>& plan,
+        const octet* buffer,
+        uint32_t length,
+        uint32_t& position,
+        bool swap) const
+{
+    for (const Step& step : plan)
+    {
+        switch (step.kind)
+        {
+            case Step::Kind::SKIP_FIXED:
+            {
+                if (!align(position, step.alignment, length))
+                {
+                    return false;
+                }
+                uint64_t skip = static_cast<uint64_t>(step.size) * step.count;
+                if (position + skip > length)
+                {
+                    return false;
+                }
+                position += static_cast<uint32_t>(skip);
+                break;
+            }
+
+            case Step::Kind::SKIP_STRINGS:
+            {
+                for (uint32_t i = 0; i < step.count; ++i)
+                {
+                    uint32_t str_length = 0;
+                    if (!read_length(buffer, length, position, swap, str_length) ||
+                            str_length > length - position)
+                    {
+                        return false;
+                    }
+                    position += str_length;
+                }
+                break;
+            }
+
+            case Step::Kind::SKIP_SEQUENCE:
+            {
+                uint32_t seq_length = 0;
+                if (!read_length(buffer, length, position, swap, seq_length))
+                {
+                    return false;
+                }
+                if (step.element_plan.empty())
+                {
+                    if (seq_length > 0)
+                    {
+                        if (!align(position, step.alignment, length))
+                        {
+                            return false;
+                        }
+                        uint64_t skip = static_cast<uint64_t>(step.size) * seq_length;
+                        if (position + skip > length)
+                        {
+                            return false;
+                        }
+                        position += static_cast<uint32_t>(skip);
+                    }
+                }
+                else
+                {
+                    for (uint32_t i = 0; i < seq_length; ++i)
+                    {
+                        if (!run_plan(step.element_plan, buffer, length, position, swap))
+                        {
+                            return false;
+                        }
+                    }
+                }
+                break;
+            }
+
+            case Step::Kind::SKIP_COMPLEX:
+            {
+                for (uint32_t i = 0; i < step.count; ++i)
+                {
+                    if (!run_plan(step.element_plan, buffer, length, position, swap))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            }
+
+            case Step::Kind::READ_FIELD:
+            {
+                if (!read_field(fields_[step.field], buffer, length, position, swap, field_values_[step.field]))
+                {
+                    return false;
+                }
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool DDSFilterExpression::read_field(
+        const Field& field,
+        const octet* buffer,
+        uint32_t length,
+        uint32_t& position,
+        bool swap,
+        Value& value) const
+{
+    uint32_t size = 0;
+    switch (field.encoding)
+    {
+        case FieldEncoding::BOOLEAN:
+        case FieldEncoding::CHAR:
+        case FieldEncoding::INT8:
+        case FieldEncoding::UINT8:
+            size = 1;
+            break;
+        case FieldEncoding::INT16:
+        case FieldEncoding::UINT16:
+            size = 2;
+            break;
+        case FieldEncoding::INT32:
+        case FieldEncoding::UINT32:
+        case FieldEncoding::FLOAT32:
+        case FieldEncoding::ENUM:
+            size = 4;
+            break;
+        case FieldEncoding::INT64:
+        case FieldEncoding::UINT64:
+        case FieldEncoding::FLOAT64:
+            size = 8;
+            break;
+        case FieldEncoding::STRING:
+        {
+            uint32_t str_length = 0;
+            if (!read_length(buffer, length, position, swap, str_length) || str_length > length - position)
+            {
+                return false;
+            }
+            value.kind = ValueKind::STRING;
+            value.string_value = reinterpret_cast<const char*>(&buffer[position]);
+            // Serialized length includes the terminating NUL
+            value.string_length = str_length > 0 ? str_length - 1 : 0;
+            position += str_length;
+            return true;
+        }
+    }
+
+    if (!align(position, size, length) || position + size > length)
+    {
+        return false;
+    }
+
+    const octet* data = &buffer[position];
+    position += size;
+    switch (field.encoding)
+    {
+        case FieldEncoding::BOOLEAN:
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = data[0] ? 1 : 0;
+            break;
+        case FieldEncoding::CHAR:
+            value.kind = ValueKind::STRING;
+            value.string_value = reinterpret_cast<const char*>(data);
+            value.string_length = 1;
+            break;
+        case FieldEncoding::INT8:
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = static_cast<int8_t>(data[0]);
+            break;
+        case FieldEncoding::UINT8:
+            value.kind = ValueKind::UNSIGNED;
+            value.unsigned_value = data[0];
+            break;
+        case FieldEncoding::INT16:
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = read_raw<int16_t>(data, swap);
+            break;
+        case FieldEncoding::UINT16:
+            value.kind = ValueKind::UNSIGNED;
+            value.unsigned_value = read_raw<uint16_t>(data, swap);
+            break;
+        case FieldEncoding::INT32:
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = read_raw<int32_t>(data, swap);
+            break;
+        case FieldEncoding::UINT32:
+            value.kind = ValueKind::UNSIGNED;
+            value.unsigned_value = read_raw<uint32_t>(data, swap);
+            break;
+        case FieldEncoding::ENUM:
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = read_raw<uint32_t>(data, swap);
+            break;
+        case FieldEncoding::INT64:
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = read_raw<int64_t>(data, swap);
+            break;
+        case FieldEncoding::UINT64:
+            value.kind = ValueKind::UNSIGNED;
+            value.unsigned_value = read_raw<uint64_t>(data, swap);
+            break;
+        case FieldEncoding::FLOAT32:
+            value.kind = ValueKind::FLOAT;
+            value.float_value = read_raw<float>(data, swap);
+            break;
+        case FieldEncoding::FLOAT64:
+            value.kind = ValueKind::FLOAT;
+            value.float_value = read_raw<double>(data, swap);
+            break;
+        case FieldEncoding::STRING:
+            break;
+    }
+
+    return true;
+}
+
+const DDSFilterExpression::Value& DDSFilterExpression::operand_value(
+        const Operand& operand) const
+{
+    switch (operand.kind)
+    {
+        case OperandKind::FIELD:
+            return field_values_[operand.index];
+        case OperandKind::PARAMETER:
+            return parameters_[operand.index];
+        case OperandKind::CONSTANT:
+        default:
+            return constants_[operand.index];
+    }
+}
+
+DDSFilterExpression::Value DDSFilterExpression::operand_prototype(
+        const Operand& operand) const
+{
+    if (operand.kind == OperandKind::FIELD)
+    {
+        Value value;
+        value.kind = field_value_kind(fields_[operand.index].encoding);
+        return value;
+    }
+    return operand_value(operand);
+}
+
+bool DDSFilterExpression::evaluate_predicate(
+        const Predicate& predicate) const
+{
+    const Value& left = operand_value(predicate.left);
+    const Value& right = operand_value(predicate.right);
+
+    switch (predicate.op)
+    {
+        case Operator::EQUAL:
+            return compare(left, right) == 0;
+        case Operator::NOT_EQUAL:
+            return compare(left, right) != 0;
+        case Operator::LESS_THAN:
+            return compare(left, right) < 0;
+        case Operator::LESS_EQUAL:
+            return compare(left, right) <= 0;
+        case Operator::GREATER_THAN:
+            return compare(left, right) > 0;
+        case Operator::GREATER_EQUAL:
+            return compare(left, right) >= 0;
+        case Operator::LIKE:
+            return like(left.string_value, left.string_length, right.string_value, right.string_length);
+        case Operator::NOT_LIKE:
+            return !like(left.string_value, left.string_length, right.string_value, right.string_length);
+        case Operator::BETWEEN:
+        case Operator::NOT_BETWEEN:
+        {
+            const Value& upper = operand_value(predicate.upper);
+            bool in_range = compare(left, right) >= 0 && compare(left, upper) <= 0;
+            return (predicate.op == Operator::BETWEEN) == in_range;
+        }
+    }
+
+    return true;
+}
+
+int DDSFilterExpression::compare(
+        const Value& left,
+        const Value& right)
+{
+    if (left.kind == ValueKind::STRING)
+    {
+        uint32_t len = left.string_length < right.string_length ? left.string_length : right.string_length;
+        int ret = len > 0 ? memcmp(left.string_value, right.string_value, len) : 0;
+        if (ret == 0)
+        {
+            ret = left.string_length < right.string_length ? -1 : (left.string_length > right.string_length ? 1 : 0);
+        }
+        return ret;
+    }
+
+    if (left.kind == ValueKind::FLOAT || right.kind == ValueKind::FLOAT)
+    {
+        auto as_double = [](const Value& v) -> double
+                {
+                    switch (v.kind)
+                    {
+                        case ValueKind::SIGNED:
+                            return static_cast<double>(v.signed_value);
+                        case ValueKind::UNSIGNED:
+                            return static_cast<double>(v.unsigned_value);
+                        default:
+                            return v.float_value;
+                    }
+                };
+        double l = as_double(left);
+        double r = as_double(right);
+        return l < r ? -1 : (l > r ? 1 : 0);
+    }
+
+    if (left.kind == ValueKind::SIGNED && right.kind == ValueKind::SIGNED)
+    {
+        return left.signed_value < right.signed_value ? -1 : (left.signed_value > right.signed_value ? 1 : 0);
+    }
+
+    // At least one of them is unsigned
+    if (left.kind == ValueKind::SIGNED && left.signed_value < 0)
+    {
+        return -1;
+    }
+    if (right.kind == ValueKind::SIGNED && right.signed_value < 0)
+    {
+        return 1;
+    }
+    return left.unsigned_value < right.unsigned_value ? -1 : (left.unsigned_value > right.unsigned_value ? 1 : 0);
+}
+
+bool DDSFilterExpression::like(
+        const char* str,
+        uint32_t str_length,
+        const char* pattern,
+        uint32_t pattern_length)
+{
+    // '%' matches any sequence of characters, '_' (or '?') matches any single character
+    uint32_t s = 0;
+    uint32_t p = 0;
+    uint32_t star_p = UINT32_MAX;
+    uint32_t star_s = 0;
+
+    while (s < str_length)
+    {
+        if (p < pattern_length && (pattern[p] == '_' || pattern[p] == '?' || pattern[p] == str[s]))
+        {
+            ++s;
+            ++p;
+        }
+        else if (p < pattern_length && (pattern[p] == '%' || pattern[p] == '*'))
+        {
+            star_p = p++;
+            star_s = s;
+        }
+        else if (star_p != UINT32_MAX)
+        {
+            p = star_p + 1;
+            s = ++star_s;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (p < pattern_length && (pattern[p] == '%' || pattern[p] == '*'))
+    {
+        ++p;
+    }
+
+    return p == pattern_length;
+}
+
+bool DDSFilterExpression::parse_literal(
+        const std::string& text,
+        Value& value)
+{
+    size_t begin = text.find_first_not_of(" \t\r\n");
+    size_t end = text.find_last_not_of(" \t\r\n");
+    if (begin == std::string::npos)
+    {
+        return false;
+    }
+    std::string literal = text.substr(begin, end - begin + 1);
+
+    // Quoted string
+    char quote = literal[0];
+    if (quote == '\'' || quote == '"' || quote == '`')
+    {
+        char closing = quote == '`' ? '\'' : quote;
+        if (literal.size() < 2 || literal.back() != closing)
+        {
+            return false;
+        }
+        value.set_string(literal.substr(1, literal.size() - 2));
+        return true;
+    }
+
+    // Boolean
+    if (equals_no_case(literal, "TRUE") || equals_no_case(literal, "FALSE"))
+    {
+        value.kind = ValueKind::SIGNED;
+        value.signed_value = equals_no_case(literal, "TRUE") ? 1 : 0;
+        return true;
+    }
+
+    // Identifier (enumerator)
+    if (std::isalpha(static_cast<unsigned char>(literal[0])) || literal[0] == '_')
+    {
+        for (char c : literal)
+        {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+            {
+                return false;
+            }
+        }
+        value.kind = ValueKind::IDENTIFIER;
+        value.storage = literal;
+        value.string_value = value.storage.c_str();
+        value.string_length = static_cast<uint32_t>(value.storage.size());
+        return true;
+    }
+
+    // Number
+    const char* str = literal.c_str();
+    char* str_end = nullptr;
+    bool is_float = literal.find_first_of(".eE") != std::string::npos &&
+            literal.find_first_of("xX") == std::string::npos;
+    errno = 0;
+    if (is_float)
+    {
+        value.kind = ValueKind::FLOAT;
+        value.float_value = strtod(str, &str_end);
+    }
+    else if (literal[0] == '-')
+    {
+        value.kind = ValueKind::SIGNED;
+        value.signed_value = strtoll(str, &str_end, 0);
+    }
+    else
+    {
+        value.unsigned_value = strtoull(str, &str_end, 0);
+        value.kind = value.unsigned_value > static_cast<uint64_t>(INT64_MAX) ? ValueKind::UNSIGNED : ValueKind::SIGNED;
+    }
+
+    return errno == 0 && str_end == str + literal.size();
+}
+
+bool DDSFilterExpression::resolve_identifier(
+        const Field& field,
+        Value& value)
+{
+    if (field.encoding != FieldEncoding::ENUM || !field.type)
+    {
+        return false;
+    }
+
+    std::map<fastrtps::types::MemberId, fastrtps::types::DynamicTypeMember*> members;
+    field.type->get_all_members(members);
+    for (const auto& member : members)
+    {
+        if (member.second->get_name() == value.storage)
+        {
+            value.kind = ValueKind::SIGNED;
+            value.signed_value = static_cast<int64_t>(member.first);
+            value.storage.clear();
+            value.string_value = nullptr;
+            value.string_length = 0;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+DDSFilterExpression::ValueKind DDSFilterExpression::field_value_kind(
+        FieldEncoding encoding)
+{
+    switch (encoding)
+    {
+        case FieldEncoding::CHAR:
+        case FieldEncoding::STRING:
+            return ValueKind::STRING;
+        case FieldEncoding::UINT8:
+        case FieldEncoding::UINT16:
+        case FieldEncoding::UINT32:
+        case FieldEncoding::UINT64:
+            return ValueKind::UNSIGNED;
+        case FieldEncoding::FLOAT32:
+        case FieldEncoding::FLOAT64:
+            return ValueKind::FLOAT;
+        default:
+            return ValueKind::SIGNED;
+    }
+}
+
+bool DDSFilterExpression::check_predicate(
+        const Predicate& predicate) const
+{
+    Value left = operand_prototype(predicate.left);
+    if (!check_types(left, operand_prototype(predicate.right), predicate.op))
+    {
+        return false;
+    }
+    if (predicate.op == Operator::BETWEEN || predicate.op == Operator::NOT_BETWEEN)
+    {
+        return check_types(left, operand_prototype(predicate.upper), predicate.op);
+    }
+    return true;
+}
+
+bool DDSFilterExpression::check_types(
+        const Value& left,
+        const Value& right,
+        Operator op)
+{
+    if (left.kind == ValueKind::IDENTIFIER || right.kind == ValueKind::IDENTIFIER)
+    {
+        return false;
+    }
+
+    bool left_string = left.kind == ValueKind::STRING;
+    bool right_string = right.kind == ValueKind::STRING;
+    if (op == Operator::LIKE || op == Operator::NOT_LIKE)
+    {
+        return left_string && right_string;
+    }
+    return left_string == right_string;
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,326 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterExpression.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
+#define _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+/**
+ * A DDS-SQL filter expression compiled against a data type.
+ *
+ * The expression is compiled once by DDSFilterCompiler into:
+ * - A flat plan of steps that walks the CDR representation of the type up to the last field referenced by the
+ *   expression, reading those fields and skipping everything else.
+ * - A list of predicates, and a postfix program combining their results with AND, OR and NOT.
+ *
+ * Evaluating a sample is then a single pass over its serialized payload, without deserializing it.
+ * Instances are not thread-safe; callers should protect concurrent calls to evaluate() and set_parameters().
+ */
+class DDSFilterExpression
+{
+    friend class DDSFilterCompiler;
+
+public:
+
+    /**
+     * Evaluate the filter on a serialized sample.
+     * @param payload Serialized payload of the sample, including its encapsulation header.
+     * @return false when the sample does not pass the filter, true otherwise. Samples that cannot be evaluated
+     * (i.e. truncated payloads) are considered to pass the filter. Filters are only compiled for types serialized as
+     * plain CDR, so samples with other encapsulations come from writers not following the type; they also pass.
+     */
+    bool evaluate(
+            const fastrtps::rtps::SerializedPayload_t& payload) const;
+
+    /**
+     * Change the values of the %N parameters of the expression.
+     * @param parameters New values of the parameters.
+     * @return RETCODE_OK on success. RETCODE_BAD_PARAMETER when the number of parameters is not enough for the
+     * expression, or when a parameter cannot be compared with the field it is applied to. The previous values are
+     * kept on error.
+     */
+    fastrtps::types::ReturnCode_t set_parameters(
+            const std::vector<std::string>& parameters);
+
+private:
+
+    DDSFilterExpression() = default;
+
+    //! Kinds of values handled by the expression.
+    enum class ValueKind : uint8_t
+    {
+        SIGNED,
+        UNSIGNED,
+        FLOAT,
+        STRING,
+        //! Symbolic identifier not resolved yet (i.e. an enumerator name on a parameter).
+        IDENTIFIER
+    };
+
+    //! A value read from the payload, a constant, or a parameter.
+    struct Value
+    {
+        ValueKind kind = ValueKind::SIGNED;
+        union
+        {
+            int64_t signed_value;
+            uint64_t unsigned_value;
+            double float_value;
+        };
+
+        //! For strings, points to the payload or to storage.
+        const char* string_value = nullptr;
+        uint32_t string_length = 0;
+        //! Owned characters for string constants and parameters.
+        std::string storage;
+
+        Value()
+            : signed_value(0)
+        {
+        }
+
+        Value(
+                const Value& other)
+        {
+            *this = other;
+        }
+
+        Value& operator =(
+                const Value& other)
+        {
+            kind = other.kind;
+            unsigned_value = other.unsigned_value;
+            storage = other.storage;
+            string_length = other.string_length;
+            bool owned = (other.string_value != nullptr) && (other.string_value == other.storage.c_str());
+            string_value = owned ? storage.c_str() : other.string_value;
+            return *this;
+        }
+
+        void set_string(
+                const std::string& str)
+        {
+            kind = ValueKind::STRING;
+            storage = str;
+            string_value = storage.c_str();
+            string_length = static_cast<uint32_t>(storage.size());
+        }
+
+    };
+
+    //! How a field is encoded in CDR.
+    enum class FieldEncoding : uint8_t
+    {
+        BOOLEAN,
+        CHAR,
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT32,
+        FLOAT64,
+        STRING,
+        ENUM
+    };
+
+    //! A field referenced by the expression.
+    struct Field
+    {
+        std::string name;
+        FieldEncoding encoding = FieldEncoding::INT32;
+        //! Type of the field (used to resolve enumerator names).
+        fastrtps::types::DynamicType_ptr type;
+    };
+
+    //! A step of the plan that walks the serialized payload.
+    struct Step
+    {
+        enum class Kind : uint8_t
+        {
+            //! Skip count elements of size bytes, aligned to alignment.
+            SKIP_FIXED,
+            //! Skip count strings.
+            SKIP_STRINGS,
+            //! Read a sequence length and skip that many elements using element_plan, or size when it is not empty.
+            SKIP_SEQUENCE,
+            //! Skip count elements using element_plan.
+            SKIP_COMPLEX,
+            //! Read the value of a field.
+            READ_FIELD
+        };
+
+        Kind kind = Kind::SKIP_FIXED;
+        uint8_t alignment = 1;
+        uint32_t size = 0;
+        uint32_t count = 1;
+        size_t field = 0;
+        std::vector<Step> element_plan;
+    };
+
+    //! Sources of the operands of a predicate.
+    enum class OperandKind : uint8_t
+    {
+        FIELD,
+        CONSTANT,
+        PARAMETER
+    };
+
+    struct Operand
+    {
+        OperandKind kind = OperandKind::CONSTANT;
+        //! Index on fields_, constants_ or parameters_.
+        size_t index = 0;
+    };
+
+    //! Relational operators.
+    enum class Operator : uint8_t
+    {
+        EQUAL,
+        NOT_EQUAL,
+        LESS_THAN,
+        LESS_EQUAL,
+        GREATER_THAN,
+        GREATER_EQUAL,
+        LIKE,
+        NOT_LIKE,
+        BETWEEN,
+        NOT_BETWEEN
+    };
+
+    struct Predicate
+    {
+        Operator op = Operator::EQUAL;
+        Operand left;
+        Operand right;
+        //! Upper limit for BETWEEN.
+        Operand upper;
+        //! Field used to resolve the symbolic values of parameters.
+        size_t context_field = 0;
+        bool has_context_field = false;
+    };
+
+    //! Instructions of the postfix program.
+    struct Instruction
+    {
+        enum class Kind : uint8_t
+        {
+            PREDICATE,
+            AND,
+            OR,
+            NOT
+        };
+
+        Kind kind = Kind::PREDICATE;
+        size_t predicate = 0;
+    };
+
+    bool run_plan(
+            const std::vector<Step>& plan,
+            const fastrtps::rtps::octet* buffer,
+            uint32_t length,
+            uint32_t& position,
+            bool swap) const;
+
+    bool read_field(
+            const Field& field,
+            const fastrtps::rtps::octet* buffer,
+            uint32_t length,
+            uint32_t& position,
+            bool swap,
+            Value& value) const;
+
+    bool evaluate_predicate(
+            const Predicate& predicate) const;
+
+    const Value& operand_value(
+            const Operand& operand) const;
+
+    Value operand_prototype(
+            const Operand& operand) const;
+
+    static bool parse_literal(
+            const std::string& text,
+            Value& value);
+
+    static bool resolve_identifier(
+            const Field& field,
+            Value& value);
+
+    static ValueKind field_value_kind(
+            FieldEncoding encoding);
+
+    bool check_predicate(
+            const Predicate& predicate) const;
+
+    static bool check_types(
+            const Value& left,
+            const Value& right,
+            Operator op);
+
+    static int compare(
+            const Value& left,
+            const Value& right);
+
+    static bool like(
+            const char* str,
+            uint32_t str_length,
+            const char* pattern,
+            uint32_t pattern_length);
+
+    //! Fields referenced by the expression.
+    std::vector<Field> fields_;
+    //! Plan walking the payload up to the last referenced field.
+    std::vector<Step> plan_;
+    //! Literal values on the expression.
+    std::vector<Value> constants_;
+    //! Current values of the parameters.
+    std::vector<Value> parameters_;
+    //! Number of parameters referenced by the expression.
+    size_t num_parameters_ = 0;
+    std::vector<Predicate> predicates_;
+    std::vector<Instruction> program_;
+
+    //! Values read from the last evaluated payload.
+    mutable std::vector<Value> field_values_;
+    //! Evaluation stack of the postfix program.
+    mutable std::vector<bool> stack_;
+};
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_DDSSQLFILTER_DDSFILTEREXPRESSION_HPP_
@@ -21,6 +21,9 @@
 #define _FASTDDS_TOPICDESCRIPTIONIMPL_HPP_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
+#include <string>
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -57,6 +60,13 @@ public:
         --num_refs_;
     }
 
+    /**
+     * Get the name of the topic used on the RTPS layer.
+     * It is the topic name for topics, and the name of the related topic for content filtered topics.
+     * @return the name of the topic announced on discovery.
+     */
+    virtual const std::string& get_rtps_topic_name() const = 0;
+
 private:
     std::atomic_size_t num_refs_;
 
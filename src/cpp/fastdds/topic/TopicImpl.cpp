@@ -165,6 +165,11 @@ const TypeSupport& TopicImpl::get_type() const
     return type_support_;
 }
 
+const std::string& TopicImpl::get_rtps_topic_name() const
+{
+    return user_topic_->get_name();
+}
+
 TopicListener* TopicImpl::get_listener_for(
         const StatusMask& status)
 {
@@ -0,0 +1,160 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypedSample.hpp
+ */
+
+#ifndef _FASTDDS_TOPIC_TYPEDSAMPLE_HPP_
+#define _FASTDDS_TOPIC_TYPEDSAMPLE_HPP_
+
+#include <cassert>
+#include <cstring>
+#include <typeinfo>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/*
+ * Changes written by a DataWriter whose readers are all on the same process may carry the written sample
+ * (CacheChange_t::typed_sample) instead of a serialized payload. These functions let readers consume those changes,
+ * copying the sample when their type allows it, and serializing it only when a payload is really needed.
+ */
+
+/**
+ * Copy the typed sample of a change into a sample of the reader type.
+ *
+ * @param change Change carrying the typed sample.
+ * @param type Type of the reader.
+ * @param data Sample of the reader type where the copy should be stored.
+ *
+ * @return false when the change has no typed sample, the types differ, or the reader type cannot copy samples.
+ */
+inline bool copy_typed_sample(
+        const fastrtps::rtps::CacheChange_t& change,
+        const TopicDataType* type,
+        void* data)
+{
+    const TopicDataType* source_type = change.typed_sample_type;
+    if (!change.typed_sample || nullptr == source_type)
+    {
+        return false;
+    }
+
+    // Readers on other participants register their own instance of the type
+    if (source_type != type &&
+            (typeid(*source_type) != typeid(*type) || 0 != std::strcmp(source_type->getName(), type->getName())))
+    {
+        return false;
+    }
+
+    return type->copy_sample(change.typed_sample.get(), data);
+}
+
+/**
+ * Serialize the typed sample of a change into a separate payload.
+ *
+ * @param change Change carrying the typed sample.
+ * @param payload Payload where the sample should be serialized. It is enlarged when necessary.
+ *
+ * @return whether the sample could be serialized.
+ */
+inline bool serialize_typed_sample(
+        const fastrtps::rtps::CacheChange_t& change,
+        fastrtps::rtps::SerializedPayload_t& payload)
+{
+    TopicDataType* type = change.typed_sample_type;
+    void* sample = change.typed_sample.get();
+    uint32_t size = type->getSerializedSizeProvider(sample)();
+    if (payload.max_size < size)
+    {
+        payload.reserve(size);
+    }
+    return type->serialize(sample, &payload);
+}
+
+/**
+ * Serialize the typed sample of a change into its own payload, taken from a pool.
+ * After this call the change can be handled as any other received change.
+ *
+ * @param change Change carrying the typed sample and no payload.
+ * @param pool Pool from where the payload should be taken.
+ *
+ * @return whether the sample could be serialized.
+ */
+inline bool serialize_typed_sample(
+        fastrtps::rtps::CacheChange_t& change,
+        fastrtps::rtps::IPayloadPool& pool)
+{
+    assert(change.is_typed_only());
+
+    TopicDataType* type = change.typed_sample_type;
+    void* sample = change.typed_sample.get();
+    uint32_t size = type->getSerializedSizeProvider(sample)();
+    if (!pool.get_payload(size, change))
+    {
+        return false;
+    }
+
+    if (!type->serialize(sample, &change.serializedPayload))
+    {
+        pool.release_payload(change);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Get the sample of a change into a sample of the reader type, copying its typed sample when possible, and
+ * deserializing its payload otherwise.
+ *
+ * @param change Change holding the sample.
+ * @param type Type of the reader.
+ * @param data Sample of the reader type where the result should be stored.
+ *
+ * @return whether the sample could be retrieved.
+ */
+inline bool deserialize_change_sample(
+        fastrtps::rtps::CacheChange_t& change,
+        TopicDataType* type,
+        void* data)
+{
+    if (copy_typed_sample(change, type, data))
+    {
+        return true;
+    }
+
+    if (change.is_typed_only())
+    {
+        fastrtps::rtps::SerializedPayload_t payload;
+        return serialize_typed_sample(change, payload) && type->deserialize(&payload, data);
+    }
+
+    return type->deserialize(&change.serializedPayload, data);
+}
+
+} // namespace detail
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TOPIC_TYPEDSAMPLE_HPP_
@@ -28,6 +28,8 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <utils/collections/InstanceDeadlines.hpp>
+
 #include <limits>
 #include <mutex>
 
@@ -64,6 +66,7 @@ PublisherHistory::PublisherHistory(
         uint32_t payloadMaxSize,
         MemoryManagementPolicy_t mempolicy)
     : WriterHistory(to_history_attributes(topic_att, payloadMaxSize, mempolicy))
+    , instance_deadlines_(new InstanceDeadlines())
     , history_qos_(topic_att.historyQos)
     , resource_limited_qos_(topic_att.resourceLimitsQos)
     , topic_att_(topic_att)
@@ -246,6 +249,7 @@ bool PublisherHistory::find_or_add_key(
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
         *vit_out = keyed_changes_.insert(std::make_pair(instance_handle, KeyedChanges())).first;
+        instance_deadlines_->add(instance_handle, (*vit_out)->second.next_deadline_us);
         return true;
     }
 
@@ -387,6 +391,7 @@ bool PublisherHistory::remove_instance_changes(
 
     if (vit->second.cache_changes.empty())
     {
+        instance_deadlines_->remove(vit->first, vit->second.next_deadline_us);
         keyed_changes_.erase(vit);
     }
 
@@ -411,12 +416,14 @@ bool PublisherHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        instance_deadlines_->update(handle, vit->second.next_deadline_us, next_deadline_us);
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -436,19 +443,7 @@ bool PublisherHistory::get_next_deadline(
 
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(
-            keyed_changes_.begin(),
-            keyed_changes_.end(),
-            [](
-                const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-            {
-                return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-            });
-
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
-        return true;
+        return instance_deadlines_->next(handle, next_deadline_us);
     }
     else if (topic_att_.getTopicKind() == NO_KEY)
     {
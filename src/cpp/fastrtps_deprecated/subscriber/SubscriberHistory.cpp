@@ -25,6 +25,8 @@
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/topic/TypedSample.hpp>
+#include <utils/collections/InstanceDeadlines.hpp>
 
 #include <limits>
 #include <mutex>
@@ -80,6 +82,7 @@ SubscriberHistory::SubscriberHistory(
         uint32_t payloadMaxSize,
         MemoryManagementPolicy_t mempolicy)
     : ReaderHistory(to_history_attributes(topic_att, payloadMaxSize, mempolicy))
+    , instance_deadlines_(new InstanceDeadlines())
     , history_qos_(topic_att.historyQos)
     , resource_limited_qos_(topic_att.resourceLimitsQos)
     , topic_att_(topic_att)
@@ -101,6 +104,12 @@ SubscriberHistory::SubscriberHistory(
     {
         resource_limited_qos_.max_instances = std::numeric_limits<int32_t>::max();
     }
+    else if (topic_att.getTopicKind() == WITH_KEY && resource_limited_qos_.max_instances > 0)
+    {
+        // Instances are created by incoming samples, so allocated_samples bounds the initial number of instances
+        empty_instances_.reserve(static_cast<size_t>(
+                    std::min(resource_limited_qos_.max_instances, resource_limited_qos_.allocated_samples)));
+    }
 
     if (resource_limited_qos_.max_samples_per_instance == 0)
     {
@@ -196,7 +205,7 @@ bool SubscriberHistory::received_change_keep_all_with_key(
         std::vector<CacheChange_t*>& instance_changes = vit->second.cache_changes;
         if (instance_changes.size() < static_cast<size_t>(resource_limited_qos_.max_samples_per_instance))
         {
-            return add_received_change_with_key(a_change, vit->second.cache_changes);
+            return add_received_change_with_key(a_change, vit);
         }
 
         logWarning(SUBSCRIBER, "Change not added due to maximum number of samples per instance");
@@ -228,7 +237,7 @@ bool SubscriberHistory::received_change_keep_last_with_key(
 
         if (add)
         {
-            return add_received_change_with_key(a_change, instance_changes);
+            return add_received_change_with_key(a_change, vit);
         }
     }
 
@@ -264,7 +273,7 @@ bool SubscriberHistory::add_received_change(
 
 bool SubscriberHistory::add_received_change_with_key(
         CacheChange_t* a_change,
-        std::vector<CacheChange_t*>& instance_changes)
+        t_m_Inst_Caches::iterator instance)
 {
     if (m_isHistoryFull)
     {
@@ -284,7 +293,8 @@ bool SubscriberHistory::add_received_change_with_key(
 
         // As the instance should be ordered following the presentation QoS, and
         // we only support ordering by reception timestamp, we can always add at the end.
-        instance_changes.push_back(a_change);
+        instance->second.cache_changes.push_back(a_change);
+        empty_instances_.erase(instance->second);
 
         logInfo(SUBSCRIBER, mp_reader->getGuid().entityId
                 << ": Change " << a_change->sequenceNumber << " added from: "
@@ -303,7 +313,7 @@ bool SubscriberHistory::find_key_for_change(
     if (!a_change->instanceHandle.isDefined() && type_ != nullptr)
     {
         logInfo(SUBSCRIBER, "Getting Key of change with no Key transmitted");
-        type_->deserialize(&a_change->serializedPayload, get_key_object_);
+        fastdds::dds::detail::deserialize_change_sample(*a_change, type_, get_key_object_);
         bool is_key_protected = false;
 #if HAVE_SECURITY
         is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
@@ -331,7 +341,7 @@ bool SubscriberHistory::deserialize_change(
 {
     if (change->kind == ALIVE)
     {
-        if (!type_->deserialize(&change->serializedPayload, data))
+        if (!fastdds::dds::detail::deserialize_change_sample(*change, type_, data))
         {
             logError(SUBSCRIBER, "Deserialization of data failed");
             return false;
@@ -453,21 +463,27 @@ bool SubscriberHistory::find_key(
     if (keyed_changes_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
     {
         *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+        instance_deadlines_->add(a_change->instanceHandle, (*vit_out)->second.next_deadline_us);
+        empty_instances_.push(a_change->instanceHandle, (*vit_out)->second);
         return true;
     }
-    else
+
+    // Replace the instance which has been empty for the longest time
+    InstanceHandle_t empty_handle;
+    if (empty_instances_.front(empty_handle))
     {
-        for (vit = keyed_changes_.begin(); vit != keyed_changes_.end(); ++vit)
-        {
-            if (vit->second.cache_changes.size() == 0)
-            {
-                keyed_changes_.erase(vit);
-                *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
-                return true;
-            }
-        }
-        logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+        vit = keyed_changes_.find(empty_handle);
+        assert(vit != keyed_changes_.end());
+        empty_instances_.erase(vit->second);
+        instance_deadlines_->remove(vit->first, vit->second.next_deadline_us);
+        keyed_changes_.erase(vit);
+        *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+        instance_deadlines_->add(a_change->instanceHandle, (*vit_out)->second.next_deadline_us);
+        empty_instances_.push(a_change->instanceHandle, (*vit_out)->second);
+        return true;
     }
+
+    logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
     return false;
 }
 
@@ -492,6 +508,10 @@ bool SubscriberHistory::remove_change_sub(
                 if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
                 {
                     vit->second.cache_changes.erase(chit);
+                    if (vit->second.cache_changes.empty())
+                    {
+                        empty_instances_.push(vit->first, vit->second);
+                    }
                     found = true;
                     break;
                 }
@@ -535,6 +555,10 @@ bool SubscriberHistory::remove_change_sub(
                 {
                     assert(it == chit);
                     it = vit->second.cache_changes.erase(chit);
+                    if (vit->second.cache_changes.empty())
+                    {
+                        empty_instances_.push(vit->first, vit->second);
+                    }
                     found = true;
                     break;
                 }
@@ -582,12 +606,14 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        instance_deadlines_->update(handle, vit->second.next_deadline_us, next_deadline_us);
+        vit->second.next_deadline_us = next_deadline_us;
         return true;
     }
 
@@ -612,17 +638,7 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                        keyed_changes_.end(),
-                        [](
-                            const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                            const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-                        {
-                            return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-                        });
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
-        return true;
+        return instance_deadlines_->next(handle, next_deadline_us);
     }
 
     return false;
@@ -97,6 +97,7 @@ ReaderProxyData::ReaderProxyData(
     , m_type(nullptr)
     , m_type_information(nullptr)
     , m_properties(readerInfo.m_properties)
+    , m_content_filter(readerInfo.m_content_filter)
 {
     if (readerInfo.m_type_id)
     {
@@ -136,6 +137,7 @@ ReaderProxyData& ReaderProxyData::operator =(
     m_topicKind = readerInfo.m_topicKind;
     m_qos.setQos(readerInfo.m_qos, true);
     m_properties = readerInfo.m_properties;
+    m_content_filter = readerInfo.m_content_filter;
 
     if (readerInfo.m_type_id)
     {
@@ -306,6 +308,12 @@ uint32_t ReaderProxyData::get_serialized_size(
         ret_val += fastdds::dds::ParameterSerializer<ParameterPropertyList_t>::cdr_serialized_size(m_properties);
     }
 
+    if (has_content_filter())
+    {
+        // PID_CONTENT_FILTER_PROPERTY
+        ret_val += fastdds::dds::ParameterSerializer<ContentFilterProperty>::cdr_serialized_size(m_content_filter);
+    }
+
 #if HAVE_SECURITY
     if ((this->security_attributes_ != 0UL) || (this->plugin_security_attributes_ != 0UL))
     {
@@ -544,6 +552,14 @@ bool ReaderProxyData::writeToCDRMessage(
         }
     }
 
+    if (has_content_filter())
+    {
+        if (!fastdds::dds::ParameterSerializer<ContentFilterProperty>::add_to_cdr_message(m_content_filter, msg))
+        {
+            return false;
+        }
+    }
+
 #if HAVE_SECURITY
     if ((security_attributes_ != 0UL) || (plugin_security_attributes_ != 0UL))
     {
@@ -955,6 +971,16 @@ bool ReaderProxyData::readFromCDRMessage(
                         break;
                     }
 
+                    case fastdds::dds::PID_CONTENT_FILTER_PROPERTY:
+                    {
+                        if (!fastdds::dds::ParameterSerializer<ContentFilterProperty>::read_from_cdr_message(
+                                    m_content_filter, msg, plength))
+                        {
+                            return false;
+                        }
+                        break;
+                    }
+
                     case fastdds::dds::PID_DATASHARING:
                     {
                         if (!fastdds::dds::QosPoliciesSerializer<DataSharingQosPolicy>::read_from_cdr_message(
@@ -1034,6 +1060,7 @@ void ReaderProxyData::clear()
     m_qos.clear();
     m_properties.clear();
     m_properties.length = 0;
+    m_content_filter = ContentFilterProperty();
 
     if (m_type_id)
     {
@@ -1073,6 +1100,7 @@ void ReaderProxyData::update(
     m_qos.setQos(rdata->m_qos, false);
     m_isAlive = rdata->m_isAlive;
     m_expectsInlineQos = rdata->m_expectsInlineQos;
+    m_content_filter = rdata->m_content_filter;
 }
 
 void ReaderProxyData::copy(
@@ -1090,6 +1118,7 @@ void ReaderProxyData::copy(
     m_isAlive = rdata->m_isAlive;
     m_topicKind = rdata->m_topicKind;
     m_properties = rdata->m_properties;
+    m_content_filter = rdata->m_content_filter;
 
     if (rdata->m_type_id)
     {
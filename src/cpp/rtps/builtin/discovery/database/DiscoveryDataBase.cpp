@@ -56,7 +56,7 @@ DiscoveryDataBase::~DiscoveryDataBase()
 
     if (is_persistent_)
     {
-        backup_file_.close();
+        backup_journal_.close();
     }
 }
 
@@ -306,16 +306,15 @@ bool DiscoveryDataBase::update(
         eprosima::fastrtps::rtps::CacheChange_t* change,
         DiscoveryParticipantChangeData participant_change_data)
 {
-    // In case the ddb is persistent, we store every cache in queue in a file
-    // The own server changes are not stored
+    // In case the ddb is persistent, every change about a remote participant is stored in the journal, whether it
+    // has been received or generated by this server, as the DATA(Up) of a lease duration expiration.
+    // The changes about the server itself are not stored, as they are not part of the snapshot either and the server
+    // announces itself again on restart
     if (is_persistent_ && guid_from_change(change).guidPrefix != server_guid_prefix_)
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_journal_.append(*change);
     }
 
     if (!enabled_)
@@ -339,15 +338,13 @@ bool DiscoveryDataBase::update(
         eprosima::fastrtps::rtps::CacheChange_t* change,
         std::string topic_name)
 {
-    // in case the ddb is persistent, we store every cache in queue in a file
+    // In case the ddb is persistent, every change about a remote endpoint is stored in the journal. The changes about
+    // the server local endpoints are not stored, as they are not part of the snapshot either
     if (is_persistent_ && guid_from_change(change).guidPrefix != server_guid_prefix_)
     {
-        // Does not allow to the server to erase the ddb before this message has been process
+        // Does not allow to the server to erase the ddb before this message has been processed
         std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_journal_.append(*change);
     }
 
     if (!enabled_)
@@ -2494,11 +2491,16 @@ bool DiscoveryDataBase::from_json(
 
 void DiscoveryDataBase::clean_backup()
 {
-    logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
+    logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in binary journal");
 
     // This will erase the last backup stored
-    backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+    backup_journal_.clear();
+}
+
+uint64_t DiscoveryDataBase::backup_journal_size()
+{
+    std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
+    return backup_journal_.size();
 }
 
 void DiscoveryDataBase::persistence_enable(
@@ -2507,7 +2509,10 @@ void DiscoveryDataBase::persistence_enable(
     is_persistent_ = true;
     backup_file_name_ = backup_file_name;
     // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    if (!backup_journal_.open(backup_file_name_))
+    {
+        logError(DISCOVERY_DATABASE, "Cannot open backup journal " << backup_file_name_);
+    }
 }
 
 } // namespace ddb
@@ -35,6 +35,7 @@
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
 
 #include <json.hpp>
 
@@ -314,6 +315,9 @@ public:
     // This function must be called with the incoming datas blocked
     void clean_backup();
 
+    //! Size in bytes of the changes stored in the backup journal since the last call to clean_backup
+    uint64_t backup_journal_size();
+
     // Lock the incoming of new data to the DDB queue. This locks the Listener as well
     void lock_incoming_data()
     {
@@ -550,9 +554,9 @@ protected:
 
     // File to save every cacheChange that is updated to the ddb queues
     std::string backup_file_name_;
-    // This file will keep open to write it fast every time a new cache arrives
-    // It needs a flush every time a new change is added
-    std::ofstream backup_file_;
+    // This journal will keep open to write it fast every time a new cache arrives
+    // It is flushed every time a new change is added
+    DiscoveryJournal backup_journal_;
 };
 
 
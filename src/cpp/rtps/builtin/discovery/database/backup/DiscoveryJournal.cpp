@@ -0,0 +1,299 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryJournal.cpp
+ *
+ */
+
+#include <cstring>
+
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using eprosima::fastrtps::rtps::CacheChange_t;
+using eprosima::fastrtps::rtps::GUID_t;
+using eprosima::fastrtps::rtps::octet;
+using eprosima::fastrtps::rtps::SampleIdentity;
+using eprosima::fastrtps::rtps::SequenceNumber_t;
+using eprosima::fastrtps::rtps::Time_t;
+
+namespace {
+
+// Size of the fields of a record before the payload data
+constexpr uint32_t guid_size = 16;
+constexpr uint32_t sequence_size = 8;
+constexpr uint32_t time_size = 8;
+constexpr uint32_t record_header_size =
+        1 +                                 // kind
+        guid_size +                         // writerGUID
+        16 +                                // instanceHandle
+        sequence_size +                     // sequenceNumber
+        1 +                                 // isRead
+        2 * time_size +                     // sourceTimestamp, receptionTimestamp
+        2 * (guid_size + sequence_size) +   // sample_identity, related_sample_identity
+        2 +                                 // encapsulation
+        4;                                  // payload length
+
+// Largest record accepted when reading, far above the size of any discovery message
+constexpr uint32_t max_record_size = record_header_size + 16 * 1024 * 1024;
+
+template<typename T>
+void put(
+        octet*& pos,
+        const T& value)
+{
+    memcpy(pos, &value, sizeof(T));
+    pos += sizeof(T);
+}
+
+template<typename T>
+void get(
+        const octet*& pos,
+        T& value)
+{
+    memcpy(&value, pos, sizeof(T));
+    pos += sizeof(T);
+}
+
+void put_guid(
+        octet*& pos,
+        const GUID_t& guid)
+{
+    memcpy(pos, guid.guidPrefix.value, guid.guidPrefix.size);
+    memcpy(pos + guid.guidPrefix.size, guid.entityId.value, guid.entityId.size);
+    pos += guid_size;
+}
+
+void get_guid(
+        const octet*& pos,
+        GUID_t& guid)
+{
+    memcpy(guid.guidPrefix.value, pos, guid.guidPrefix.size);
+    memcpy(guid.entityId.value, pos + guid.guidPrefix.size, guid.entityId.size);
+    pos += guid_size;
+}
+
+void put_sequence(
+        octet*& pos,
+        const SequenceNumber_t& sequence)
+{
+    put(pos, sequence.high);
+    put(pos, sequence.low);
+}
+
+void get_sequence(
+        const octet*& pos,
+        SequenceNumber_t& sequence)
+{
+    get(pos, sequence.high);
+    get(pos, sequence.low);
+}
+
+void put_time(
+        octet*& pos,
+        const Time_t& time)
+{
+    put(pos, time.seconds());
+    put(pos, time.fraction());
+}
+
+void get_time(
+        const octet*& pos,
+        Time_t& time)
+{
+    int32_t seconds = 0;
+    uint32_t fraction = 0;
+    get(pos, seconds);
+    get(pos, fraction);
+    time.seconds(seconds);
+    time.fraction(fraction);
+}
+
+void put_sample_identity(
+        octet*& pos,
+        const SampleIdentity& identity)
+{
+    put_guid(pos, identity.writer_guid());
+    put_sequence(pos, identity.sequence_number());
+}
+
+void get_sample_identity(
+        const octet*& pos,
+        SampleIdentity& identity)
+{
+    get_guid(pos, identity.writer_guid());
+    get_sequence(pos, identity.sequence_number());
+}
+
+} // namespace
+
+DiscoveryJournal::~DiscoveryJournal()
+{
+    close();
+}
+
+bool DiscoveryJournal::open(
+        const std::string& file_name)
+{
+    close();
+    file_name_ = file_name;
+    file_.open(file_name_, std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+    if (!file_.is_open())
+    {
+        return false;
+    }
+
+    // Records that were already in the file are counted as part of the journal
+    file_.seekp(0, std::ios_base::end);
+    std::streamoff end = file_.tellp();
+    size_ = end > 0 ? static_cast<uint64_t>(end) : 0;
+    return true;
+}
+
+void DiscoveryJournal::close()
+{
+    if (file_.is_open())
+    {
+        file_.close();
+    }
+}
+
+void DiscoveryJournal::append(
+        const CacheChange_t& change)
+{
+    uint32_t record_size = record_header_size + change.serializedPayload.length;
+    buffer_.resize(sizeof(record_size) + record_size);
+
+    octet* pos = buffer_.data();
+    put(pos, record_size);
+    put(pos, static_cast<octet>(change.kind));
+    put_guid(pos, change.writerGUID);
+    memcpy(pos, change.instanceHandle.value, 16);
+    pos += 16;
+    put_sequence(pos, change.sequenceNumber);
+    put(pos, static_cast<octet>(change.isRead ? 1 : 0));
+    put_time(pos, change.sourceTimestamp);
+    put_time(pos, change.receptionTimestamp);
+    put_sample_identity(pos, change.write_params.sample_identity());
+    put_sample_identity(pos, change.write_params.related_sample_identity());
+    put(pos, change.serializedPayload.encapsulation);
+    put(pos, change.serializedPayload.length);
+    if (change.serializedPayload.length > 0)
+    {
+        memcpy(pos, change.serializedPayload.data, change.serializedPayload.length);
+    }
+
+    file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    file_.flush();
+    size_ += buffer_.size();
+}
+
+void DiscoveryJournal::clear()
+{
+    file_.close();
+    file_.open(file_name_, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    size_ = 0;
+}
+
+bool DiscoveryJournal::read(
+        const std::string& file_name,
+        std::vector<CacheChange_t*>& changes)
+{
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file.seekg(0, std::ios_base::end);
+    std::streamoff file_size = file.tellg();
+    file.seekg(0, std::ios_base::beg);
+    uint64_t remaining = file_size > 0 ? static_cast<uint64_t>(file_size) : 0;
+
+    std::vector<octet> buffer;
+    uint32_t record_size = 0;
+    while (remaining >= sizeof(record_size) &&
+            file.read(reinterpret_cast<char*>(&record_size), sizeof(record_size)))
+    {
+        remaining -= sizeof(record_size);
+
+        if (record_size < record_header_size || record_size > max_record_size)
+        {
+            // Corrupted record, the rest of the journal cannot be trusted
+            break;
+        }
+
+        if (record_size > remaining)
+        {
+            // Torn record at the end of the journal
+            break;
+        }
+        remaining -= record_size;
+
+        buffer.resize(record_size);
+        if (!file.read(reinterpret_cast<char*>(buffer.data()), record_size))
+        {
+            // Torn record at the end of the journal
+            break;
+        }
+
+        const octet* pos = buffer.data();
+        CacheChange_t* change = new CacheChange_t();
+
+        octet kind = 0;
+        get(pos, kind);
+        change->kind = static_cast<fastrtps::rtps::ChangeKind_t>(kind);
+        get_guid(pos, change->writerGUID);
+        memcpy(change->instanceHandle.value, pos, 16);
+        pos += 16;
+        get_sequence(pos, change->sequenceNumber);
+        octet is_read = 0;
+        get(pos, is_read);
+        change->isRead = is_read != 0;
+        get_time(pos, change->sourceTimestamp);
+        get_time(pos, change->receptionTimestamp);
+        get_sample_identity(pos, change->write_params.sample_identity());
+        get_sample_identity(pos, change->write_params.related_sample_identity());
+        get(pos, change->serializedPayload.encapsulation);
+        uint32_t length = 0;
+        get(pos, length);
+
+        if (length != record_size - record_header_size)
+        {
+            delete change;
+            break;
+        }
+
+        change->serializedPayload.reserve(length);
+        change->serializedPayload.length = length;
+        if (length > 0)
+        {
+            memcpy(change->serializedPayload.data, pos, length);
+        }
+
+        changes.push_back(change);
+    }
+
+    return true;
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,95 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryJournal.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_JOURNAL_H_
+#define _FASTDDS_RTPS_DISCOVERY_JOURNAL_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Append-only binary log of the changes received by the DiscoveryDataBase since its last snapshot.
+ *
+ * Each record holds a whole change, payload included, preceded by its size. A record that was not completely written
+ * (i.e. the server stopped while appending it) is discarded when the journal is read, as are the records following
+ * a size that does not fit in the file.
+ * Records are stored in host byte order, as the journal is only read back by the same server.
+ */
+class DiscoveryJournal
+{
+public:
+
+    ~DiscoveryJournal();
+
+    //! Open the journal in append mode, keeping the records already in it
+    bool open(
+            const std::string& file_name);
+
+    //! Close the journal
+    void close();
+
+    //! Append a change to the journal and flush it to the file
+    void append(
+            const eprosima::fastrtps::rtps::CacheChange_t& change);
+
+    //! Erase every record in the journal
+    void clear();
+
+    //! Size in bytes of the records in the journal
+    uint64_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * Read every complete record of a journal file.
+     * @param file_name Name of the journal file
+     * @param changes Vector where the changes are returned. They are allocated with new and owned by the caller.
+     * @return False if the file could not be opened
+     */
+    static bool read(
+            const std::string& file_name,
+            std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes);
+
+private:
+
+    std::ofstream file_;
+
+    std::string file_name_;
+
+    uint64_t size_ = 0;
+
+    //! Buffer where each record is built before writing it, reused between records
+    std::vector<eprosima::fastrtps::rtps::octet> buffer_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_JOURNAL_H_ */
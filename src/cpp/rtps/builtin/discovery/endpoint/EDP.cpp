@@ -97,11 +97,12 @@ EDP::~EDP()
 bool EDP::newLocalReaderProxyData(
         RTPSReader* reader,
         const TopicAttributes& att,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const ContentFilterProperty* content_filter)
 {
     logInfo(RTPS_EDP, "Adding " << reader->getGuid().entityId << " in topic " << att.topicName);
 
-    auto init_fun = [this, reader, &att, &rqos](
+    auto init_fun = [this, reader, &att, &rqos, content_filter](
         ReaderProxyData* rpd,
         bool updating,
         const ParticipantProxyData& participant_data)
@@ -146,6 +147,10 @@ bool EDP::newLocalReaderProxyData(
                 }
                 rpd->m_qos.setQos(rqos, true);
                 rpd->userDefinedId(reader->getAttributes().getUserDefinedID());
+                if (nullptr != content_filter)
+                {
+                    rpd->content_filter(*content_filter);
+                }
 #if HAVE_SECURITY
                 if (mp_RTPSParticipant->is_secure())
                 {
@@ -354,9 +359,10 @@ bool EDP::newLocalWriterProxyData(
 bool EDP::updatedLocalReader(
         RTPSReader* reader,
         const TopicAttributes& att,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const ContentFilterProperty* content_filter)
 {
-    auto init_fun = [this, reader, &rqos, &att](
+    auto init_fun = [this, reader, &rqos, &att, content_filter](
         ReaderProxyData* rdata,
         bool updating,
         const ParticipantProxyData& participant_data)
@@ -377,6 +383,7 @@ bool EDP::updatedLocalReader(
                     rdata->set_announced_unicast_locators(reader->getAttributes().unicastLocatorList);
                 }
                 rdata->m_qos.setQos(rqos, false);
+                rdata->content_filter(nullptr != content_filter ? *content_filter : ContentFilterProperty());
                 rdata->isAlive(true);
                 rdata->m_expectsInlineQos = reader->expectsInlineQos();
 
@@ -1179,8 +1186,15 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
     logInfo(RTPS_EDP, rdata->guid() << " in topic: \"" << rdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+
+    // Only writers on the same topic can match
+    const std::vector<RTPSWriter*>* writers = mp_RTPSParticipant->userWritersOnTopic(rdata->topicName().to_string());
+    if (nullptr == writers)
+    {
+        return true;
+    }
+
+    for (std::vector<RTPSWriter*>::const_iterator wit = writers->begin(); wit != writers->end(); ++wit)
     {
         (*wit)->getMutex().lock();
         GUID_t writerGUID = (*wit)->getGuid();
@@ -1374,8 +1388,15 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
     logInfo(RTPS_EDP, wdata->guid() << " in topic: \"" << wdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+
+    // Only readers on the same topic can match
+    const std::vector<RTPSReader*>* readers = mp_RTPSParticipant->userReadersOnTopic(wdata->topicName().to_string());
+    if (nullptr == readers)
+    {
+        return true;
+    }
+
+    for (std::vector<RTPSReader*>::const_iterator rit = readers->begin(); rit != readers->end(); ++rit)
     {
         GUID_t readerGUID;
         (*rit)->getMutex().lock();
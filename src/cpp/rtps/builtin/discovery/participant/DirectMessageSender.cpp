@@ -94,11 +94,13 @@ const std::vector<GUID_t>& DirectMessageSender::remote_guids() const
  * @param message Pointer to the buffer with the message already serialized.
  * @param max_blocking_time_point Future timepoint where blocking send should end.
  */
-bool DirectMessageSender::send(
-        CDRMessage_t* message,
+bool DirectMessageSender::send_slices(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
-    return participant_->sendSync(message, Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
+    return participant_->sendSync(buffers, total_bytes, Locators(locators_->begin()), Locators(locators_->end()),
+                   max_blocking_time_point);
 }
 
 } /* namespace rtps */
@@ -48,6 +48,7 @@
 #include <rtps/builtin/discovery/endpoint/EDPServer.hpp>
 #include <rtps/builtin/discovery/endpoint/EDPServerListeners.hpp>
 
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -56,6 +57,8 @@ namespace rtps {
 
 using namespace eprosima::fastrtps::rtps;
 
+constexpr uint64_t PDPServer::min_backup_compaction_size_;
+
 PDPServer::PDPServer(
         BuiltinProtocols* builtin,
         const RTPSParticipantAllocationAttributes& allocation,
@@ -66,6 +69,8 @@ PDPServer::PDPServer(
     , discovery_db_(builtin->mp_participantImpl->getGuid().guidPrefix,
             servers_prefixes())
     , durability_ (durability_kind)
+    , backup_snapshot_size_(0)
+    , backup_compaction_pending_(false)
 {
 }
 
@@ -102,7 +107,7 @@ bool PDPServer::init(
         return false;
     }
 
-    std::vector<nlohmann::json> backup_queue;
+    std::vector<fastrtps::rtps::CacheChange_t*> backup_queue;
     if (durability_ == TRANSIENT)
     {
         nlohmann::json backup_json;
@@ -159,7 +164,6 @@ bool PDPServer::init(
     // Restoring the queue must be done after starting the routine
     if (durability_ == TRANSIENT)
     {
-        // This vector is empty till backup queue is implemented
         process_backup_restore_queue(backup_queue);
     }
 
@@ -527,7 +531,7 @@ std::string PDPServer::get_ddb_persistence_file_name() const
 std::string PDPServer::get_ddb_queue_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << "_queue.json";
+    filename << "_queue.bin";
     return filename.str();
 }
 
@@ -776,7 +780,7 @@ bool PDPServer::remove_remote_participant(
             wp.sample_identity(local);
             wp.related_sample_identity(local);
 
-            // Notify the database
+            // Notify the database, which stores the DATA(Up) in the backup journal so the removal survives a restart
             if (discovery_db_.update(pC, ddb::DiscoveryParticipantChangeData()))
             {
                 // assure processing time for the cache
@@ -1395,13 +1399,18 @@ void PDPServer::send_announcement(
 
 bool PDPServer::read_backup(
         nlohmann::json& ddb_json,
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<fastrtps::rtps::CacheChange_t*>& new_changes)
 {
     std::ifstream myfile;
     bool ret = true;
     try
     {
         myfile.open(get_ddb_persistence_file_name(), std::ios_base::in);
+        // Size of the snapshot, used to decide when the journal must be compacted again
+        myfile.seekg(0, std::ios_base::end);
+        std::streamoff size = myfile.tellg();
+        backup_snapshot_size_ = size > 0 ? static_cast<uint64_t>(size) : 0;
+        myfile.seekg(0, std::ios_base::beg);
         // read json object
         myfile >> ddb_json;
         myfile.close();
@@ -1411,25 +1420,10 @@ bool PDPServer::read_backup(
         ret = false;
     }
 
-    // TODO uncomment this part when recover queues is finish
-    // try{
-    //     myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in);
-
-    //     std::string line;
-    //     while (std::getline(myfile, line))
-    //     {
-    //         nlohmann::json change_json = nlohmann::json::parse(line);
-
-    //         // Read every change, and store it in json format in a vector
-    //         new_changes.push_back(change_json);
-    //     }
-
-    //     myfile.close();
-    // }
-    // catch(const std::exception& e)
-    // {
-    //     return ret;
-    // }
+    // The changes received after the snapshot was taken are in the journal. An unmissing journal only means that
+    // nothing has been received since then
+    ddb::DiscoveryJournal::read(get_ddb_queue_persistence_file_name(), new_changes);
+
     return ret;
 }
 
@@ -1579,138 +1573,93 @@ bool PDPServer::process_backup_discovery_database_restore(
 }
 
 bool PDPServer::process_backup_restore_queue(
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<fastrtps::rtps::CacheChange_t*>& new_changes)
 {
-    // fastrtps::rtps::SampleIdentity sample_identity_aux;
-    // fastrtps::rtps::InstanceHandle_t instance_handle_aux;
-    // uint32_t length;
-
-    // EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    // EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
-    // EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
-
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock(mp_PDPReader->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
-
-    // TODO uncomment this funcionality and update with pools when queue functionality is implemented
-    // try
-    // {
-    //     // Read every change and push it to the listener that it belongs
-    //     for (nlohmann::json& json_change : new_changes)
-    //     {
-    //         // std::cout << json_change << std::endl;
-    //         fastrtps::rtps::CacheChange_t* change_aux;
-    //         length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
-    //         (std::istringstream) json_change["sample_identity"].get<std::string>() >> sample_identity_aux;
-    //         (std::istringstream) json_change["instance_handle"].get<std::string>() >> instance_handle_aux;
-
-    //         // Belongs to own server
-    //         if (sample_identity_aux.writer_guid() == mp_PDPWriter->getGuid())
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!mp_PDPWriterHistory->reserve_Cache(&change_aux, length))
-    //                             [this]() -> uint32_t
-    //                             {
-    //                                 return mp_PDP->builtin_attributes().readerPayloadSize;
-    //                             },
-    //                             &change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //         // It came from outside
-    //         else
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!mp_PDPReaderHistory->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //     }
-    // }
-    // catch (std::ios_base::failure&)
-    // {
-    //     // TODO clean changes in case it has been an error
-    //     logError(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
-    //     return false;
-    // }
-    return true;
+    if (new_changes.empty())
+    {
+        return true;
+    }
+
+    logInfo(RTPS_PDP_SERVER, "Restoring " << new_changes.size() << " changes from backup journal");
+
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
+
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(mp_PDPReader->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    bool ret = true;
+
+    // Every change in the journal is about a remote entity, so it is passed again through the reader that receives
+    // such changes, as if it had just arrived. This includes the DATA(Up) generated by this server on a lease
+    // duration expiration, which removes the participant again
+    for (fastrtps::rtps::CacheChange_t* journal_change : new_changes)
+    {
+        RTPSReader* reader = nullptr;
+        ReaderHistory* history = nullptr;
+        ReaderListener* listener = nullptr;
+
+        if (discovery_db_.is_participant(journal_change))
+        {
+            reader = mp_PDPReader;
+            history = mp_PDPReaderHistory;
+            listener = mp_listener;
+        }
+        else if (discovery_db_.is_writer(journal_change))
+        {
+            reader = edp->publications_reader_.first;
+            history = edp->publications_reader_.second;
+            listener = edp_pub_listener;
+        }
+        else if (discovery_db_.is_reader(journal_change))
+        {
+            reader = edp->subscriptions_reader_.first;
+            history = edp->subscriptions_reader_.second;
+            listener = edp_sub_listener;
+        }
+
+        fastrtps::rtps::CacheChange_t* change_aux = nullptr;
+        if (nullptr == reader ||
+                !reader->reserveCache(&change_aux, journal_change->serializedPayload.length))
+        {
+            logError(RTPS_PDP_SERVER, "Error creating CacheChange");
+            ret = false;
+        }
+        else if (!change_aux->copy(journal_change) || !history->received_change(change_aux, 0))
+        {
+            logError(RTPS_PDP_SERVER, "Error restoring CacheChange " << journal_change->instanceHandle);
+            reader->releaseCache(change_aux);
+            ret = false;
+        }
+        else
+        {
+            listener->onNewCacheChangeAdded(reader, change_aux);
+        }
+
+        delete journal_change;
+    }
+    new_changes.clear();
+
+    // The restored changes have been appended again to the journal, so the next backup is taken as a snapshot
+    backup_compaction_pending_ = true;
+
+    return ret;
 }
 
 void PDPServer::process_backup_store()
 {
+    // Every change about a remote entity, received or generated by this server, is already in the journal, so the
+    // snapshot is only taken again when replaying the journal would cost more than reading the snapshot
+    uint64_t journal_size = discovery_db_.backup_journal_size();
+    if (!backup_compaction_pending_ &&
+            journal_size < std::max(min_backup_compaction_size_, backup_snapshot_size_))
+    {
+        return;
+    }
+    backup_compaction_pending_ = false;
+
     logInfo(DISCOVERY_DATABASE, "Dump DDB in json backup");
 
     // This will erase the last backup stored
@@ -1722,6 +1671,8 @@ void PDPServer::process_backup_store()
     discovery_db().to_json(j);
     // setw makes pretty print for json
     backup_json_file << std::setw(4) << j << std::endl;
+    std::streamoff size = backup_json_file.tellp();
+    backup_snapshot_size_ = size > 0 ? static_cast<uint64_t>(size) : 0;
     backup_json_file.close();
 
     // Clear queue ddb backup
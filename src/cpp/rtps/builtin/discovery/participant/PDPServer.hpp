@@ -236,18 +236,20 @@ protected:
     bool process_backup_discovery_database_restore(
             nlohmann::json& ddb_json);
 
-    // Restore the backup file with the changes that were added to the DDB queues (and so acked)
+    // Restore the backup journal with the changes that were added to the DDB queues (and so acked)
     // It reserves memory for the changes depending the pool, and send them by the listener to the DDB
+    // The changes in the argument are released and the vector cleared
     // This method must be called with the DDB variable backup_in_progress as false
     bool process_backup_restore_queue(
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<fastrtps::rtps::CacheChange_t*>& new_changes);
 
-    // Reads the two backup files and stores each json objects in both arguments
-    // The first argument has the json object to restore the DDB
-    // The second argument has the json vector object to restore the changes that must be sent again to the queue
+    // Reads the two backup files and stores their content in both arguments
+    // The first argument has the json object to restore the DDB (snapshot)
+    // The second argument has the changes of the journal that must be sent again to the queue
+    // Returns false if the snapshot could not be read, the journal is read anyway
     bool read_backup(
             nlohmann::json& ddb_json,
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<fastrtps::rtps::CacheChange_t*>& new_changes);
 
     std::vector<fastrtps::rtps::GuidPrefix_t> servers_prefixes();
 
@@ -256,6 +258,8 @@ protected:
 
     // Erase the last file and store the backup info of the actual state of the DDB
     // Erase the content of the file with the changes in the queues
+    // As the changes are journaled when they arrive, this is only done when the journal has grown bigger than the
+    // last snapshot, so the cost of the snapshot is amortized among the changes received
     // This method must be called after the whole DDB routine process has been finished and with the DDB
     // queues empty. If not, there will be some information that could be lost. For this, the lock_incoming_data()
     // from DDB must be called during this process
@@ -282,6 +286,15 @@ private:
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastrtps::rtps::DurabilityKind_t durability_;
 
+    //! Size in bytes of the last DDB snapshot stored
+    uint64_t backup_snapshot_size_;
+
+    //! Whether the next backup must be stored as a snapshot regardless of the journal size
+    bool backup_compaction_pending_;
+
+    //! Journal size in bytes below which the snapshot is never taken again
+    static constexpr uint64_t min_backup_compaction_size_ = 1024 * 1024;
+
 };
 
 } // namespace rtps
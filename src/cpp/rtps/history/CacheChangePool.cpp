@@ -102,6 +102,8 @@ void CacheChangePool::return_cache_to_pool(
     ch->sourceTimestamp.seconds(0);
     ch->sourceTimestamp.fraction(0);
     ch->setFragmentSize(0);
+    ch->typed_sample.reset();
+    ch->typed_sample_type = nullptr;
     free_caches_.push_back(ch);
 }
 
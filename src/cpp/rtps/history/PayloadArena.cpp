@@ -0,0 +1,209 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadArena.cpp
+ */
+
+#include <rtps/history/PayloadArena.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+#endif // if defined(_WIN32)
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+namespace {
+
+// Buffers start on their own cache line
+constexpr size_t buffer_alignment = 64;
+
+size_t round_up(
+        size_t size,
+        size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+#if !defined(_WIN32)
+// Size of the huge pages assumed when rounding the mapping
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+#endif // if !defined(_WIN32)
+
+#if defined(__linux__) && defined(SYS_mbind)
+bool bind_to_numa_node(
+        void* memory,
+        size_t size,
+        int32_t numa_node)
+{
+    // Same value as MPOL_BIND in numaif.h, which would require libnuma.
+    // The kernel only looks at the first maxnode - 1 bits of the mask.
+    constexpr int mpol_bind = 2;
+    constexpr size_t bits_per_mask = 8 * sizeof(unsigned long);
+
+    unsigned long node_mask[1024 / bits_per_mask] = {};
+    if (numa_node >= 1023)
+    {
+        return false;
+    }
+    node_mask[numa_node / bits_per_mask] = 1ul << (numa_node % bits_per_mask);
+    return 0 == syscall(SYS_mbind, memory, size, mpol_bind, node_mask, 1024ul, 0u);
+}
+
+#elif !defined(_WIN32)
+bool bind_to_numa_node(
+        void*,
+        size_t,
+        int32_t)
+{
+    return false;
+}
+
+#endif // if defined(__linux__) && defined(SYS_mbind)
+
+} // namespace
+
+std::unique_ptr<PayloadArena> PayloadArena::create(
+        uint32_t num_buffers,
+        size_t buffer_size,
+        const PayloadArenaConfig& config)
+{
+    std::unique_ptr<PayloadArena> arena(new PayloadArena());
+    arena->buffer_stride_ = round_up(buffer_size, buffer_alignment);
+    arena->num_buffers_ = num_buffers;
+
+    size_t size = arena->buffer_stride_ * num_buffers;
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    void* memory = nullptr;
+
+#if defined(_WIN32)
+    if (config.huge_pages)
+    {
+        // Large pages require the SeLockMemoryPrivilege, so this fails on most accounts
+        size_t large_page_size = GetLargePageMinimum();
+        if (large_page_size > 0)
+        {
+            size_t large_size = round_up(size, large_page_size);
+            memory = config.numa_node >= 0 ?
+                    VirtualAllocExNuma(GetCurrentProcess(), nullptr, large_size,
+                    MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, static_cast<DWORD>(config.numa_node)) :
+                    VirtualAlloc(nullptr, large_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (memory != nullptr)
+            {
+                size = large_size;
+                arena->huge_pages_ = true;
+            }
+        }
+    }
+
+    if (memory == nullptr)
+    {
+        memory = config.numa_node >= 0 ?
+                VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE,
+                static_cast<DWORD>(config.numa_node)) :
+                VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+
+    if (memory == nullptr)
+    {
+        logWarning(RTPS_HISTORY, "Could not allocate a payload arena of " << size << " bytes");
+        return nullptr;
+    }
+#else
+#if defined(MAP_HUGETLB)
+    if (config.huge_pages)
+    {
+        size_t huge_size = round_up(size, huge_page_size);
+        memory = mmap(nullptr, huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            size = huge_size;
+            arena->huge_pages_ = true;
+        }
+        else
+        {
+            memory = nullptr;
+        }
+    }
+#endif // if defined(MAP_HUGETLB)
+
+    if (memory == nullptr)
+    {
+        if (config.huge_pages)
+        {
+            // Transparent huge pages can only be used on whole huge pages
+            size = round_up(size, huge_page_size);
+        }
+
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+        {
+            logWarning(RTPS_HISTORY, "Could not map a payload arena of " << size << " bytes");
+            return nullptr;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (config.huge_pages)
+        {
+            arena->huge_pages_ = 0 == madvise(memory, size, MADV_HUGEPAGE);
+        }
+#endif // if defined(MADV_HUGEPAGE)
+    }
+
+    // The policy must be set before the pages are touched for the first time
+    if (config.numa_node >= 0 && !bind_to_numa_node(memory, size, config.numa_node))
+    {
+        logWarning(RTPS_HISTORY, "Could not bind the payload arena to NUMA node " << config.numa_node);
+    }
+#endif // if defined(_WIN32)
+
+    if (config.huge_pages && !arena->huge_pages_)
+    {
+        logInfo(RTPS_HISTORY, "Payload arena of " << size << " bytes not backed by huge pages");
+    }
+
+    arena->memory_ = static_cast<octet*>(memory);
+    arena->mapped_size_ = size;
+    return arena;
+}
+
+PayloadArena::~PayloadArena()
+{
+    if (memory_ != nullptr)
+    {
+#if defined(_WIN32)
+        VirtualFree(memory_, 0, MEM_RELEASE);
+#else
+        munmap(memory_, mapped_size_);
+#endif // if defined(_WIN32)
+    }
+}
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
@@ -0,0 +1,116 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadArena.hpp
+ */
+
+#ifndef RTPS_HISTORY_PAYLOADARENA_HPP
+#define RTPS_HISTORY_PAYLOADARENA_HPP
+
+#include <fastdds/rtps/common/Types.h>
+#include <rtps/history/PoolConfig.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Contiguous block of memory from which the payloads preallocated for a history are carved.
+ *
+ * Keeping the payloads together reduces the pages, and thus the TLB entries, touched when serializing and
+ * deserializing. The block is mapped on huge pages and bound to a NUMA node when requested, and falls back to
+ * regular pages when the platform does not allow it.
+ */
+class PayloadArena
+{
+
+public:
+
+    ~PayloadArena();
+
+    PayloadArena(
+            const PayloadArena&) = delete;
+
+    PayloadArena& operator =(
+            const PayloadArena&) = delete;
+
+    /**
+     * Maps a new arena.
+     *
+     * @param [in] num_buffers  Number of buffers the arena should hold
+     * @param [in] buffer_size  Size of each buffer
+     * @param [in] config       Arena settings
+     *
+     * @return The new arena, or nullptr when the memory could not be mapped.
+     */
+    static std::unique_ptr<PayloadArena> create(
+            uint32_t num_buffers,
+            size_t buffer_size,
+            const PayloadArenaConfig& config);
+
+    /**
+     * Carves the next buffer from the arena.
+     *
+     * @return A zeroed buffer of the size given on creation, or nullptr when the arena is exhausted.
+     */
+    octet* allocate()
+    {
+        if (next_buffer_ == num_buffers_)
+        {
+            return nullptr;
+        }
+
+        ++used_buffers_;
+        return memory_ + (next_buffer_++) * buffer_stride_;
+    }
+
+    /**
+     * Informs that a buffer carved from the arena is no longer used.
+     *
+     * @return Whether no buffer of the arena is used any longer.
+     */
+    bool release()
+    {
+        return --used_buffers_ == 0;
+    }
+
+    //! Whether the arena is backed by huge pages
+    bool huge_pages() const
+    {
+        return huge_pages_;
+    }
+
+private:
+
+    PayloadArena() = default;
+
+    octet* memory_ = nullptr;
+    size_t mapped_size_ = 0;
+    size_t buffer_stride_ = 0;
+    uint32_t num_buffers_ = 0;
+    uint32_t next_buffer_ = 0;
+    uint32_t used_buffers_ = 0;
+    bool huge_pages_ = false;
+};
+
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_HISTORY_PAYLOADARENA_HPP
@@ -19,9 +19,16 @@
 #ifndef RTPS_HISTORY_POOLCONFIG_H_
 #define RTPS_HISTORY_POOLCONFIG_H_
 
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/resources/ResourceManagement.h>
 
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -35,6 +42,72 @@ struct BasicPoolConfig
     uint32_t payload_initial_size;
 };
 
+/**
+ * Backing of the payloads preallocated for a history.
+ *
+ * When enabled, the payloads a history preallocates are carved from a single contiguous block of memory,
+ * instead of being allocated one by one.
+ */
+struct PayloadArenaConfig
+{
+    //! Carve the preallocated payloads from a single contiguous block.
+    bool enabled = false;
+
+    //! Back the block with huge pages, when the platform allows it.
+    bool huge_pages = false;
+
+    //! NUMA node the block is bound to. Negative values mean no binding.
+    int32_t numa_node = -1;
+
+    /**
+     * Reads the arena settings from the properties of a DataWriter or DataReader:
+     *   - @c fastdds.payload_arena.enabled: "true" to carve the preallocated payloads from a contiguous block.
+     *   - @c fastdds.payload_arena.huge_pages: "true" to back the block with huge pages. Implies enabled.
+     *   - @c fastdds.payload_arena.numa_node: NUMA node to bind the block to. Implies enabled.
+     *     Values that are not an integer are ignored with a warning.
+     *
+     * @param [in] properties Property policy of the entity
+     *
+     * @return the arena settings found on the properties
+     */
+    static PayloadArenaConfig from_properties(
+            const PropertyPolicy& properties)
+    {
+        PayloadArenaConfig config;
+        for (const Property& property : properties.properties())
+        {
+            if (property.name() == "fastdds.payload_arena.enabled")
+            {
+                config.enabled = config.enabled || property.value() == "true";
+            }
+            else if (property.name() == "fastdds.payload_arena.huge_pages")
+            {
+                config.huge_pages = property.value() == "true";
+                config.enabled = config.enabled || config.huge_pages;
+            }
+            else if (property.name() == "fastdds.payload_arena.numa_node")
+            {
+                const char* value = property.value().c_str();
+                char* end = nullptr;
+                errno = 0;
+                long numa_node = std::strtol(value, &end, 10);
+                if (end == value || *end != '\0' || errno == ERANGE ||
+                        numa_node < std::numeric_limits<int32_t>::min() ||
+                        numa_node > std::numeric_limits<int32_t>::max())
+                {
+                    logWarning(RTPS_HISTORY, "Ignoring invalid value '" << property.value() << "' of property "
+                                                                        << property.name());
+                    continue;
+                }
+                config.numa_node = static_cast<int32_t>(numa_node);
+                config.enabled = config.enabled || config.numa_node >= 0;
+            }
+        }
+        return config;
+    }
+
+};
+
 struct PoolConfig : public BasicPoolConfig
 {
     PoolConfig() = default;
@@ -56,6 +129,9 @@ struct PoolConfig : public BasicPoolConfig
     //! Maximum number of elements in the pool. Default value is 0, indicating to make allocations until they fail.
     uint32_t maximum_size;
 
+    //! Backing of the elements preallocated for the history.
+    PayloadArenaConfig payload_arena;
+
     /**
      * Transform a HistoryAttributes object into a PoolConfig
      *
@@ -42,26 +42,28 @@ bool TopicPayloadPool::do_get_payload(
         CacheChange_t& cache_change,
         bool resizeable)
 {
-    PayloadNode* payload = nullptr;
+    PayloadNode* payload = pop_free();
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    if (payload == nullptr)
     {
-        payload = allocate(size); //Allocates a single payload
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // Some payload may have been returned while waiting for the lock
+        payload = pop_free();
+        if (payload == nullptr)
+        {
+            payload = allocate(size); //Allocates a single payload
+        }
+        lock.unlock();
+
         if (payload == nullptr)
         {
-            lock.unlock();
             cache_change.serializedPayload.data = nullptr;
             cache_change.serializedPayload.max_size = 0;
             cache_change.payload_owner(nullptr);
             return false;
         }
     }
-    else
-    {
-        payload = free_payloads_.back();
-        free_payloads_.pop_back();
-    }
 
     // Resize if needed
     if (resizeable && size > payload->data_size())
@@ -69,8 +71,7 @@ bool TopicPayloadPool::do_get_payload(
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload);
-            lock.unlock();
+            push_free(payload);
             logError(RTPS_HISTORY, "Failed to resize the payload");
 
             cache_change.serializedPayload.data = nullptr;
@@ -80,7 +81,6 @@ bool TopicPayloadPool::do_get_payload(
         }
     }
 
-    lock.unlock();
     payload->reference();
     cache_change.serializedPayload.data = payload->data();
     cache_change.serializedPayload.max_size = payload->data_size();
@@ -138,9 +138,7 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(cache_change.serializedPayload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        push_free(node(PayloadNode::data_index(cache_change.serializedPayload.data)));
     }
 
     cache_change.serializedPayload.length = 0;
@@ -174,10 +172,24 @@ bool TopicPayloadPool::release_history(
     return shrink(max_pool_size_);
 }
 
+size_t TopicPayloadPool::payload_pool_available_size() const
+{
+    // The walk is bounded, as concurrent updates could make it follow a changing chain
+    size_t max_count = allocated_payloads_.load(std::memory_order_relaxed);
+    size_t count = 0;
+    uint32_t index = static_cast<uint32_t>(free_head_.load(std::memory_order_acquire));
+    while (index != no_node && count < max_count)
+    {
+        ++count;
+        index = node(index)->next_free.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
 TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
         uint32_t size)
 {
-    if (all_payloads_.size() >= max_pool_size_)
+    if (allocated_payloads_.load(std::memory_order_relaxed) >= max_pool_size_)
     {
         logWarning(RTPS_HISTORY, "Maximum number of allowed reserved payloads reached");
         return nullptr;
@@ -187,25 +199,125 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
 }
 
 TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
-        uint32_t size)
+        uint32_t size,
+        PayloadArena* arena)
 {
     PayloadNode* payload = nullptr;
 
-    try
+    if (!spare_nodes_.empty())
     {
-        payload = new PayloadNode(size);
+        payload = spare_nodes_.back();
+        spare_nodes_.pop_back();
     }
-    catch (std::bad_alloc& exception)
+    else
     {
-        logWarning(RTPS_HISTORY, "Failure to create a new payload " << exception.what());
+        // Nodes are added to the table, creating a new segment when the last one is full
+        uint32_t index = created_nodes_;
+        if (index == first_segment_size * ((1u << max_node_segments) - 1u))
+        {
+            logWarning(RTPS_HISTORY, "Failure to create a new payload: node table is full");
+            return nullptr;
+        }
+
+        uint32_t segment = 0;
+        uint32_t segment_start = 0;
+        while (index >= segment_start + (first_segment_size << segment))
+        {
+            segment_start += first_segment_size << segment;
+            ++segment;
+        }
+
+        if (index == segment_start)
+        {
+            try
+            {
+                node_segments_[segment].store(new PayloadNode[first_segment_size << segment],
+                        std::memory_order_release);
+            }
+            catch (std::bad_alloc& exception)
+            {
+                logWarning(RTPS_HISTORY, "Failure to create a new payload " << exception.what());
+                return nullptr;
+            }
+        }
+
+        payload = node(index);
+        payload->node_index = index;
+        ++created_nodes_;
+    }
+
+    octet* memory = arena != nullptr ? arena->allocate() : nullptr;
+    if (memory != nullptr)
+    {
+        payload->assign_data(memory, size, arena);
+    }
+    else if (!payload->allocate_data(size))
+    {
+        logWarning(RTPS_HISTORY, "Failure to create a new payload");
+        spare_nodes_.push_back(payload);
         return nullptr;
     }
 
-    payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
-    all_payloads_.push_back(payload);
+    allocated_payloads_.fetch_add(1, std::memory_order_relaxed);
     return payload;
 }
 
+void TopicPayloadPool::deallocate(
+        PayloadNode* payload)
+{
+    PayloadArena* arena = payload->arena;
+    payload->release_data();
+    payload->arena = nullptr;
+    spare_nodes_.push_back(payload);
+
+    // The arena is unmapped when its last payload is freed
+    if (arena != nullptr && arena->release())
+    {
+        for (auto it = arenas_.begin(); it != arenas_.end(); ++it)
+        {
+            if (it->get() == arena)
+            {
+                arenas_.erase(it);
+                break;
+            }
+        }
+    }
+    allocated_payloads_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+TopicPayloadPool::PayloadNode* TopicPayloadPool::pop_free()
+{
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+    while (static_cast<uint32_t>(head) != no_node)
+    {
+        PayloadNode* payload = node(static_cast<uint32_t>(head));
+        uint64_t next = (head & 0xFFFFFFFF00000000ull) + (1ull << 32) +
+                payload->next_free.load(std::memory_order_relaxed);
+
+        // Nodes are never deleted while the pool exists, so reading a stale node is harmless,
+        // and the version on the head prevents the exchange if the node was taken meanwhile.
+        if (free_head_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return payload;
+        }
+    }
+
+    return nullptr;
+}
+
+void TopicPayloadPool::push_free(
+        PayloadNode* first,
+        PayloadNode* last)
+{
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    uint64_t next = 0;
+    do
+    {
+        last->next_free.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        next = (head & 0xFFFFFFFF00000000ull) + (1ull << 32) + first->node_index;
+    } while (!free_head_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
 void TopicPayloadPool::update_maximum_size(
         const PoolConfig& config,
         bool is_reserve)
@@ -246,14 +358,55 @@ void TopicPayloadPool::update_maximum_size(
 
 void TopicPayloadPool::reserve (
         uint32_t min_num_payloads,
-        uint32_t size)
+        uint32_t size,
+        const PayloadArenaConfig& arena_config)
 {
     assert (min_num_payloads <= max_pool_size_);
 
-    for (size_t i = all_payloads_.size(); i < min_num_payloads; ++i)
+    uint32_t allocated = allocated_payloads_.load(std::memory_order_relaxed);
+    if (allocated >= min_num_payloads)
     {
-        PayloadNode* payload = do_allocate(size);
-        free_payloads_.push_back(payload);
+        return;
+    }
+
+    // All the new payloads are carved from a single arena when requested
+    PayloadArena* arena = nullptr;
+    if (arena_config.enabled)
+    {
+        std::unique_ptr<PayloadArena> new_arena = PayloadArena::create(min_num_payloads - allocated,
+                        PayloadNode::buffer_size(size), arena_config);
+        if (new_arena)
+        {
+            arena = new_arena.get();
+            arenas_.push_back(std::move(new_arena));
+        }
+    }
+
+    // New payloads are linked together and returned to the free list at once
+    PayloadNode* first = nullptr;
+    PayloadNode* last = nullptr;
+    for (uint32_t i = allocated; i < min_num_payloads; ++i)
+    {
+        PayloadNode* payload = do_allocate(size, arena);
+        if (payload == nullptr)
+        {
+            break;
+        }
+
+        if (first == nullptr)
+        {
+            last = payload;
+        }
+        else
+        {
+            payload->next_free.store(first->node_index, std::memory_order_relaxed);
+        }
+        first = payload;
+    }
+
+    if (first != nullptr)
+    {
+        push_free(first, last);
     }
 }
 
@@ -262,16 +415,15 @@ bool TopicPayloadPool::shrink (
 {
     assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
 
-    while (max_num_payloads < all_payloads_.size())
+    while (max_num_payloads < allocated_payloads_.load(std::memory_order_relaxed))
     {
-        PayloadNode* payload = free_payloads_.back();
-        free_payloads_.pop_back();
-
-        // Find data in allPayloads, remove element, then delete it
-        all_payloads_.at(payload->data_index()) = all_payloads_.back();
-        all_payloads_.back()->data_index(payload->data_index());
-        all_payloads_.pop_back();
-        delete payload;
+        PayloadNode* payload = pop_free();
+        if (payload == nullptr)
+        {
+            return false;
+        }
+
+        deallocate(payload);
     }
 
     return true;
@@ -25,13 +25,19 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
+#include <rtps/history/PayloadArena.hpp>
 
 #include <atomic>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -41,15 +47,21 @@ class TopicPayloadPool : public ITopicPayloadPool
 
 public:
 
-    TopicPayloadPool() = default;
+    TopicPayloadPool()
+    {
+        for (std::atomic<PayloadNode*>& segment : node_segments_)
+        {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+    }
 
     virtual ~TopicPayloadPool()
     {
         logInfo(RTPS_UTILS, "PayloadPool destructor");
 
-        for (PayloadNode* payload : all_payloads_)
+        for (std::atomic<PayloadNode*>& segment : node_segments_)
         {
-            delete payload;
+            delete[] segment.load(std::memory_order_relaxed);
         }
     }
 
@@ -119,13 +131,16 @@ public:
 
     size_t payload_pool_allocated_size() const override
     {
-        return all_payloads_.size();
+        return allocated_payloads_.load(std::memory_order_relaxed);
     }
 
-    size_t payload_pool_available_size() const override
-    {
-        return free_payloads_.size();
-    }
+    /**
+     * @brief Number of payloads in the free list.
+     *
+     * The free list is walked to count them, so the result is only exact when no payload is being
+     * taken or returned concurrently.
+     */
+    size_t payload_pool_available_size() const override;
 
     static std::unique_ptr<ITopicPayloadPool> get(
             const BasicPoolConfig& config);
@@ -136,26 +151,82 @@ protected:
     {
     public:
 
-        explicit PayloadNode(
+        PayloadNode() = default;
+
+        PayloadNode(
+                const PayloadNode&) = delete;
+
+        PayloadNode& operator =(
+                const PayloadNode&) = delete;
+
+        ~PayloadNode()
+        {
+            release_data();
+        }
+
+        /**
+         * Allocates the buffer of a node that has none.
+         *
+         * @param [IN] size  Size of the payload data
+         * @return Whether the buffer could be allocated.
+         */
+        bool allocate_data(
                 uint32_t size)
         {
             assert(size > 0);
+            assert(buffer == nullptr);
 
-            buffer = (octet*)calloc(size + offsetof(NodeInfo, data), sizeof(octet));
+            buffer = (octet*)calloc(size + data_offset, sizeof(octet));
             if (buffer == nullptr)
             {
-                throw std::bad_alloc();
+                return false;
             }
+            owns_buffer = true;
 
             // The atomic may need some initialization depending on the platform
             new (buffer) NodeInfo();
             data_size(size);
+            data_index(node_index);
+            return true;
         }
 
-        ~PayloadNode()
+        /**
+         * Uses a zeroed buffer carved from an arena, which is not freed with the node data.
+         *
+         * @param [IN] memory      Buffer of at least @c buffer_size(size) bytes
+         * @param [IN] size        Size of the payload data
+         * @param [IN] from_arena  Arena the buffer was carved from
+         */
+        void assign_data(
+                octet* memory,
+                uint32_t size,
+                PayloadArena* from_arena)
         {
-            info().~NodeInfo();
-            free(buffer);
+            assert(buffer == nullptr);
+
+            buffer = memory;
+            owns_buffer = false;
+            arena = from_arena;
+
+            new (buffer) NodeInfo();
+            data_size(size);
+            data_index(node_index);
+        }
+
+        /**
+         * Frees the buffer of the node, which is kept to be reused by another payload.
+         */
+        void release_data()
+        {
+            if (buffer != nullptr)
+            {
+                info().~NodeInfo();
+                if (owns_buffer)
+                {
+                    free(buffer);
+                }
+                buffer = nullptr;
+            }
         }
 
         bool resize (
@@ -163,6 +234,22 @@ protected:
         {
             assert(size > data_size());
 
+            if (!owns_buffer)
+            {
+                // Buffers on an arena cannot grow, so the data moves to the heap
+                octet* new_buffer = (octet*)malloc(size + data_offset);
+                if (!new_buffer)
+                {
+                    return false;
+                }
+                memcpy(new_buffer, buffer, data_offset + data_size());
+                buffer = new_buffer;
+                owns_buffer = true;
+                memset(buffer + data_offset + data_size(), 0, (size - data_size()) * sizeof(octet));
+                data_size(size);
+                return true;
+            }
+
             octet* old_buffer = buffer;
             buffer = (octet*)realloc(buffer, size + data_offset);
             if (!buffer)
@@ -236,6 +323,22 @@ protected:
             return (info(data).ref_counter.fetch_sub(1, std::memory_order_acq_rel) == 1);
         }
 
+        //! Size of the buffer holding a payload of @c size bytes
+        static size_t buffer_size(
+                uint32_t size)
+        {
+            return size + data_offset;
+        }
+
+        //! Position of the node in the node table. It never changes.
+        uint32_t node_index = 0;
+
+        //! Index of the next node in the free list, while this one is on it.
+        std::atomic<uint32_t> next_free{ 0 };
+
+        //! Arena the node was preallocated from, even if its data later moved to the heap.
+        PayloadArena* arena = nullptr;
+
     private:
 
         struct NodeInfo
@@ -247,6 +350,7 @@ protected:
         };
 
         octet* buffer = nullptr;
+        bool owns_buffer = false;
 
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
@@ -277,8 +381,71 @@ protected:
     virtual PayloadNode* allocate(
             uint32_t size);
 
+    /**
+     * Adds a new payload in the pool, without checking the maximum size of the pool.
+     *
+     * @param [IN] size   Minimum size required for the payload data
+     * @param [IN] arena  Arena to carve the payload from. When nullptr or exhausted, the payload
+     *                    is allocated on the heap.
+     * @return The node representing the newly allocated payload.
+     */
     PayloadNode* do_allocate(
-            uint32_t size);
+            uint32_t size,
+            PayloadArena* arena = nullptr);
+
+    /**
+     * Frees the data of a payload and keeps its node to be reused.
+     *
+     * @param [IN] payload  Node of the payload to free. It should not be on the free list.
+     *
+     * @post
+     *   - @c payload_pool_allocated_size() decreases by one
+     */
+    void deallocate(
+            PayloadNode* payload);
+
+    /**
+     * Returns the node on the given position of the node table.
+     *
+     * Nodes are kept on segments whose size doubles with each new segment, so their position never changes
+     * and no lock is needed to find them.
+     */
+    PayloadNode* node(
+            uint32_t index) const
+    {
+        uint32_t segment_number = index / first_segment_size + 1u;
+#if _MSC_VER
+        unsigned long segment;
+        _BitScanReverse(&segment, segment_number);
+#else
+        uint32_t segment = 31u ^ static_cast<uint32_t>(__builtin_clz(segment_number));
+#endif // if _MSC_VER
+        uint32_t segment_start = first_segment_size * ((1u << segment) - 1u);
+        return node_segments_[segment].load(std::memory_order_acquire) + (index - segment_start);
+    }
+
+    /**
+     * Takes a payload from the free list, without locking.
+     *
+     * @return The node of the payload, or nullptr when the free list is empty.
+     */
+    PayloadNode* pop_free();
+
+    /**
+     * Returns a chain of payloads to the free list with a single atomic operation, without locking.
+     *
+     * @param [IN] first  First node of the chain.
+     * @param [IN] last   Last node of the chain, whose @c next_free is overwritten.
+     */
+    void push_free(
+            PayloadNode* first,
+            PayloadNode* last);
+
+    void push_free(
+            PayloadNode* payload)
+    {
+        push_free(payload, payload);
+    }
 
     virtual void update_maximum_size(
             const PoolConfig& config,
@@ -289,6 +456,7 @@ protected:
      *
      * @param [IN] min_num_payloads Minimum number of payloads reserved in the pool
      * @param [IN] size             Size to allocate for the payloads that need to be added to the pool
+     * @param [IN] arena_config     Backing of the payloads that need to be added to the pool
      *
      * @pre
      *   - @c min_num_payloads <= @c max_pool_size_
@@ -297,7 +465,8 @@ protected:
      */
     virtual void reserve (
             uint32_t min_num_payloads,
-            uint32_t size);
+            uint32_t size,
+            const PayloadArenaConfig& arena_config);
 
     /**
      * Ensures the pool has capacity for at most @c num_payloads elements.
@@ -347,9 +516,24 @@ protected:
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
-    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
-    std::vector<PayloadNode*> all_payloads_;  //< All payloads
+    static constexpr uint32_t no_node = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t first_segment_size = 64;
+    static constexpr uint32_t max_node_segments = 26;  //< Enough segments for almost 2^32 nodes
+
+    /**
+     * Top of the free list.
+     * The high half is a version counter changed on every update, so a stale pop never succeeds,
+     * and the low half is the index of the top node, or @c no_node when the list is empty.
+     */
+    std::atomic<uint64_t> free_head_{ no_node };
+
+    std::atomic<PayloadNode*> node_segments_[max_node_segments];  //< Node table
+    std::atomic<uint32_t> allocated_payloads_{ 0 };  //< Nodes with allocated data
+    uint32_t created_nodes_ = 0;               //< Nodes on the node table
+    std::vector<PayloadNode*> spare_nodes_;    //< Nodes without data, ready to be reused
+    std::vector<std::unique_ptr<PayloadArena>> arenas_;  //< Arenas with payloads still allocated
 
+    //! Protects everything but the free list, which is lock-free
     std::mutex mutex_;
 
 };
@@ -44,17 +44,9 @@ public:
         {
             if (PayloadNode::dereference(cache_change.serializedPayload.data))
             {
-                //First remove it from all_payloads
-                std::unique_lock<std::mutex> lock(mutex_);
-                uint32_t data_index = PayloadNode::data_index(cache_change.serializedPayload.data);
-                PayloadNode* payload = all_payloads_.at(data_index);
-                all_payloads_.at(data_index) = all_payloads_.back();
-                all_payloads_.back()->data_index(data_index);
-                all_payloads_.pop_back();
-                lock.unlock();
-
-                // Now delete the data
-                delete(payload);
+                // Data is freed, and the node is kept to be reused by the next payload
+                std::lock_guard<std::mutex> lock(mutex_);
+                deallocate(node(PayloadNode::data_index(cache_change.serializedPayload.data)));
             }
         }
 
@@ -55,7 +55,7 @@ public:
 
         std::lock_guard<std::mutex> lock(mutex_);
         minimum_pool_size_ += config.initial_size;
-        reserve(minimum_pool_size_, min_payload_size_);
+        reserve(minimum_pool_size_, min_payload_size_, config.payload_arena);
         return true;
     }
 
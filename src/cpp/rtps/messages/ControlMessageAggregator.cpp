@@ -0,0 +1,197 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessageAggregator.cpp
+ */
+
+#include "ControlMessageAggregator.hpp"
+#include "../participant/RTPSParticipantImpl.h"
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+// Size of an INFO_DST submessage: submessage header plus GUID prefix
+static constexpr uint32_t info_dst_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12;
+
+// Pending messages are sent from the event thread, which should not block for long on a busy transport
+static constexpr std::chrono::milliseconds max_blocking_time(100);
+
+ControlMessageAggregator::ControlMessageAggregator(
+        RTPSParticipantImpl* participant,
+        uint32_t max_message_size,
+        const std::chrono::microseconds& window)
+    : participant_(participant)
+    , max_message_size_(max_message_size)
+{
+    destinations_.reserve(max_destinations);
+    flush_event_.reset(new TimedEvent(participant_->getEventResource(), [this]()
+            {
+                flush();
+                return false;
+            }, static_cast<double>(window.count()) / 1000.0));
+}
+
+ControlMessageAggregator::~ControlMessageAggregator()
+{
+    flush_event_.reset();
+    flush();
+}
+
+void ControlMessageAggregator::flush()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    for (std::unique_ptr<Destination>& destination : destinations_)
+    {
+        send_nts(*destination);
+    }
+    flush_scheduled_ = false;
+}
+
+bool ControlMessageAggregator::add_nts(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes)
+{
+    // Messages without submessages or destinations are handled by the regular path
+    if (total_bytes <= RTPSMESSAGE_HEADER_SIZE || locators_.empty() || buffers.empty())
+    {
+        return false;
+    }
+
+    uint32_t submessages_size = total_bytes - RTPSMESSAGE_HEADER_SIZE;
+    if (RTPSMESSAGE_HEADER_SIZE + info_dst_size + submessages_size > max_message_size_)
+    {
+        return false;
+    }
+
+    Destination* destination = find_destination_nts();
+    if (nullptr == destination)
+    {
+        return false;
+    }
+
+    // Submessages addressed to any participant do not start with INFO_DST, so the destination of previous
+    // submessages should be reset before them.
+    const NetworkBuffer& first = buffers.front();
+    bool starts_with_info_dst = first.size > RTPSMESSAGE_HEADER_SIZE &&
+            INFO_DST == first.buffer[RTPSMESSAGE_HEADER_SIZE];
+    uint32_t needed_size = submessages_size + (starts_with_info_dst ? 0 : info_dst_size);
+
+    CDRMessage_t& message = destination->message;
+    if (message.length + needed_size > max_message_size_)
+    {
+        send_nts(*destination);
+    }
+
+    if (message.length > RTPSMESSAGE_HEADER_SIZE && !starts_with_info_dst)
+    {
+        RTPSMessageCreator::addSubmessageInfoDST(&message, c_GuidPrefix_Unknown);
+    }
+
+    // Append everything after the RTPS header
+    uint32_t skip = RTPSMESSAGE_HEADER_SIZE;
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        if (buffer.size <= skip)
+        {
+            skip -= buffer.size;
+            continue;
+        }
+
+        uint32_t size = buffer.size - skip;
+        memcpy(&message.buffer[message.pos], buffer.buffer + skip, size);
+        message.pos += size;
+        message.length += size;
+        skip = 0;
+    }
+
+    if (!flush_scheduled_)
+    {
+        flush_scheduled_ = true;
+        flush_event_->restart_timer();
+    }
+
+    return true;
+}
+
+ControlMessageAggregator::Destination* ControlMessageAggregator::find_destination_nts()
+{
+    Destination* empty_destination = nullptr;
+    for (std::unique_ptr<Destination>& destination : destinations_)
+    {
+        if (destination->locators == locators_)
+        {
+            return destination.get();
+        }
+
+        if (nullptr == empty_destination && destination->message.length <= RTPSMESSAGE_HEADER_SIZE)
+        {
+            empty_destination = destination.get();
+        }
+    }
+
+    // Reuse the entry of a set of locators without pending messages
+    if (nullptr == empty_destination)
+    {
+        if (destinations_.size() >= max_destinations)
+        {
+            return nullptr;
+        }
+
+        destinations_.emplace_back(new Destination(max_message_size_));
+        empty_destination = destinations_.back().get();
+        CDRMessage::initCDRMsg(&empty_destination->message);
+        RTPSMessageCreator::addHeader(&empty_destination->message, participant_->getGuid().guidPrefix);
+    }
+
+    empty_destination->locators = locators_;
+    return empty_destination;
+}
+
+void ControlMessageAggregator::send_nts(
+        Destination& destination)
+{
+    CDRMessage_t& message = destination.message;
+    if (message.length <= RTPSMESSAGE_HEADER_SIZE)
+    {
+        return;
+    }
+
+    NetworkBufferList buffers;
+    buffers.emplace_back(message.buffer, message.length);
+    std::chrono::steady_clock::time_point max_blocking_time_point =
+            std::chrono::steady_clock::now() + max_blocking_time;
+    if (!participant_->sendSync(buffers, message.length, Locators(destination.locators.begin()),
+            Locators(destination.locators.end()), max_blocking_time_point))
+    {
+        logWarning(RTPS_OUT, "Max blocking time reached sending coalesced control messages");
+    }
+
+    message.pos = RTPSMESSAGE_HEADER_SIZE;
+    message.length = RTPSMESSAGE_HEADER_SIZE;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,140 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ControlMessageAggregator.hpp
+ */
+
+#ifndef RTPS_MESSAGES_CONTROLMESSAGEAGGREGATOR_HPP
+#define RTPS_MESSAGES_CONTROLMESSAGEAGGREGATOR_HPP
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/network/NetworkBuffer.hpp>
+
+#include <chrono>              // std::chrono
+#include <cstdint>             // uint32_t
+#include <memory>              // std::unique_ptr
+#include <mutex>               // std::mutex
+#include <vector>              // std::vector
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+class TimedEvent;
+
+/**
+ * Coalesces the control messages (HEARTBEAT, ACKNACK, GAP...) that the endpoints of a participant send to the same
+ * destination locators, so they share datagrams instead of each endpoint sending its own.
+ * Messages are held for a short window, and sent together when it expires or when no more of them fit on a datagram.
+ * @ingroup WRITER_MODULE
+ */
+class ControlMessageAggregator
+{
+public:
+
+    //! Maximum number of different sets of destination locators with pending messages.
+    static constexpr size_t max_destinations = 256;
+
+    /**
+     * Construct a ControlMessageAggregator.
+     * @param participant Participant sending the messages.
+     * @param max_message_size Maximum size of the datagrams sent.
+     * @param window Maximum time a message is held before being sent.
+     */
+    ControlMessageAggregator(
+            RTPSParticipantImpl* participant,
+            uint32_t max_message_size,
+            const std::chrono::microseconds& window);
+
+    /**
+     * Sends the pending messages.
+     */
+    ~ControlMessageAggregator();
+
+    /**
+     * Hold a message to be sent together with other control messages to the same destinations.
+     * @param buffers List of slices composing the message, starting with the RTPS header.
+     * @param total_bytes Total size of the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @return false when the message cannot be held and should be sent right away.
+     */
+    template<class LocatorIteratorT>
+    bool add(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        locators_.clear();
+        LocatorIteratorT it = destination_locators_begin;
+        while (it != destination_locators_end)
+        {
+            locators_.push_back(*it);
+            ++it;
+        }
+
+        return add_nts(buffers, total_bytes);
+    }
+
+    /**
+     * Send all the pending messages.
+     */
+    void flush();
+
+private:
+
+    //! Messages pending for a set of destination locators.
+    struct Destination
+    {
+        Destination(
+                uint32_t max_message_size)
+            : message(max_message_size)
+        {
+        }
+
+        std::vector<Locator_t> locators;
+        CDRMessage_t message;
+    };
+
+    bool add_nts(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes);
+
+    Destination* find_destination_nts();
+
+    void send_nts(
+            Destination& destination);
+
+    RTPSParticipantImpl* participant_;
+    uint32_t max_message_size_;
+    std::mutex mutex_;
+    std::vector<Locator_t> locators_;
+    std::vector<std::unique_ptr<Destination>> destinations_;
+    std::unique_ptr<TimedEvent> flush_event_;
+    bool flush_scheduled_ = false;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // RTPS_MESSAGES_CONTROLMESSAGEAGGREGATOR_HPP
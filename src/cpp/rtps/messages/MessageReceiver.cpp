@@ -27,9 +27,15 @@
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 
 #define INFO_SRC_SUBMSG_LENGTH 20
 
@@ -41,10 +47,118 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+namespace {
+
+struct GuidHash
+{
+    std::size_t operator ()(
+            const GUID_t& guid) const
+    {
+        // The last bytes of the prefix are the ones differing between the participants of a host
+        uint32_t prefix_tail;
+        memcpy(&prefix_tail, &guid.guidPrefix.value[8], sizeof(prefix_tail));
+        return (static_cast<std::size_t>(prefix_tail) << 8) ^ std::hash<EntityId_t>()(guid.entityId);
+    }
+
+};
+
+} // namespace
+
+/**
+ * Endpoints a MessageReceiver dispatches messages to.
+ * Tables are not modified once published, so dispatches can use them without locking.
+ */
+struct MessageReceiver::EndpointTable
+{
+    using ReadersByWriter = std::unordered_map<GUID_t, std::vector<RTPSReader*>, GuidHash>;
+
+    //! Number of shards the readers of each writer are split on.
+    static constexpr size_t writer_shards = 64;
+
+    //! Associated writers.
+    std::vector<RTPSWriter*> writers;
+    //! Associated readers, by entity id.
+    std::unordered_map<EntityId_t, std::vector<RTPSReader*>> readers;
+    //! Associated readers accepting messages from writers they are not matched with.
+    std::vector<RTPSReader*> readers_of_unknown_writers;
+    /**
+     * Associated readers, by the GUID of the writers they are matched with.
+     * Shards are shared between tables, so a new table for a (un)matched writer only copies the shard of the writer.
+     */
+    std::array<std::shared_ptr<const ReadersByWriter>, writer_shards> readers_by_writer;
+
+    //! Get the readers matched with a writer, nullptr when there are none.
+    const std::vector<RTPSReader*>* readers_of(
+            const GUID_t& writer_guid) const
+    {
+        const std::shared_ptr<const ReadersByWriter>& shard = readers_by_writer[shard_of(writer_guid)];
+        if (shard)
+        {
+            auto readers = shard->find(writer_guid);
+            if (readers != shard->end())
+            {
+                return &readers->second;
+            }
+        }
+        return nullptr;
+    }
+
+    //! Replace the shard of a writer with a copy of it, which is returned to be modified.
+    ReadersByWriter& copy_shard_of(
+            const GUID_t& writer_guid)
+    {
+        std::shared_ptr<const ReadersByWriter>& shard = readers_by_writer[shard_of(writer_guid)];
+        std::shared_ptr<ReadersByWriter> copy =
+                shard ? std::make_shared<ReadersByWriter>(*shard) : std::make_shared<ReadersByWriter>();
+        shard = copy;
+        return *copy;
+    }
+
+    static size_t shard_of(
+            const GUID_t& writer_guid)
+    {
+        return GuidHash()(writer_guid) % writer_shards;
+    }
+};
+
+/**
+ * Registers a dispatch on the current epoch while it uses the current endpoint table.
+ */
+class MessageReceiver::DispatchGuard
+{
+public:
+
+    explicit DispatchGuard(
+            MessageReceiver& receiver)
+        : receiver_(receiver)
+        , epoch_(receiver.dispatch_epoch_.load())
+    {
+        receiver_.dispatches_[epoch_ & 1u].fetch_add(1);
+        receiver_.current_endpoints_ = receiver_.endpoints_.load();
+    }
+
+    ~DispatchGuard()
+    {
+        receiver_.current_endpoints_ = nullptr;
+        if (1u == receiver_.dispatches_[epoch_ & 1u].fetch_sub(1) && receiver_.has_retired_endpoints_.load())
+        {
+            receiver_.free_retired_endpoints();
+        }
+    }
+
+private:
+
+    MessageReceiver& receiver_;
+    uint32_t epoch_;
+};
+
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
-    : participant_(participant)
+    : endpoints_(new EndpointTable())
+    , has_retired_endpoints_(false)
+    , dispatch_epoch_(0)
+    , participant_(participant)
     , source_version_(c_ProtocolVersion)
     , source_vendor_id_(c_VendorId_Unknown)
     , source_guid_prefix_(c_GuidPrefix_Unknown)
@@ -57,6 +171,9 @@ MessageReceiver::MessageReceiver(
     , crypto_payload_(participant->is_secure() ? rec_buffer_size : 0)
 #endif // if HAVE_SECURITY
 {
+    dispatches_[0] = 0;
+    dispatches_[1] = 0;
+
     (void)rec_buffer_size;
     logInfo(RTPS_MSG_IN, "Created with CDRMessage of size: " << rec_buffer_size);
 
@@ -104,8 +221,14 @@ MessageReceiver::MessageReceiver(
 MessageReceiver::~MessageReceiver()
 {
     logInfo(RTPS_MSG_IN, "");
-    assert(associated_writers_.empty());
-    assert(associated_readers_.empty());
+    EndpointTable* endpoints = endpoints_.load();
+    assert(endpoints->writers.empty());
+    assert(endpoints->readers.empty());
+    delete endpoints;
+    for (EndpointTable* retired : retired_endpoints_)
+    {
+        delete retired;
+    }
 }
 
  #if HAVE_SECURITY
@@ -148,7 +271,7 @@ void MessageReceiver::process_data_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_with_security(
@@ -185,7 +308,7 @@ void MessageReceiver::process_data_fragment_message_with_security(
                 std::swap(change.serializedPayload.length, crypto_payload_.length);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 #endif // if HAVE SECURITY
@@ -199,7 +322,7 @@ void MessageReceiver::process_data_message_without_security(
                 reader->processDataMsg(&change);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::process_data_fragment_message_without_security(
@@ -214,17 +337,18 @@ void MessageReceiver::process_data_fragment_message_without_security(
                 reader->processDataFragMsg(&change, sample_size, fragment_starting_num, fragments_in_submessage);
             };
 
-    findAllReaders(reader_id, process_message);
+    findAllReaders(reader_id, change.writerGUID, process_message);
 }
 
 void MessageReceiver::associateEndpoint(
         Endpoint* to_add)
 {
     std::lock_guard<std::mutex> guard(mtx_);
+    const EndpointTable* endpoints = endpoints_.load();
     if (to_add->getAttributes().endpointKind == WRITER)
     {
         const auto writer = dynamic_cast<RTPSWriter*>(to_add);
-        for (const auto& it : associated_writers_)
+        for (const auto& it : endpoints->writers)
         {
             if (it == writer)
             {
@@ -232,21 +356,17 @@ void MessageReceiver::associateEndpoint(
             }
         }
 
-        associated_writers_.push_back(writer);
+        EndpointTable* new_endpoints = new EndpointTable(*endpoints);
+        new_endpoints->writers.push_back(writer);
+        publish_endpoints_nts(new_endpoints);
     }
     else
     {
         const auto reader = dynamic_cast<RTPSReader*>(to_add);
         const auto entityId = reader->getGuid().entityId;
         // search for set of readers by entity ID
-        const auto readers = associated_readers_.find(entityId);
-        if (readers == associated_readers_.end())
-        {
-            auto vec = std::vector<RTPSReader*>();
-            vec.push_back(reader);
-            associated_readers_.emplace(entityId, vec);
-        }
-        else
+        const auto readers = endpoints->readers.find(entityId);
+        if (readers != endpoints->readers.end())
         {
             for (const auto& it : readers->second)
             {
@@ -255,48 +375,209 @@ void MessageReceiver::associateEndpoint(
                     return;
                 }
             }
+        }
 
-            readers->second.push_back(reader);
+        EndpointTable* new_endpoints = new EndpointTable(*endpoints);
+        new_endpoints->readers[entityId].push_back(reader);
+        // Builtin readers may receive messages from writers before being matched with them
+        if (reader->m_acceptMessagesFromUnkownWriters || reader->m_trustedWriterEntityId != c_EntityId_Unknown ||
+                reader->getGuid().is_builtin())
+        {
+            new_endpoints->readers_of_unknown_writers.push_back(reader);
         }
+        publish_endpoints_nts(new_endpoints);
     }
 }
 
 void MessageReceiver::removeEndpoint(
         Endpoint* to_remove)
 {
-    std::lock_guard<std::mutex> guard(mtx_);
+    std::vector<EndpointTable*> retired;
 
-    if (to_remove->getAttributes().endpointKind == WRITER)
     {
-        auto* var = dynamic_cast<RTPSWriter*>(to_remove);
-        for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
+        std::lock_guard<std::mutex> guard(mtx_);
+        const EndpointTable* endpoints = endpoints_.load();
+        EndpointTable* new_endpoints = nullptr;
+
+        if (to_remove->getAttributes().endpointKind == WRITER)
         {
-            if (*it == var)
+            auto* var = dynamic_cast<RTPSWriter*>(to_remove);
+            auto it = std::find(endpoints->writers.begin(), endpoints->writers.end(), var);
+            if (it != endpoints->writers.end())
             {
-                associated_writers_.erase(it);
-                break;
+                new_endpoints = new EndpointTable(*endpoints);
+                new_endpoints->writers.erase(new_endpoints->writers.begin() + (it - endpoints->writers.begin()));
             }
         }
-    }
-    else
-    {
-        auto readers = associated_readers_.find(to_remove->getGuid().entityId);
-        if (readers != associated_readers_.end())
+        else
         {
             auto* var = dynamic_cast<RTPSReader*>(to_remove);
-            for (auto it = readers->second.begin(); it != readers->second.end(); ++it)
+            auto readers = endpoints->readers.find(var->getGuid().entityId);
+            if (readers != endpoints->readers.end() &&
+                    std::find(readers->second.begin(), readers->second.end(), var) != readers->second.end())
             {
-                if (*it == var)
+                new_endpoints = new EndpointTable(*endpoints);
+
+                std::vector<RTPSReader*>& entity_readers = new_endpoints->readers[var->getGuid().entityId];
+                entity_readers.erase(std::remove(entity_readers.begin(), entity_readers.end(), var),
+                        entity_readers.end());
+                if (entity_readers.empty())
                 {
-                    readers->second.erase(it);
-                    if (readers->second.empty())
+                    new_endpoints->readers.erase(var->getGuid().entityId);
+                }
+
+                std::vector<RTPSReader*>& unknown = new_endpoints->readers_of_unknown_writers;
+                unknown.erase(std::remove(unknown.begin(), unknown.end(), var), unknown.end());
+
+                for (std::shared_ptr<const EndpointTable::ReadersByWriter>& shard : new_endpoints->readers_by_writer)
+                {
+                    bool has_reader = shard && std::any_of(shard->begin(), shard->end(),
+                                    [var](const EndpointTable::ReadersByWriter::value_type& matched)
+                                    {
+                                        return std::find(matched.second.begin(), matched.second.end(), var) !=
+                                        matched.second.end();
+                                    });
+                    if (!has_reader)
                     {
-                        associated_readers_.erase(readers);
+                        continue;
                     }
-                    break;
+
+                    std::shared_ptr<EndpointTable::ReadersByWriter> copy =
+                            std::make_shared<EndpointTable::ReadersByWriter>(*shard);
+                    auto writer_it = copy->begin();
+                    while (writer_it != copy->end())
+                    {
+                        std::vector<RTPSReader*>& matched = writer_it->second;
+                        matched.erase(std::remove(matched.begin(), matched.end(), var), matched.end());
+                        writer_it = matched.empty() ? copy->erase(writer_it) : ++writer_it;
+                    }
+                    shard = copy;
                 }
             }
         }
+
+        if (nullptr == new_endpoints)
+        {
+            return;
+        }
+
+        publish_endpoints_nts(new_endpoints);
+        retired.swap(retired_endpoints_);
+        has_retired_endpoints_.store(false);
+    }
+
+    // The endpoint may be destroyed after returning, so the dispatches that could still be using it are waited for.
+    // The mutex is not held meanwhile, as those dispatches may be waiting for a reader being matched.
+    wait_for_dispatches();
+    for (EndpointTable* table : retired)
+    {
+        delete table;
+    }
+}
+
+void MessageReceiver::add_matched_writer(
+        const RTPSReader* reader,
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    const EndpointTable* endpoints = endpoints_.load();
+
+    auto readers = endpoints->readers.find(reader->getGuid().entityId);
+    if (readers == endpoints->readers.end() ||
+            std::find(readers->second.begin(), readers->second.end(), reader) == readers->second.end())
+    {
+        return;
+    }
+
+    // Readers accepting messages from unknown writers already receive all of them
+    const std::vector<RTPSReader*>& unknown = endpoints->readers_of_unknown_writers;
+    if (std::find(unknown.begin(), unknown.end(), reader) != unknown.end())
+    {
+        return;
+    }
+
+    const std::vector<RTPSReader*>* matched = endpoints->readers_of(writer_guid);
+    if (nullptr != matched && std::find(matched->begin(), matched->end(), reader) != matched->end())
+    {
+        return;
+    }
+
+    EndpointTable* new_endpoints = new EndpointTable(*endpoints);
+    new_endpoints->copy_shard_of(writer_guid)[writer_guid].push_back(const_cast<RTPSReader*>(reader));
+    publish_endpoints_nts(new_endpoints);
+}
+
+void MessageReceiver::remove_matched_writer(
+        const RTPSReader* reader,
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    const EndpointTable* endpoints = endpoints_.load();
+
+    const std::vector<RTPSReader*>* matched = endpoints->readers_of(writer_guid);
+    if (nullptr == matched || std::find(matched->begin(), matched->end(), reader) == matched->end())
+    {
+        return;
+    }
+
+    // Readers check the writers they are matched with, so dispatches still using the old table are harmless
+    EndpointTable* new_endpoints = new EndpointTable(*endpoints);
+    EndpointTable::ReadersByWriter& shard = new_endpoints->copy_shard_of(writer_guid);
+    std::vector<RTPSReader*>& readers = shard[writer_guid];
+    readers.erase(std::remove(readers.begin(), readers.end(), reader), readers.end());
+    if (readers.empty())
+    {
+        shard.erase(writer_guid);
+    }
+    publish_endpoints_nts(new_endpoints);
+}
+
+void MessageReceiver::publish_endpoints_nts(
+        EndpointTable* endpoints)
+{
+    retired_endpoints_.push_back(endpoints_.exchange(endpoints));
+    has_retired_endpoints_.store(true);
+    free_retired_endpoints_nts();
+}
+
+void MessageReceiver::free_retired_endpoints()
+{
+    // Dispatches do not wait for the endpoints to be changed. The next idle dispatch will free them instead.
+    std::unique_lock<std::mutex> lock(mtx_, std::try_to_lock);
+    if (lock.owns_lock())
+    {
+        free_retired_endpoints_nts();
+    }
+}
+
+void MessageReceiver::free_retired_endpoints_nts()
+{
+    // Dispatches register before loading the table, so when none is registered, every dispatch still to come will
+    // use the current table.
+    if (0 == dispatches_[0].load() && 0 == dispatches_[1].load())
+    {
+        for (EndpointTable* retired : retired_endpoints_)
+        {
+            delete retired;
+        }
+        retired_endpoints_.clear();
+        has_retired_endpoints_.store(false);
+    }
+}
+
+void MessageReceiver::wait_for_dispatches()
+{
+    std::lock_guard<std::mutex> guard(synchronize_mtx_);
+
+    // Dispatches in progress are registered on the epoch they read, which may be the current one or the previous one.
+    // The epoch is moved forward before waiting for each of them, so new dispatches never delay the wait.
+    for (int i = 0; i < 2; ++i)
+    {
+        uint32_t epoch = dispatch_epoch_.fetch_add(1);
+        while (0 != dispatches_[epoch & 1u].load())
+        {
+            std::this_thread::yield();
+        }
     }
 }
 
@@ -597,10 +878,12 @@ bool MessageReceiver::readSubmessageHeader(
 
 bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
         const EntityId_t& readerID,
+        const GUID_t& writerGUID,
         RTPSReader*& first_reader)
 {
     first_reader = nullptr;
-    if (associated_readers_.empty())
+    const EndpointTable& endpoints = *current_endpoints_;
+    if (endpoints.readers.empty())
     {
         logWarning(RTPS_MSG_IN, IDSTRING "Data received when NO readers are listening");
         return false;
@@ -608,8 +891,8 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const auto readers = endpoints.readers.find(readerID);
+        if (readers != endpoints.readers.end())
         {
             first_reader = readers->second.front();
             return true;
@@ -617,9 +900,19 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& it : endpoints.readers_of_unknown_writers)
+        {
+            if (it->m_acceptMessagesToUnknownReaders)
+            {
+                first_reader = it;
+                return true;
+            }
+        }
+
+        const std::vector<RTPSReader*>* readers = endpoints.readers_of(writerGUID);
+        if (nullptr != readers)
         {
-            for (const auto& it : readers.second)
+            for (const auto& it : *readers)
             {
                 if (it->m_acceptMessagesToUnknownReaders)
                 {
@@ -630,19 +923,25 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
         }
     }
 
-    logWarning(RTPS_MSG_IN, IDSTRING "No Reader accepts this message (directed to: " << readerID << ")");
+    // Messages to unknown readers reach every participant listening on the locator, matched or not
+    if (readerID != c_EntityId_Unknown)
+    {
+        logWarning(RTPS_MSG_IN, IDSTRING "No Reader accepts this message (directed to: " << readerID << ")");
+    }
     return false;
 }
 
 template<typename Functor>
 void MessageReceiver::findAllReaders(
         const EntityId_t& readerID,
+        const GUID_t& writerGUID,
         const Functor& callback)
 {
+    const EndpointTable& endpoints = *current_endpoints_;
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const auto readers = endpoints.readers.find(readerID);
+        if (readers != endpoints.readers.end())
         {
             for (const auto& it : readers->second)
             {
@@ -652,9 +951,19 @@ void MessageReceiver::findAllReaders(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& it : endpoints.readers_of_unknown_writers)
+        {
+            if (it->m_acceptMessagesToUnknownReaders)
+            {
+                callback(it);
+            }
+        }
+
+        // Other readers only accept messages from the writers they are matched with
+        const std::vector<RTPSReader*>* readers = endpoints.readers_of(writerGUID);
+        if (nullptr != readers)
         {
-            for (const auto& it : readers.second)
+            for (const auto& it : *readers)
             {
                 if (it->m_acceptMessagesToUnknownReaders)
                 {
@@ -669,7 +978,7 @@ bool MessageReceiver::proc_Submsg_Data(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<std::mutex> guard(mtx_);
+    DispatchGuard dispatch(*this);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -710,18 +1019,18 @@ bool MessageReceiver::proc_Submsg_Data(
     EntityId_t readerID;
     valid &= CDRMessage::readEntityId(msg, &readerID);
 
+    CacheChange_t ch;
+    ch.kind = ALIVE;
+    ch.writerGUID.guidPrefix = source_guid_prefix_;
+    valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
+
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
-    if (!willAReaderAcceptMsgDirectedTo(readerID, first_reader))
+    if (!willAReaderAcceptMsgDirectedTo(readerID, ch.writerGUID, first_reader))
     {
         return false;
     }
 
     //FOUND THE READER.
-    //We ask the reader for a cachechange to store the information.
-    CacheChange_t ch;
-    ch.kind = ALIVE;
-    ch.writerGUID.guidPrefix = source_guid_prefix_;
-    valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
 
     //Get sequence number
     valid &= CDRMessage::readSequenceNumber(msg, &ch.sequenceNumber);
@@ -811,7 +1120,7 @@ bool MessageReceiver::proc_Submsg_Data(
     }
 
     logInfo(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
-            associated_readers_.size());
+            current_endpoints_->readers.size());
 
     //Look for the correct reader to add the change
     process_data_message_function_(readerID, ch);
@@ -833,7 +1142,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<std::mutex> guard(mtx_);
+    DispatchGuard dispatch(*this);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -869,17 +1178,17 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     EntityId_t readerID;
     valid &= CDRMessage::readEntityId(msg, &readerID);
 
+    CacheChange_t ch;
+    ch.writerGUID.guidPrefix = source_guid_prefix_;
+    valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
+
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
-    if (!willAReaderAcceptMsgDirectedTo(readerID, first_reader))
+    if (!willAReaderAcceptMsgDirectedTo(readerID, ch.writerGUID, first_reader))
     {
         return false;
     }
 
     //FOUND THE READER.
-    //We ask the reader for a cachechange to store the information.
-    CacheChange_t ch;
-    ch.writerGUID.guidPrefix = source_guid_prefix_;
-    valid &= CDRMessage::readEntityId(msg, &ch.writerGUID.entityId);
 
     //Get sequence number
     valid &= CDRMessage::readSequenceNumber(msg, &ch.sequenceNumber);
@@ -989,7 +1298,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     }
 
     logInfo(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
-            associated_readers_.size());
+            current_endpoints_->readers.size());
     process_data_fragment_message_function_(readerID, ch, sampleSize, fragmentStartingNum, fragmentsInSubmessage);
     ch.serializedPayload.data = nullptr;
 
@@ -1034,9 +1343,9 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
     uint32_t HBCount;
     CDRMessage::readUInt32(msg, &HBCount);
 
-    std::lock_guard<std::mutex> guard(mtx_);
+    DispatchGuard dispatch(*this);
     //Look for the correct reader and writers:
-    findAllReaders(readerGUID.entityId,
+    findAllReaders(readerGUID.entityId, writerGUID,
             [&writerGUID, &HBCount, &firstSN, &lastSN, finalFlag, livelinessFlag](RTPSReader* reader)
             {
                 reader->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag);
@@ -1072,9 +1381,9 @@ bool MessageReceiver::proc_Submsg_Acknack(
     uint32_t Ackcount;
     CDRMessage::readUInt32(msg, &Ackcount);
 
-    std::lock_guard<std::mutex> guard(mtx_);
+    DispatchGuard dispatch(*this);
     //Look for the correct writer to use the acknack
-    for (RTPSWriter* it : associated_writers_)
+    for (RTPSWriter* it : current_endpoints_->writers)
     {
         bool result;
         if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result))
@@ -1087,7 +1396,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
         }
     }
     logInfo(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I loooked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+            << current_endpoints_->writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -1120,8 +1429,8 @@ bool MessageReceiver::proc_Submsg_Gap(
         return false;
     }
 
-    std::lock_guard<std::mutex> guard(mtx_);
-    findAllReaders(readerGUID.entityId,
+    DispatchGuard dispatch(*this);
+    findAllReaders(readerGUID.entityId, writerGUID,
             [&writerGUID, &gapStart, &gapList](RTPSReader* reader)
             {
                 reader->processGapMsg(writerGUID, gapStart, gapList);
@@ -1243,9 +1552,9 @@ bool MessageReceiver::proc_Submsg_NackFrag(
     uint32_t Ackcount;
     CDRMessage::readUInt32(msg, &Ackcount);
 
-    std::lock_guard<std::mutex> guard(mtx_);
+    DispatchGuard dispatch(*this);
     //Look for the correct writer to use the acknack
-    for (RTPSWriter* it : associated_writers_)
+    for (RTPSWriter* it : current_endpoints_->writers)
     {
         bool result;
         if (it->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result))
@@ -1258,7 +1567,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(
         }
     }
     logInfo(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+            << current_endpoints_->writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -132,6 +132,8 @@ RTPSMessageGroup::RTPSMessageGroup(
 #endif // if HAVE_SECURITY
     , max_blocking_time_point_(max_blocking_time_point)
     , send_buffer_(participant->get_send_buffer())
+    , pending_payload_position_(0)
+    , external_payloads_size_(0)
 {
     // Avoid warning when neither SECURITY nor DEBUG is used
     (void)participant;
@@ -176,6 +178,9 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+
+    send_buffer_->external_payloads_.clear();
+    external_payloads_size_ = 0;
 }
 
 void RTPSMessageGroup::flush()
@@ -212,11 +217,35 @@ void RTPSMessageGroup::send()
         }
 #endif // if HAVE_SECURITY
 
-        if (!sender_.send(msgToSend, max_blocking_time_point_))
+        // Interleave the referenced payloads with the rest of the message.
+        // They are never present when the whole message has been encrypted.
+        NetworkBufferList& buffers = send_buffer_->buffers_;
+        buffers.clear();
+        uint32_t total_bytes = msgToSend->length;
+        uint32_t from = 0;
+        if (msgToSend == full_msg_)
+        {
+            for (const RTPSMessageGroup_t::ExternalPayload& external : send_buffer_->external_payloads_)
+            {
+                buffers.emplace_back(&msgToSend->buffer[from], external.position - from);
+                buffers.push_back(external.payload);
+                from = external.position;
+                total_bytes += external.payload.size;
+            }
+        }
+        if (from < msgToSend->length)
+        {
+            buffers.emplace_back(&msgToSend->buffer[from], msgToSend->length - from);
+        }
+
+        bool sent = control_only_ ?
+                sender_.send_control(buffers, total_bytes, max_blocking_time_point_) :
+                sender_.send_slices(buffers, total_bytes, max_blocking_time_point_);
+        if (!sent)
         {
             throw timeout();
         }
-        currentBytesSent_ += msgToSend->length;
+        currentBytesSent_ += total_bytes;
     }
 }
 
@@ -232,6 +261,7 @@ void RTPSMessageGroup::check_and_maybe_flush(
         const GuidPrefix_t& destination_guid_prefix)
 {
     CDRMessage::initCDRMsg(submessage_msg_);
+    pending_payload_ = NetworkBuffer();
 
     if (sender_.destinations_have_changed())
     {
@@ -245,7 +275,7 @@ bool RTPSMessageGroup::insert_submessage(
         const GuidPrefix_t& destination_guid_prefix,
         bool is_big_submessage)
 {
-    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    if (!append_submessage())
     {
         // Retry
         flush();
@@ -258,7 +288,7 @@ bool RTPSMessageGroup::insert_submessage(
             return false;
         }
 
-        if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+        if (!append_submessage())
         {
             logError(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
             return false;
@@ -274,6 +304,48 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+bool RTPSMessageGroup::append_submessage()
+{
+    uint32_t external_size = pending_payload_.size;
+    if (full_msg_->length + external_payloads_size_ + submessage_msg_->length + external_size > full_msg_->max_size)
+    {
+        return false;
+    }
+
+    uint32_t submessage_position = full_msg_->length;
+    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    {
+        return false;
+    }
+
+    if (external_size > 0)
+    {
+        send_buffer_->external_payloads_.push_back({submessage_position + pending_payload_position_,
+                                                    pending_payload_});
+        external_payloads_size_ += external_size;
+        pending_payload_ = NetworkBuffer();
+    }
+
+    return true;
+}
+
+bool RTPSMessageGroup::can_reference_payload(
+        uint32_t payload_size) const
+{
+#if HAVE_SECURITY
+    // Encoding needs the whole payload / submessage / message on a contiguous buffer
+    const security::EndpointSecurityAttributes& sec_attrs = endpoint_->getAttributes().security_attributes();
+    if (sec_attrs.is_payload_protected || sec_attrs.is_submessage_protected ||
+            (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection()))
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    return !copy_payloads_ && payload_size >= min_external_payload_size_ &&
+           send_buffer_->external_payloads_.size() < RTPSMessageGroup_t::max_external_payloads;
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -391,13 +463,24 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
+    // Large payloads are not copied, but sent as a separate slice of the message
+    uint32_t* payload_position = nullptr;
+    if (change_to_add.kind == ALIVE && change_to_add.serializedPayload.data != nullptr &&
+            can_reference_payload(change_to_add.serializedPayload.length))
+    {
+        pending_payload_ = NetworkBuffer(change_to_add.serializedPayload.data,
+                        change_to_add.serializedPayload.length);
+        payload_position = &pending_payload_position_;
+    }
+
     // TODO (Ricardo). Check to create special wrapper.
     bool is_big_submessage;
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
-            readerId, expectsInlineQos, inlineQos, &is_big_submessage))
+            readerId, expectsInlineQos, inlineQos, &is_big_submessage, payload_position))
     {
         logError(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
+        pending_payload_ = NetworkBuffer();
         return false;
     }
     change_to_add.serializedPayload.data = nullptr;
@@ -489,12 +572,23 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    // Large fragments are not copied, but sent as a separate slice of the message
+    uint32_t* payload_position = nullptr;
+    if (change_to_add.kind == ALIVE && change_to_add.serializedPayload.data != nullptr &&
+            can_reference_payload(change_to_add.serializedPayload.length))
+    {
+        pending_payload_ = NetworkBuffer(change_to_add.serializedPayload.data,
+                        change_to_add.serializedPayload.length);
+        payload_position = &pending_payload_position_;
+    }
+
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change, fragment_number,
             change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
-            expectsInlineQos, inlineQos))
+            expectsInlineQos, inlineQos, payload_position))
     {
         logError(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
+        pending_payload_ = NetworkBuffer();
         return false;
     }
     change_to_add.serializedPayload.data = nullptr;
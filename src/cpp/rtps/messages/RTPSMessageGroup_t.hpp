@@ -24,6 +24,9 @@
 #include <fastrtps/rtps/common/CDRMessage_t.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/network/NetworkBuffer.hpp>
+
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -95,8 +98,27 @@ public:
     {
         CDRMessage::initCDRMsg(&rtpsmsg_fullmsg_);
         RTPSMessageCreator::addHeader(&rtpsmsg_fullmsg_, participant_guid);
+
+        external_payloads_.reserve(max_external_payloads);
+        buffers_.reserve(2 * max_external_payloads + 1);
     }
 
+    /**
+     * Maximum number of payloads a message can reference without copying them.
+     * Keeps the number of slices of a message (2 * max_external_payloads + 1) below the iovec limits of the
+     * transports.
+     */
+    static constexpr size_t max_external_payloads = 31;
+
+    //! A payload referenced by rtpsmsg_fullmsg_ but not copied into it.
+    struct ExternalPayload
+    {
+        //! Position of rtpsmsg_fullmsg_ where the payload is inserted.
+        uint32_t position;
+        //! The payload itself.
+        NetworkBuffer payload;
+    };
+
     CDRMessage_t rtpsmsg_submessage_;
 
     CDRMessage_t rtpsmsg_fullmsg_;
@@ -104,6 +126,12 @@ public:
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Payloads referenced by rtpsmsg_fullmsg_, ordered by position.
+    std::vector<ExternalPayload> external_payloads_;
+
+    //! Slices of the message being sent.
+    NetworkBufferList buffers_;
 };
 
 } // namespace rtps
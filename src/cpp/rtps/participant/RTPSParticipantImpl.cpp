@@ -359,6 +359,22 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 #endif // if HAVE_SECURITY
 
+    // Control message coalescing, only when messages are not protected as a whole
+    const std::string* coalescing_window_property = PropertyPolicyHelper::find_property(
+        m_att.properties, "fastdds.control_coalescing.window_us");
+    if (coalescing_window_property != nullptr)
+    {
+        std::chrono::microseconds window(std::strtoul(coalescing_window_property->c_str(), nullptr, 10));
+        bool messages_protected = false;
+#if HAVE_SECURITY
+        messages_protected = security_attributes_.is_rtps_protected;
+#endif // if HAVE_SECURITY
+        if (window.count() > 0 && !messages_protected)
+        {
+            control_aggregator_.reset(new ControlMessageAggregator(this, getMaxMessageSize(), window));
+        }
+    }
+
     mp_builtinProtocols = new BuiltinProtocols();
 
     logInfo(RTPS_PARTICIPANT, "RTPSParticipant \"" << m_att.getName() << "\" with guidPrefix: " << m_guid.guidPrefix);
@@ -435,6 +451,9 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
 {
     disable();
 
+    // Send the control messages still held before the send resources are destroyed
+    control_aggregator_.reset();
+
 #if HAVE_SECURITY
     m_security_manager.destroy();
 #endif // if HAVE_SECURITY
@@ -985,12 +1004,62 @@ bool RTPSParticipantImpl::enableReader(
 void RTPSParticipantImpl::disableReader(
         RTPSReader* reader)
 {
-    m_receiverResourcelistMutex.lock();
+    remove_endpoint_from_receivers(reader);
+}
+
+void RTPSParticipantImpl::add_matched_writer_to_receivers(
+        const RTPSReader* reader,
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
     for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
     {
-        it->mp_receiver->removeEndpoint(reader);
+        it->mp_receiver->add_matched_writer(reader, writer_guid);
+    }
+}
+
+void RTPSParticipantImpl::remove_matched_writer_from_receivers(
+        const RTPSReader* reader,
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+    for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
+    {
+        it->mp_receiver->remove_matched_writer(reader, writer_guid);
+    }
+}
+
+template<typename EndpointType>
+static void add_to_topic_index(
+        std::map<std::string, std::vector<EndpointType*>>& index,
+        const std::string& topic_name,
+        EndpointType* endpoint)
+{
+    std::vector<EndpointType*>& endpoints = index[topic_name];
+    if (std::find(endpoints.begin(), endpoints.end(), endpoint) == endpoints.end())
+    {
+        endpoints.push_back(endpoint);
+    }
+}
+
+template<typename EndpointType>
+static void remove_from_topic_index(
+        std::map<std::string, std::vector<EndpointType*>>& index,
+        const Endpoint* endpoint)
+{
+    for (auto it = index.begin(); it != index.end(); ++it)
+    {
+        auto eit = std::find(it->second.begin(), it->second.end(), endpoint);
+        if (eit != it->second.end())
+        {
+            it->second.erase(eit);
+            if (it->second.empty())
+            {
+                index.erase(it);
+            }
+            return;
+        }
     }
-    m_receiverResourcelistMutex.unlock();
 }
 
 bool RTPSParticipantImpl::registerWriter(
@@ -998,15 +1067,40 @@ bool RTPSParticipantImpl::registerWriter(
         const TopicAttributes& topicAtt,
         const WriterQos& wqos)
 {
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+        add_to_topic_index(m_userWritersByTopic, topicAtt.getTopicName().to_string(), Writer);
+    }
+
     return this->mp_builtinProtocols->addLocalWriter(Writer, topicAtt, wqos);
 }
 
 bool RTPSParticipantImpl::registerReader(
         RTPSReader* reader,
         const TopicAttributes& topicAtt,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const ContentFilterProperty* content_filter)
+{
+    {
+        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+        add_to_topic_index(m_userReadersByTopic, topicAtt.getTopicName().to_string(), reader);
+    }
+
+    return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos, content_filter);
+}
+
+const std::vector<RTPSReader*>* RTPSParticipantImpl::userReadersOnTopic(
+        const std::string& topic_name) const
+{
+    auto it = m_userReadersByTopic.find(topic_name);
+    return it == m_userReadersByTopic.end() ? nullptr : &it->second;
+}
+
+const std::vector<RTPSWriter*>* RTPSParticipantImpl::userWritersOnTopic(
+        const std::string& topic_name) const
 {
-    return this->mp_builtinProtocols->addLocalReader(reader, topicAtt, rqos);
+    auto it = m_userWritersByTopic.find(topic_name);
+    return it == m_userWritersByTopic.end() ? nullptr : &it->second;
 }
 
 bool RTPSParticipantImpl::updateLocalWriter(
@@ -1020,9 +1114,10 @@ bool RTPSParticipantImpl::updateLocalWriter(
 bool RTPSParticipantImpl::updateLocalReader(
         RTPSReader* reader,
         const TopicAttributes& topicAtt,
-        const ReaderQos& rqos)
+        const ReaderQos& rqos,
+        const ContentFilterProperty* content_filter)
 {
-    return this->mp_builtinProtocols->updateLocalReader(reader, topicAtt, rqos);
+    return this->mp_builtinProtocols->updateLocalReader(reader, topicAtt, rqos, content_filter);
 }
 
 /*
@@ -1237,15 +1332,31 @@ void RTPSParticipantImpl::createSenderResources(
     m_network_Factory.build_send_resources(send_resource_list_, locator);
 }
 
-bool RTPSParticipantImpl::deleteUserEndpoint(
-        Endpoint* p_endpoint)
+void RTPSParticipantImpl::remove_endpoint_from_receivers(
+        Endpoint* endpoint)
 {
-    m_receiverResourcelistMutex.lock();
-    for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
+    std::vector<MessageReceiver*> receivers;
     {
-        it->mp_receiver->removeEndpoint(p_endpoint);
+        std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+        for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
+        {
+            receivers.push_back(it->mp_receiver);
+        }
     }
-    m_receiverResourcelistMutex.unlock();
+
+    // Removing an endpoint waits for the messages being dispatched to it. Those may be waiting for a reader that is
+    // adding a matched writer to the receivers, so the list is not kept locked meanwhile.
+    // MessageReceivers are only destroyed with the participant.
+    for (MessageReceiver* receiver : receivers)
+    {
+        receiver->removeEndpoint(endpoint);
+    }
+}
+
+bool RTPSParticipantImpl::deleteUserEndpoint(
+        Endpoint* p_endpoint)
+{
+    remove_endpoint_from_receivers(p_endpoint);
 
     bool found = false, found_in_users = false;
     {
@@ -1261,6 +1372,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
                     break;
                 }
             }
+            remove_from_topic_index(m_userWritersByTopic, p_endpoint);
             for (auto wit = m_allWriterList.begin(); wit != m_allWriterList.end(); ++wit)
             {
                 if ((*wit)->getGuid().entityId == p_endpoint->getGuid().entityId) //Found it
@@ -1283,6 +1395,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
                     break;
                 }
             }
+            remove_from_topic_index(m_userReadersByTopic, p_endpoint);
             for (auto rit = m_allReaderList.begin(); rit != m_allReaderList.end(); ++rit)
             {
                 if ((*rit)->getGuid().entityId == p_endpoint->getGuid().entityId) //Found it
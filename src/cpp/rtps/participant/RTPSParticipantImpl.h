@@ -22,6 +22,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <list>
+#include <map>
 #include <sys/types.h>
 #include <mutex>
 #include <atomic>
@@ -47,6 +48,7 @@
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 
+#include "../messages/ControlMessageAggregator.hpp"
 #include "../messages/RTPSMessageGroup_t.hpp"
 #include "../messages/SendBuffersManager.hpp"
 
@@ -248,7 +250,8 @@ public:
 
     /**
      * Send a message to several locations
-     * @param msg Message to send.
+     * @param buffers List of slices composing the message to send.
+     * @param total_bytes Total size of the message.
      * @param destination_locators_begin Iterator at the first destination locator.
      * @param destination_locators_end Iterator at the end destination locator.
      * @param max_blocking_time_point execution time limit timepoint.
@@ -256,7 +259,8 @@ public:
      */
     template<class LocatorIteratorT>
     bool sendSync(
-            CDRMessage_t* msg,
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
             const LocatorIteratorT& destination_locators_begin,
             const LocatorIteratorT& destination_locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point)
@@ -272,7 +276,7 @@ public:
             {
                 LocatorIteratorT locators_begin = destination_locators_begin;
                 LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                send_resource->send(buffers, total_bytes, &locators_begin, &locators_end,
                         max_blocking_time_point);
             }
         }
@@ -280,6 +284,35 @@ public:
         return ret_code;
     }
 
+    /**
+     * Send a message carrying only control submessages to several locations.
+     * When control message coalescing is enabled the message is held for a short time, and sent together with the
+     * control messages of other endpoints of this participant to the same locations.
+     * @param buffers List of slices composing the message to send.
+     * @param total_bytes Total size of the message.
+     * @param destination_locators_begin Iterator at the first destination locator.
+     * @param destination_locators_end Iterator at the end destination locator.
+     * @param max_blocking_time_point execution time limit timepoint.
+     * @return true if the message has been held, or if at least one locator has been sent.
+     */
+    template<class LocatorIteratorT>
+    bool send_control(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            const LocatorIteratorT& destination_locators_begin,
+            const LocatorIteratorT& destination_locators_end,
+            std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        if (control_aggregator_ &&
+                control_aggregator_->add(buffers, total_bytes, destination_locators_begin, destination_locators_end))
+        {
+            return true;
+        }
+
+        return sendSync(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                       max_blocking_time_point);
+    }
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const
     {
@@ -488,6 +521,10 @@ private:
     std::vector<RTPSWriter*> m_userWriterList;
     //!Reader List
     std::vector<RTPSReader*> m_userReaderList;
+    //!User writers registered on discovery, by topic name
+    std::map<std::string, std::vector<RTPSWriter*>> m_userWritersByTopic;
+    //!User readers registered on discovery, by topic name
+    std::map<std::string, std::vector<RTPSReader*>> m_userReadersByTopic;
     //!Network Factory
     NetworkFactory m_network_Factory;
     //!Async writer thread
@@ -515,6 +552,9 @@ private:
     std::timed_mutex m_send_resources_mutex_;
     fastdds::rtps::SendResourceList send_resource_list_;
 
+    //!Coalesces the control messages of all the endpoints. Only present when enabled through properties.
+    std::unique_ptr<ControlMessageAggregator> control_aggregator_;
+
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
     //!Pointer to the user participant
@@ -559,6 +599,13 @@ private:
     bool createAndAssociateReceiverswithEndpoint(
             Endpoint* pend);
 
+    /**
+     * Remove an endpoint from all the MessageReceivers.
+     * @param endpoint Pointer to the endpoint.
+     */
+    void remove_endpoint_from_receivers(
+            Endpoint* endpoint);
+
     /** Create non-existent SendResources based on the Locator list of the entity
         @param pend - Pointer to the endpoint whose SenderResources are to be created
      */
@@ -746,6 +793,25 @@ public:
     void disableReader(
             RTPSReader* reader);
 
+    /**
+     * Make the MessageReceivers of a reader dispatch to it the messages of a writer addressed to unknown readers.
+     * @param reader Reader matched with the writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void add_matched_writer_to_receivers(
+            const RTPSReader* reader,
+            const GUID_t& writer_guid);
+
+    /**
+     * Make the MessageReceivers of a reader stop dispatching to it the messages of a writer addressed to unknown
+     * readers.
+     * @param reader Reader no longer matched with the writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void remove_matched_writer_from_receivers(
+            const RTPSReader* reader,
+            const GUID_t& writer_guid);
+
     /**
      * Register a Writer in the BuiltinProtocols.
      * @param Writer Pointer to the RTPSWriter.
@@ -763,12 +829,14 @@ public:
      * @param Reader Pointer to the RTPSReader.
      * @param topicAtt TopicAttributes of the Reader.
      * @param rqos ReaderQos.
+     * @param content_filter Optional content filter applied by the reader.
      * @return  True if correctly registered.
      */
     bool registerReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Update local writer QoS
@@ -785,12 +853,14 @@ public:
      * Update local reader QoS
      * @param Reader Reader to update
      * @param rqos New QoS for the reader
+     * @param content_filter Optional content filter applied by the reader.
      * @return True on success
      */
     bool updateLocalReader(
             RTPSReader* Reader,
             const TopicAttributes& topicAtt,
-            const ReaderQos& rqos);
+            const ReaderQos& rqos,
+            const ContentFilterProperty* content_filter = nullptr);
 
     /**
      * Get the participant attributes
@@ -845,6 +915,24 @@ public:
         return m_userWriterList.end();
     }
 
+    /**
+     * Get the user readers registered on a topic.
+     * Should be called with the participant mutex taken.
+     * @param topic_name Name of the topic
+     * @return Pointer to the list of readers on the topic, nullptr if there are none
+     */
+    const std::vector<RTPSReader*>* userReadersOnTopic(
+            const std::string& topic_name) const;
+
+    /**
+     * Get the user writers registered on a topic.
+     * Should be called with the participant mutex taken.
+     * @param topic_name Name of the topic
+     * @return Pointer to the list of writers on the topic, nullptr if there are none
+     */
+    const std::vector<RTPSWriter*>* userWritersOnTopic(
+            const std::string& topic_name) const;
+
     /** Helper function that creates ReceiverResources based on a Locator_t List, possibly mutating
      * some and updating the list. DOES NOT associate endpoints with it.
      * @param Locator_list - Locator list to be used to create the ReceiverResources
@@ -281,6 +281,8 @@ bool StatefulReader::matched_writer_add(
         }
     }
 
+    mp_RTPSParticipant->add_matched_writer_to_receivers(this, wdata.guid());
+
     return true;
 }
 
@@ -354,6 +356,7 @@ bool StatefulReader::matched_writer_remove(
             remove_persistence_guid(wproxy->guid(), wproxy->persistence_guid(), removed_by_lease);
             wproxy->stop();
             matched_writers_pool_.push_back(wproxy);
+            mp_RTPSParticipant->remove_matched_writer_from_receivers(this, writer_guid);
         }
         else
         {
@@ -498,10 +501,15 @@ bool StatefulReader::processDataMsg(
             // Copy metadata to reserved change
             change_to_add->copy_not_memcpy(change);
 
-            // Ask payload pool to copy the payload
+            // Ask payload pool to copy the payload. Writers on this process may hand their sample instead, which is
+            // copied, or serialized when necessary, once it is read.
             IPayloadPool* payload_owner = change->payload_owner();
             ReaderPool* datasharing_pool = dynamic_cast<ReaderPool*>(payload_owner);
-            if (datasharing_pool)
+            if (change->is_typed_only())
+            {
+                assert(nullptr == payload_owner);
+            }
+            else if (datasharing_pool)
             {
                 datasharing_pool->get_payload(change->serializedPayload, payload_owner, *change_to_add);
             }
@@ -523,8 +531,7 @@ bool StatefulReader::processDataMsg(
             if (!change_received(change_to_add, pWP))
             {
                 logInfo(RTPS_MSG_IN, IDSTRING "Change " << change_to_add->sequenceNumber << " not added to history");
-                change_to_add->payload_owner()->release_payload(*change_to_add);
-                change_pool_->release_cache(change_to_add);
+                releaseCache(change_to_add);
                 return false;
             }
         }
@@ -1328,6 +1335,7 @@ void StatefulReader::send_acknack(
     if (!writer->is_on_same_process())
     {
         RTPSMessageGroup group(getRTPSParticipant(), this, sender);
+        group.control_only();
         group.add_acknack(sns, acknack_count_, is_final);
     }
     else if (!is_datasharing_compatible_ || !datasharing_listener_->writer_is_matched(writer->guid()))
@@ -1364,6 +1372,7 @@ void StatefulReader::send_acknack(
     try
     {
         RTPSMessageGroup group(getRTPSParticipant(), this, sender);
+        group.control_only();
         if (!missing_changes.empty() || !heartbeat_was_final)
         {
             GUID_t guid = sender.remote_guids().at(0);
@@ -1416,10 +1425,12 @@ void StatefulReader::send_acknack(
 }
 
 bool StatefulReader::send_sync_nts(
-        CDRMessage_t* message,
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         const Locators& locators_begin,
         const Locators& locators_end,
         std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
-    return mp_RTPSParticipant->sendSync(message, locators_begin, locators_end, max_blocking_time_point);
+    return mp_RTPSParticipant->sendSync(buffers, total_bytes, locators_begin, locators_end,
+                   max_blocking_time_point);
 }
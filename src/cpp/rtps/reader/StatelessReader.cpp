@@ -155,6 +155,8 @@ bool StatelessReader::matched_writer_add(
         }
     }
 
+    mp_RTPSParticipant->add_matched_writer_to_receivers(this, wdata.guid());
+
     return true;
 }
 
@@ -212,6 +214,11 @@ bool StatelessReader::matched_writer_remove(
         }
     }
 
+    if (found)
+    {
+        mp_RTPSParticipant->remove_matched_writer_from_receivers(this, writer_guid);
+    }
+
     return found;
 }
 
@@ -516,10 +523,15 @@ bool StatelessReader::processDataMsg(
         // Copy metadata to reserved change
         change_to_add->copy_not_memcpy(change);
 
-        // Ask payload pool to copy the payload
+        // Ask payload pool to copy the payload. Writers on this process may hand their sample instead, which is
+        // copied, or serialized when necessary, once it is read.
         IPayloadPool* payload_owner = change->payload_owner();
         ReaderPool* datasharing_pool = dynamic_cast<ReaderPool*>(payload_owner);
-        if (datasharing_pool)
+        if (change->is_typed_only())
+        {
+            assert(nullptr == payload_owner);
+        }
+        else if (datasharing_pool)
         {
             datasharing_pool->get_payload(change->serializedPayload, payload_owner, *change_to_add);
         }
@@ -541,8 +553,7 @@ bool StatelessReader::processDataMsg(
         if (!change_received(change_to_add))
         {
             logInfo(RTPS_MSG_IN, IDSTRING "MessageReceiver not add change " << change_to_add->sequenceNumber);
-            change_to_add->payload_owner()->release_payload(*change_to_add);
-            change_pool_->release_cache(change_to_add);
+            releaseCache(change_to_add);
             return false;
         }
     }
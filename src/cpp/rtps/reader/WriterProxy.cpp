@@ -568,8 +568,9 @@ void WriterProxy::update_heartbeat_response_interval(
     heartbeat_response_->update_interval(interval);
 }
 
-bool WriterProxy::send(
-        CDRMessage_t* message,
+bool WriterProxy::send_slices(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     if (is_on_same_process_)
@@ -579,7 +580,25 @@ bool WriterProxy::send(
 
     const ResourceLimitedVector<Locator_t>& remote_locators = remote_locators_shrinked();
 
-    return reader_->send_sync_nts(message,
+    return reader_->send_sync_nts(buffers, total_bytes,
+                   Locators(remote_locators.begin()),
+                   Locators(remote_locators.end()),
+                   max_blocking_time_point);
+}
+
+bool WriterProxy::send_control(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    if (is_on_same_process_)
+    {
+        return true;
+    }
+
+    const ResourceLimitedVector<Locator_t>& remote_locators = remote_locators_shrinked();
+
+    return reader_->getRTPSParticipant()->send_control(buffers, total_bytes,
                    Locators(remote_locators.begin()),
                    Locators(remote_locators.end()),
                    max_blocking_time_point);
@@ -28,13 +28,6 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
-{
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
-}
-
 ResourceEvent::~ResourceEvent()
 {
     // All timer should be unregistered before destroying this object.
@@ -79,21 +72,16 @@ void ResourceEvent::unregister_timer(
             });
 
     bool should_notify = false;
-    std::vector<TimedEventImpl*>::iterator it;
 
     // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
-    if (it != pending_timers_.end())
+    if (remove_pending_nts(event))
     {
-        pending_timers_.erase(it);
         should_notify = true;
     }
 
     // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    if (remove_active_timer(event))
     {
-        active_timers_.erase(it);
         should_notify = true;
     }
 
@@ -138,8 +126,9 @@ void ResourceEvent::notify(
 bool ResourceEvent::register_timer_nts(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    if (event->pending_position_ == TimedEventImpl::invalid_position)
     {
+        event->pending_position_ = pending_timers_.size();
         pending_timers_.push_back(event);
         return true;
     }
@@ -147,6 +136,123 @@ bool ResourceEvent::register_timer_nts(
     return false;
 }
 
+bool ResourceEvent::remove_pending_nts(
+        TimedEventImpl* event)
+{
+    size_t position = event->pending_position_;
+    if (position == TimedEventImpl::invalid_position)
+    {
+        return false;
+    }
+
+    // Order of pending events is not relevant, so the last one takes the place of the removed one
+    TimedEventImpl* last = pending_timers_.back();
+    pending_timers_[position] = last;
+    last->pending_position_ = position;
+    pending_timers_.pop_back();
+    event->pending_position_ = TimedEventImpl::invalid_position;
+    return true;
+}
+
+void ResourceEvent::schedule_timer(
+        TimedEventImpl* event,
+        const std::chrono::steady_clock::time_point& trigger_time)
+{
+    size_t position = event->active_position_;
+    if (position == TimedEventImpl::invalid_position)
+    {
+        active_timers_.push_back({trigger_time, event});
+        event->active_position_ = active_timers_.size() - 1;
+        sift_up(active_timers_.size() - 1);
+    }
+    else
+    {
+        std::chrono::steady_clock::time_point previous_time = active_timers_[position].trigger_time;
+        active_timers_[position].trigger_time = trigger_time;
+        if (trigger_time < previous_time)
+        {
+            sift_up(position);
+        }
+        else
+        {
+            sift_down(position);
+        }
+    }
+}
+
+bool ResourceEvent::remove_active_timer(
+        TimedEventImpl* event)
+{
+    size_t position = event->active_position_;
+    if (position == TimedEventImpl::invalid_position)
+    {
+        return false;
+    }
+
+    event->active_position_ = TimedEventImpl::invalid_position;
+    ActiveTimer last = active_timers_.back();
+    active_timers_.pop_back();
+    if (position < active_timers_.size())
+    {
+        // The last entry takes the place of the removed one, and may need to go either way
+        place_active_timer(position, last);
+        sift_up(position);
+        sift_down(last.event->active_position_);
+    }
+    return true;
+}
+
+void ResourceEvent::sift_up(
+        size_t position)
+{
+    ActiveTimer timer = active_timers_[position];
+    while (position > 0)
+    {
+        size_t parent = (position - 1) / 2;
+        if (!(timer.trigger_time < active_timers_[parent].trigger_time))
+        {
+            break;
+        }
+        place_active_timer(position, active_timers_[parent]);
+        position = parent;
+    }
+    place_active_timer(position, timer);
+}
+
+void ResourceEvent::sift_down(
+        size_t position)
+{
+    ActiveTimer timer = active_timers_[position];
+    size_t size = active_timers_.size();
+    while (true)
+    {
+        size_t child = 2 * position + 1;
+        if (child >= size)
+        {
+            break;
+        }
+        if (child + 1 < size && active_timers_[child + 1].trigger_time < active_timers_[child].trigger_time)
+        {
+            ++child;
+        }
+        if (!(active_timers_[child].trigger_time < timer.trigger_time))
+        {
+            break;
+        }
+        place_active_timer(position, active_timers_[child]);
+        position = child;
+    }
+    place_active_timer(position, timer);
+}
+
+void ResourceEvent::place_active_timer(
+        size_t position,
+        const ActiveTimer& timer)
+{
+    active_timers_[position] = timer;
+    timer.event->active_position_ = position;
+}
+
 void ResourceEvent::event_service()
 {
     while (!stop_.load())
@@ -177,7 +283,7 @@ void ResourceEvent::event_service()
         std::chrono::steady_clock::time_point next_trigger =
                 active_timers_.empty() ?
                 current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+                active_timers_[0].trigger_time;
 
         cv_.wait_until(lock, next_trigger);
 
@@ -187,11 +293,6 @@ void ResourceEvent::event_service()
     }
 }
 
-void ResourceEvent::sort_timers()
-{
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
-}
-
 void ResourceEvent::update_current_time()
 {
     current_time_ = std::chrono::steady_clock::now();
@@ -202,65 +303,47 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
     {
         std::lock_guard<TimedMutex> lock(mutex_);
         for (TimedEventImpl* tp : pending_timers_)
         {
-            // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
+            tp->pending_position_ = TimedEventImpl::invalid_position;
 
             // Update timer info
             if (tp->update(current_time_, cancel_time))
             {
-                // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                // Timer has to be activated: add to active timers, or move it to its new position
+                schedule_timer(tp, tp->next_trigger_time());
+            }
+            else
+            {
+                remove_active_timer(tp);
             }
         }
         pending_timers_.clear();
     }
 
-    // Trigger active timers
-    for (TimedEventImpl* tp : active_timers_)
+    // Take expired timers out of the heap, so each one is triggered at most once on each iteration
+    while (!active_timers_.empty() && active_timers_[0].trigger_time <= current_time_)
     {
-        if (tp->next_trigger_time() <= current_time_)
-        {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
-        }
-        else
-        {
-            break;
-        }
+        TimedEventImpl* tp = active_timers_[0].event;
+        remove_active_timer(tp);
+        expired_timers_.push_back(tp);
     }
 
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
+    // Trigger expired timers, scheduling again the ones that were restarted
+    for (TimedEventImpl* tp : expired_timers_)
     {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-            {
-                (void)b;
-                return a->next_trigger_time() < cancel_time;
-            }),
-            active_timers_.end()
-            );
+        tp->trigger(current_time_, cancel_time);
+
+        std::chrono::steady_clock::time_point next_trigger = tp->next_trigger_time();
+        if (next_trigger < cancel_time)
+        {
+            schedule_timer(tp, next_trigger);
+        }
     }
+    expired_timers_.clear();
 }
 
 void ResourceEvent::init_thread()
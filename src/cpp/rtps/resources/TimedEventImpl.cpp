@@ -29,6 +29,8 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+constexpr size_t TimedEventImpl::invalid_position;
+
 TimedEventImpl::TimedEventImpl(
         Callback callback,
         std::chrono::microseconds interval)
@@ -26,6 +26,7 @@
 #include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <atomic>
+#include <limits>
 #include <thread>
 #include <memory>
 #include <functional>
@@ -153,6 +154,17 @@ public:
 
 private:
 
+    friend class ResourceEvent;
+
+    //! Position value of an event which is not on a ResourceEvent collection.
+    static constexpr size_t invalid_position = std::numeric_limits<size_t>::max();
+
+    //! Position of this event on the pending collection of ResourceEvent. Protected by the mutex of ResourceEvent.
+    size_t pending_position_ = invalid_position;
+
+    //! Position of this event on the active timers heap of ResourceEvent. Protected as that collection.
+    size_t active_position_ = invalid_position;
+
     //! Expiration time in microseconds of the event.
     std::chrono::microseconds interval_microsec_;
 
@@ -17,14 +17,66 @@
 #include <fastdds/rtps/transport/UDPChannelResource.h>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <cerrno>
+#include <cstring>
+#endif // if defined(__linux__)
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
 using Locator_t = fastrtps::rtps::Locator_t;
+using CDRMessage_t = fastrtps::rtps::CDRMessage_t;
 using octet = fastrtps::rtps::octet;
 using Log = fastdds::dds::Log;
 
+struct UDPChannelResource::ReceiveBatch
+{
+    ReceiveBatch(
+            uint32_t batch_size,
+            uint32_t max_msg_size)
+    {
+        buffers.reserve(batch_size);
+        endpoints.resize(batch_size);
+        for (uint32_t i = 0; i < batch_size; ++i)
+        {
+            buffers.emplace_back(max_msg_size);
+        }
+
+#if defined(__linux__)
+        iovecs.resize(batch_size);
+        headers.resize(batch_size);
+        for (uint32_t i = 0; i < batch_size; ++i)
+        {
+            iovecs[i].iov_base = buffers[i].buffer;
+            iovecs[i].iov_len = buffers[i].max_size;
+
+            msghdr& hdr = headers[i].msg_hdr;
+            memset(&hdr, 0, sizeof(hdr));
+            hdr.msg_name = endpoints[i].data();
+            hdr.msg_namelen = static_cast<socklen_t>(endpoints[i].capacity());
+            hdr.msg_iov = &iovecs[i];
+            hdr.msg_iovlen = 1;
+            headers[i].msg_len = 0;
+        }
+#endif // if defined(__linux__)
+    }
+
+    //! Reception ring. One buffer per datagram.
+    std::vector<CDRMessage_t> buffers;
+    //! Source of each datagram on the ring.
+    std::vector<asio::ip::udp::endpoint> endpoints;
+#if defined(__linux__)
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> headers;
+#endif // if defined(__linux__)
+};
+
 UDPChannelResource::UDPChannelResource(
         UDPTransportInterface* transport,
         eProsimaUDPSocket& socket,
@@ -39,6 +91,16 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
+#if defined(__linux__)
+    uint32_t batch_size = transport->configuration()->receive_batch_size;
+    if (batch_size > 1)
+    {
+        batch_.reset(new ReceiveBatch(batch_size, maxMsgSize));
+        thread(std::thread(&UDPChannelResource::perform_batched_listen_operation, this, locator));
+        return;
+    }
+#endif // if defined(__linux__)
+
     thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
 }
 
@@ -74,6 +136,86 @@ void UDPChannelResource::perform_listen_operation(Locator_t input_locator)
     message_receiver(nullptr);
 }
 
+void UDPChannelResource::perform_batched_listen_operation(
+        Locator_t input_locator)
+{
+    Locator_t remote_locator;
+
+    while (alive())
+    {
+        // Blocking receive of up to batch size datagrams.
+        size_t received = receive_batch();
+
+        for (size_t i = 0; i < received && alive(); ++i)
+        {
+            CDRMessage_t& msg = batch_->buffers[i];
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (msg.length == 0 || (msg.length == 13 && memcmp(msg.buffer, "EPRORTPSCLOSE", 13) == 0))
+            {
+                continue;
+            }
+
+            transport_->endpoint_to_locator(batch_->endpoints[i], remote_locator);
+
+            // Processes the data through the CDR Message interface.
+            if (message_receiver() != nullptr)
+            {
+                message_receiver()->OnDataReceived(msg.buffer, msg.length, input_locator, remote_locator);
+            }
+            else if (alive())
+            {
+                logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+            }
+        }
+    }
+
+    message_receiver(nullptr);
+}
+
+size_t UDPChannelResource::receive_batch()
+{
+#if defined(__linux__)
+    const unsigned int batch_size = static_cast<unsigned int>(batch_->headers.size());
+    for (unsigned int i = 0; i < batch_size; ++i)
+    {
+        // Kernel overwrites the address length on each call.
+        batch_->headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(batch_->endpoints[i].capacity());
+    }
+
+    // MSG_WAITFORONE: block until the first datagram arrives, then just take the ones already queued.
+    int received = recvmmsg(socket()->native_handle(), batch_->headers.data(), batch_size, MSG_WAITFORONE,
+                    nullptr);
+    if (received <= 0)
+    {
+        if (received < 0 && errno != EINTR && alive())
+        {
+            logWarning(RTPS_MSG_IN, "Error receiving data: " << strerror(errno) << " - " << message_receiver()
+                << " (" << this << ")");
+        }
+        return 0;
+    }
+
+    for (int i = 0; i < received; ++i)
+    {
+        batch_->buffers[i].length = batch_->headers[i].msg_len;
+        batch_->endpoints[i].resize(batch_->headers[i].msg_hdr.msg_namelen);
+
+        // A datagram larger than its buffer is cut by the kernel, and would be parsed as a corrupt message
+        if (0 != (batch_->headers[i].msg_hdr.msg_flags & MSG_TRUNC))
+        {
+            logWarning(RTPS_MSG_IN, "Discarding datagram larger than " << batch_->buffers[i].max_size << " bytes"
+                                                                       << " (" << this << ")");
+            batch_->buffers[i].length = 0;
+        }
+    }
+
+    return static_cast<size_t>(received);
+#else
+    return 0;
+#endif // if defined(__linux__)
+}
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
@@ -50,6 +50,25 @@ class UDPSenderResource : public fastrtps::rtps::SenderResource
                         return transport.send(data, dataSize, socket_, destination_locators_begin,
                                     destination_locators_end, only_multicast_purpose_, max_blocking_time_point);
                     };
+
+            send_buffers_lambda_ = [this, &transport] (
+                const fastrtps::rtps::NetworkBufferList& buffers,
+                uint32_t total_bytes,
+                fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+                fastrtps::rtps::LocatorsIterator* destination_locators_end,
+                const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
+                    {
+                        // Sender resources are used under the participant's send lock, so the asio buffer
+                        // sequence can be reused between calls.
+                        asio_buffers_.clear();
+                        for (const fastrtps::rtps::NetworkBuffer& slice : buffers)
+                        {
+                            asio_buffers_.emplace_back(slice.buffer, slice.size);
+                        }
+
+                        return transport.send(asio_buffers_, total_bytes, socket_, destination_locators_begin,
+                                    destination_locators_end, only_multicast_purpose_, max_blocking_time_point);
+                    };
         }
 
         virtual ~UDPSenderResource()
@@ -83,6 +102,8 @@ class UDPSenderResource : public fastrtps::rtps::SenderResource
         eProsimaUDPSocket socket_;
 
         bool only_multicast_purpose_;
+
+        std::vector<asio::const_buffer> asio_buffers_;
 };
 
 } // namespace rtps
@@ -24,6 +24,18 @@
 #include <cstring>
 #include <algorithm>
 #include <chrono>
+#include <limits>
+#include <thread>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <errno.h>
+#endif // ifndef _WIN32
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif // if defined(__linux__)
 
 using namespace std;
 using namespace asio;
@@ -43,6 +55,81 @@ using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
 using Log = fastdds::dds::Log;
 
+static bool is_would_block(
+        const asio::error_code& ec)
+{
+    return (ec.value() == asio::error::would_block) || (ec.value() == asio::error::try_again);
+}
+
+#ifndef _WIN32
+/**
+ * Waits for a socket to become writable.
+ *
+ * poll() may report the socket as writable while the datagram still does not fit in the free space of its buffer.
+ * When the send has already been retried, the wait backs off before polling again, doubling the delay on each retry
+ * up to 1 ms, so that such a socket does not make the sending thread spin until the time point.
+ *
+ * @param fd Native handle of the socket.
+ * @param max_blocking_time_point Time point until which the wait can block.
+ * @param retries Number of times the socket was already reported as writable without the send going through.
+ * @return true when the socket is writable, false when the time point is reached first.
+ */
+static bool wait_writable(
+        int fd,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point,
+        uint32_t retries)
+{
+    if (retries > 0)
+    {
+        auto backoff = std::chrono::microseconds(std::min<int64_t>(int64_t(10) << std::min<uint32_t>(retries, 7),
+                        1000));
+        auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+            max_blocking_time_point - std::chrono::steady_clock::now());
+        std::this_thread::sleep_for(std::min(backoff, remaining));
+    }
+
+    for (;;)
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+            max_blocking_time_point - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+        {
+            return false;
+        }
+
+        struct pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLOUT;
+        pfd.revents = 0;
+        int timeout_ms = static_cast<int>(std::min<int64_t>((remaining.count() + 999) / 1000,
+                std::numeric_limits<int>::max()));
+        int ret = ::poll(&pfd, 1, timeout_ms);
+        if (ret > 0)
+        {
+            return true;
+        }
+        if (ret < 0 && errno != EINTR)
+        {
+            return false;
+        }
+    }
+}
+
+#endif // ifndef _WIN32
+
+struct UDPTransportInterface::SendBatch
+{
+    //! Supported destinations of the datagram being sent.
+    std::vector<Locator_t> locators;
+#if defined(__linux__)
+    //! Destination endpoints, referenced by the message headers.
+    std::vector<asio::ip::udp::endpoint> endpoints;
+    //! Slices of the datagram. They are shared by all the message headers.
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> headers;
+#endif // if defined(__linux__)
+};
+
 struct MultiUniLocatorsLinkage
 {
     MultiUniLocatorsLinkage(
@@ -67,6 +154,8 @@ UDPTransportDescriptor::UDPTransportDescriptor(
         const UDPTransportDescriptor& t)
     : SocketTransportDescriptor(t)
     , m_output_udp_socket(t.m_output_udp_socket)
+    , non_blocking_send(t.non_blocking_send)
+    , receive_batch_size(t.receive_batch_size)
 {
 }
 
@@ -75,6 +164,11 @@ UDPTransportInterface::UDPTransportInterface(
     : TransportInterface(transport_kind)
     , mSendBufferSize(0)
     , mReceiveBufferSize(0)
+    , dropped_would_block_(0)
+    , blocked_sends_(0)
+    , fan_out_calls_(0)
+    , fan_out_datagrams_(0)
+    , fan_out_max_batch_(0)
 {
 }
 
@@ -82,6 +176,17 @@ UDPTransportInterface::~UDPTransportInterface()
 {
 }
 
+UDPSendStatistics UDPTransportInterface::get_send_statistics() const
+{
+    UDPSendStatistics statistics;
+    statistics.dropped_would_block = dropped_would_block_.load(std::memory_order_relaxed);
+    statistics.blocked_sends = blocked_sends_.load(std::memory_order_relaxed);
+    statistics.fan_out_calls = fan_out_calls_.load(std::memory_order_relaxed);
+    statistics.fan_out_datagrams = fan_out_datagrams_.load(std::memory_order_relaxed);
+    statistics.fan_out_max_batch = fan_out_max_batch_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 void UDPTransportInterface::clean()
 {
     assert(mInputSockets.size() == 0);
@@ -258,7 +363,13 @@ eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
     }
     getSocketPtr(socket)->set_option(ip::multicast::hops(configuration()->TTL));
     getSocketPtr(socket)->bind(endpoint);
+#ifndef _WIN32
+    // Output sockets never block inside the kernel. Blocking sends wait for the socket to become writable
+    // with poll(), bounded by the maximum blocking time of the send.
+    getSocketPtr(socket)->non_blocking(true);
+#else
     getSocketPtr(socket)->non_blocking(configuration()->non_blocking_send);
+#endif // ifndef _WIN32
 
     if (port == 0)
     {
@@ -468,32 +579,189 @@ bool UDPTransportInterface::send(
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         bool only_multicast_purpose,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send_to_locators(asio::buffer(send_buffer, send_buffer_size), send_buffer_size, socket,
+                   destination_locators_begin, destination_locators_end, only_multicast_purpose,
+                   max_blocking_time_point);
+}
+
+bool UDPTransportInterface::send(
+        const std::vector<asio::const_buffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send_to_locators(buffers, total_bytes, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, max_blocking_time_point);
+}
+
+template<typename ConstBufferSequence>
+bool UDPTransportInterface::send_to_locators(
+        const ConstBufferSequence& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
     bool ret = true;
 
-    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
-        max_blocking_time_point - std::chrono::steady_clock::now());
+    // Reused by all the sends of the calling thread, so concurrent sends do not contend on it
+    static thread_local SendBatch batch;
 
+    std::vector<Locator_t>& locators = batch.locators;
+    locators.clear();
     while (it != *destination_locators_end)
     {
         if (IsLocatorSupported(*it))
         {
-            ret &= send(send_buffer,
-                            send_buffer_size,
-                            socket,
-                            *it,
-                            only_multicast_purpose,
-                            time_out);
+            locators.push_back(*it);
         }
 
         ++it;
     }
 
+#if defined(__linux__)
+    // Several destinations: send them all the datagram with a single system call.
+    if (locators.size() > 1)
+    {
+        std::vector<iovec>& iovecs = batch.iovecs;
+        iovecs.clear();
+        for (const asio::const_buffer& buffer : buffers)
+        {
+            iovec slice;
+            slice.iov_base = const_cast<void*>(asio::buffer_cast<const void*>(buffer));
+            slice.iov_len = asio::buffer_size(buffer);
+            iovecs.push_back(slice);
+        }
+
+        return send_fan_out(batch, total_bytes, socket, only_multicast_purpose, max_blocking_time_point);
+    }
+#endif // if defined(__linux__)
+
+    for (const Locator_t& locator : locators)
+    {
+        ret &= send_to_locator(buffers,
+                        total_bytes,
+                        socket,
+                        locator,
+                        only_multicast_purpose,
+                        max_blocking_time_point);
+    }
+
     return ret;
 }
 
+#if defined(__linux__)
+bool UDPTransportInterface::send_fan_out(
+        SendBatch& batch,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    if (total_bytes > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    bool ret = true;
+
+    batch.endpoints.clear();
+    for (const Locator_t& locator : batch.locators)
+    {
+        if (IPLocator::isMulticast(locator) || !only_multicast_purpose)
+        {
+            batch.endpoints.push_back(generate_endpoint(locator, IPLocator::getPhysicalPort(locator)));
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    size_t count = batch.endpoints.size();
+    batch.headers.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        msghdr& hdr = batch.headers[i].msg_hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.msg_name = batch.endpoints[i].data();
+        hdr.msg_namelen = static_cast<socklen_t>(batch.endpoints[i].size());
+        hdr.msg_iov = batch.iovecs.data();
+        hdr.msg_iovlen = batch.iovecs.size();
+        batch.headers[i].msg_len = 0;
+    }
+
+    int fd = getSocketPtr(socket)->native_handle();
+    bool has_blocked = false;
+    uint32_t retries = 0;
+    size_t sent = 0;
+
+    while (sent < count)
+    {
+        int n = ::sendmmsg(fd, &batch.headers[sent], static_cast<unsigned int>(count - sent), 0);
+        if (n > 0)
+        {
+            uint64_t batch_size = static_cast<uint64_t>(n);
+            ++fan_out_calls_;
+            fan_out_datagrams_ += batch_size;
+            uint64_t max_batch = fan_out_max_batch_.load(std::memory_order_relaxed);
+            while (batch_size > max_batch && !fan_out_max_batch_.compare_exchange_weak(max_batch, batch_size))
+            {
+            }
+
+            sent += batch_size;
+            retries = 0;
+            continue;
+        }
+
+        if (errno == EINTR)
+        {
+            continue;
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (!configuration()->non_blocking_send)
+            {
+                if (!has_blocked)
+                {
+                    ++blocked_sends_;
+                    has_blocked = true;
+                }
+
+                if (wait_writable(fd, max_blocking_time_point, retries++))
+                {
+                    continue;
+                }
+            }
+
+            dropped_would_block_ += count - sent;
+            logWarning(RTPS_MSG_OUT, "UDP send would have blocked. " << count - sent << " packets are dropped.");
+            break;
+        }
+
+        // The datagram to this destination failed. Skip it and go on with the rest.
+        logWarning(RTPS_MSG_OUT, "UDPTransport error sending to " << batch.endpoints[sent] << ": " << strerror(errno));
+        ret = false;
+        ++sent;
+    }
+
+    logInfo(RTPS_MSG_OUT, "UDPTransport: " << total_bytes << " bytes TO " << sent << " endpoints FROM "
+                                           << getSocketPtr(socket)->local_endpoint());
+
+    return ret;
+}
+
+#endif // if defined(__linux__)
+
 bool UDPTransportInterface::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -502,7 +770,20 @@ bool UDPTransportInterface::send(
         bool only_multicast_purpose,
         const std::chrono::microseconds& timeout)
 {
-    if (send_buffer_size > configuration()->sendBufferSize)
+    return send_to_locator(asio::buffer(send_buffer, send_buffer_size), send_buffer_size, socket, remote_locator,
+                   only_multicast_purpose, std::chrono::steady_clock::now() + timeout);
+}
+
+template<typename ConstBufferSequence>
+bool UDPTransportInterface::send_to_locator(
+        const ConstBufferSequence& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const fastrtps::rtps::Locator_t& remote_locator,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    if (total_bytes > configuration()->sendBufferSize)
     {
         return false;
     }
@@ -518,23 +799,27 @@ bool UDPTransportInterface::send(
 
         try
         {
-            (void)timeout;
+            asio::error_code ec;
+            bytesSent = getSocketPtr(socket)->send_to(buffers, destinationEndpoint, 0, ec);
 #ifndef _WIN32
-            struct timeval timeStruct;
-            timeStruct.tv_sec = 0;
-            timeStruct.tv_usec = timeout.count() > 0 ? timeout.count() : 0;
-            setsockopt(getSocketPtr(socket)->native_handle(), SOL_SOCKET, SO_SNDTIMEO,
-                    reinterpret_cast<const char*>(&timeStruct), sizeof(timeStruct));
+            if (is_would_block(ec) && !configuration()->non_blocking_send)
+            {
+                ++blocked_sends_;
+                uint32_t retries = 0;
+                while (is_would_block(ec) &&
+                        wait_writable(getSocketPtr(socket)->native_handle(), max_blocking_time_point, retries++))
+                {
+                    bytesSent = getSocketPtr(socket)->send_to(buffers, destinationEndpoint, 0, ec);
+                }
+            }
+#else
+            (void)max_blocking_time_point;
 #endif // ifndef _WIN32
-
-            asio::error_code ec;
-            bytesSent = getSocketPtr(socket)->send_to(asio::buffer(send_buffer,
-                            send_buffer_size), destinationEndpoint, 0, ec);
             if (!!ec)
             {
-                if ((ec.value() == asio::error::would_block) ||
-                        (ec.value() == asio::error::try_again))
+                if (is_would_block(ec))
                 {
+                    ++dropped_would_block_;
                     logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
                     return true;
                 }
@@ -15,9 +15,13 @@
 #ifndef _FASTDDS_SHAREDMEM_MANAGER_H_
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
+#include <algorithm>
 #include <atomic>
-#include <list>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <rtps/transport/shared_mem/SharedMemGlobal.hpp>
 
@@ -341,9 +345,135 @@ public:
         uint32_t original_validity_id_;
     };
 
+    /**
+     * Recycles the memory of the SharedMemBuffer objects allocated by a segment, together with their shared_ptr
+     * control blocks, so sending a buffer does not reach the heap once the pool is warm.
+     */
+    class BufferHandlePool
+    {
+    public:
+
+        explicit BufferHandlePool(
+                size_t max_free_blocks)
+            : max_free_blocks_(max_free_blocks)
+        {
+            free_blocks_.reserve(max_free_blocks);
+        }
+
+        ~BufferHandlePool()
+        {
+            for (void* block : free_blocks_)
+            {
+                ::operator delete(block);
+            }
+        }
+
+        void* get(
+                size_t size)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (size == block_size_ && !free_blocks_.empty())
+                {
+                    void* block = free_blocks_.back();
+                    free_blocks_.pop_back();
+                    return block;
+                }
+            }
+
+            return ::operator new(size);
+        }
+
+        void put(
+                void* block,
+                size_t size)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (0 == block_size_)
+                {
+                    block_size_ = size;
+                }
+
+                if (size == block_size_ && free_blocks_.size() < max_free_blocks_)
+                {
+                    free_blocks_.push_back(block);
+                    return;
+                }
+            }
+
+            ::operator delete(block);
+        }
+
+    private:
+
+        std::mutex mutex_;
+        size_t block_size_ = 0;
+        size_t max_free_blocks_;
+        std::vector<void*> free_blocks_;
+    };
+
+    /**
+     * Allocator for std::allocate_shared taking its memory from a BufferHandlePool.
+     * Copies keep the pool alive, so buffers may outlive the segment that allocated them.
+     */
+    template<class T>
+    class BufferHandleAllocator
+    {
+    public:
+
+        using value_type = T;
+
+        explicit BufferHandleAllocator(
+                const std::shared_ptr<BufferHandlePool>& pool)
+            : pool_(pool)
+        {
+        }
+
+        template<class U>
+        BufferHandleAllocator(
+                const BufferHandleAllocator<U>& other)
+            : pool_(other.pool_)
+        {
+        }
+
+        T* allocate(
+                size_t n)
+        {
+            return static_cast<T*>(pool_->get(n * sizeof(T)));
+        }
+
+        void deallocate(
+                T* p,
+                size_t n)
+        {
+            pool_->put(p, n * sizeof(T));
+        }
+
+        template<class U>
+        bool operator ==(
+                const BufferHandleAllocator<U>& other) const
+        {
+            return pool_ == other.pool_;
+        }
+
+        template<class U>
+        bool operator !=(
+                const BufferHandleAllocator<U>& other) const
+        {
+            return pool_ != other.pool_;
+        }
+
+        std::shared_ptr<BufferHandlePool> pool_;
+    };
+
     /**
      * Handle a shared-memory segment
      * Allows buffer allocation / deallocation
+     *
+     * Buffers are carved from the segment in size classes, four per power of two. Released buffers keep their data
+     * block and are cached on the free list of their class, so most allocations reuse a block without walking the
+     * segment allocator. Cached blocks are given back to the segment allocator when a new block does not fit.
      */
     class Segment
     {
@@ -356,6 +486,8 @@ public:
                 const std::string& domain_name)
             : segment_id_()
             , overflows_count_(0)
+            , handle_pool_(std::make_shared<BufferHandlePool>(max_allocations))
+            , nodes_info_(max_allocations)
         {
             generate_segment_id_and_name(domain_name);
 
@@ -374,19 +506,25 @@ public:
                 throw;
             }
 
+            payload_size_ = payload_size;
             free_bytes_ = payload_size;
 
             // Alloc the buffer nodes
-            auto buffers_nodes = segment_->get().construct<BufferNode>
+            buffer_nodes_ = segment_->get().construct<BufferNode>
                         (boost::interprocess::anonymous_instance)[max_allocations]();
 
+            for (uint32_t& head : cached_nodes_)
+            {
+                head = invalid_node;
+            }
+
             // All buffer nodes are free
-            for (uint32_t i = 0; i < max_allocations; i++)
+            for (uint32_t i = max_allocations; i-- > 0;)
             {
-                buffers_nodes[i].status.exchange({0, 0, 0});
-                buffers_nodes[i].data_size = 0;
-                buffers_nodes[i].data_offset = 0;
-                free_buffers_.push_back(&buffers_nodes[i]);
+                buffer_nodes_[i].status.exchange({0, 0, 0});
+                buffer_nodes_[i].data_size = 0;
+                buffer_nodes_[i].data_offset = 0;
+                push_node(empty_nodes_, i);
             }
         }
 
@@ -414,69 +552,55 @@ public:
             return segment_id_;
         }
 
+        /**
+         * Allocate a buffer.
+         * When the segment is full, waits until max_blocking_time_point for the listeners to release buffers.
+         * After that, the oldest buffers not being processed are recovered, and their listeners lose them.
+         * @param size Size of the buffer.
+         * @param max_blocking_time_point Maximum time to wait for the listeners.
+         * @return The new buffer.
+         * @throw std::runtime_error when there is no room for the buffer.
+         */
         std::shared_ptr<Buffer> alloc_buffer(
                 uint32_t size,
                 const std::chrono::steady_clock::time_point& max_blocking_time_point)
         {
-            (void)max_blocking_time_point;
+            std::unique_lock<std::mutex> lock(alloc_mutex_);
 
-            std::lock_guard<std::mutex> lock(alloc_mutex_);
-
-            if (!recover_buffers(size))
+            uint32_t node_index = invalid_node;
+            if (size <= payload_size_)
             {
-                throw std::runtime_error("allocation overflow");
-            }
-
-            void* data = nullptr;
-            BufferNode* buffer_node = nullptr;
-            std::shared_ptr<SharedMemBuffer> new_buffer;
-
-            try
-            {
-                buffer_node = pop_free_node();
-
-                data = segment_->get().allocate(size);
-                free_bytes_ -= size;
-
-                buffer_node->data_offset = segment_->get_offset_from_address(data);
-                buffer_node->data_size = size;
-
-                auto validity_id = buffer_node->status.load(std::memory_order_relaxed).validity_id;
-
-                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node,
-                                static_cast<uint32_t>(validity_id));
-
-                if (new_buffer)
-                {
-                    buffer_node->inc_processing_count(static_cast<uint32_t>(validity_id));
-                }
-                else
+                // Wait for the listeners to release enough buffers
+                std::chrono::microseconds wait_time(10);
+                while (invalid_node == (node_index = try_alloc_node(size, false)) &&
+                        std::chrono::steady_clock::now() < max_blocking_time_point)
                 {
-                    throw std::runtime_error("alloc_buffer: out of memory");
+                    lock.unlock();
+                    std::this_thread::sleep_for(wait_time);
+                    wait_time = (std::min)(wait_time * 2, std::chrono::microseconds(1000));
+                    lock.lock();
                 }
 
-                // TODO(Adolfo) : Dynamic allocation. Use foonathan to convert it to static allocation
-                allocated_buffers_.push_back(buffer_node);
-            }
-            catch (const std::exception&)
-            {
-                if (buffer_node)
+                if (invalid_node == node_index)
                 {
-                    if (data)
-                    {
-                        release_buffer(buffer_node);
-                    }
-
-                    free_buffers_.push_back(buffer_node);
+                    node_index = try_alloc_node(size, true);
                 }
+            }
 
+            if (invalid_node == node_index)
+            {
                 overflows_count_++;
-
-                throw;
+                throw std::runtime_error("allocation overflow");
             }
 
-            return new_buffer;
+            BufferNode* buffer_node = &buffer_nodes_[node_index];
+            buffer_node->data_size = size;
+            auto validity_id = static_cast<uint32_t>(buffer_node->status.load(std::memory_order_relaxed).validity_id);
+            buffer_node->inc_processing_count(validity_id);
+            push_allocated_node(node_index);
+
+            return std::allocate_shared<SharedMemBuffer>(BufferHandleAllocator<SharedMemBuffer>(handle_pool_),
+                           segment_, segment_id_, buffer_node, validity_id);
         }
 
         uint64_t mem_size()
@@ -486,20 +610,49 @@ public:
 
     private:
 
+        static constexpr uint32_t invalid_node = (std::numeric_limits<uint32_t>::max)();
+
+        //! Smallest size class.
+        static constexpr uint32_t min_class_size = 64;
+
+        //! Number of size classes up to 4GB.
+        static constexpr uint32_t num_size_classes = 4 * 27;
+
+        //! Process-local state of a buffer node.
+        struct NodeInfo
+        {
+            //! Size of the data block of the node, 0 when it has none.
+            uint32_t capacity = 0;
+            uint32_t prev = invalid_node;
+            uint32_t next = invalid_node;
+        };
+
         std::string segment_name_;
 
         std::unique_ptr<RobustExclusiveLock> segment_name_lock_;
 
-        // TODO(Adolfo) : Dynamic allocations. Use foonathan to convert it to static allocation
-        std::list<BufferNode*> free_buffers_;
-        std::list<BufferNode*> allocated_buffers_;
-
         std::mutex alloc_mutex_;
         std::shared_ptr<SharedMemSegment> segment_;
         SharedMemSegment::Id segment_id_;
         uint64_t overflows_count_;
 
+        uint32_t payload_size_;
+        //! Payload bytes not taken by any data block.
         uint32_t free_bytes_;
+        //! Payload bytes taken by the data blocks of cached nodes.
+        uint32_t cached_bytes_ = 0;
+
+        std::shared_ptr<BufferHandlePool> handle_pool_;
+
+        BufferNode* buffer_nodes_;
+        std::vector<NodeInfo> nodes_info_;
+        //! Nodes without data block.
+        uint32_t empty_nodes_ = invalid_node;
+        //! Nodes not in use with a data block, by the largest size class fitting on it.
+        uint32_t cached_nodes_[num_size_classes];
+        //! Nodes in use, from the oldest to the newest.
+        uint32_t allocated_head_ = invalid_node;
+        uint32_t allocated_tail_ = invalid_node;
 
         void generate_segment_id_and_name(
                 const std::string& domain_name)
@@ -531,74 +684,259 @@ public:
             }
         }
 
-        inline BufferNode* pop_free_node()
+        /**
+         * Computes the size class of a size.
+         * @param size Size in bytes.
+         * @param round_up Whether to return the smallest class not smaller than size, or the largest class not
+         * larger than size.
+         * @param class_size Filled with the size of the class.
+         * @return Index of the class.
+         */
+        static uint32_t size_class(
+                uint32_t size,
+                bool round_up,
+                uint32_t& class_size)
+        {
+            if (size <= min_class_size)
+            {
+                class_size = min_class_size;
+                return 0;
+            }
+
+            // Classes split each power of two range (2^p, 2^(p+1)] in four steps
+            uint32_t p = 0;
+            while ((static_cast<uint64_t>(1) << (p + 1)) < size)
+            {
+                ++p;
+            }
+
+            uint64_t base = static_cast<uint64_t>(1) << p;
+            uint64_t step = base / 4;
+            uint64_t steps = (size - base + (round_up ? step - 1 : 0)) / step;
+            if (0 == steps)
+            {
+                // Only when rounding down: the class is the previous power of two itself
+                --p;
+                base /= 2;
+                step /= 2;
+                steps = 4;
+            }
+
+            uint64_t size64 = base + steps * step;
+            class_size = size64 > (std::numeric_limits<uint32_t>::max)() ?
+                    (std::numeric_limits<uint32_t>::max)() : static_cast<uint32_t>(size64);
+            return p * 4 + static_cast<uint32_t>(steps) - 24;
+        }
+
+        void push_node(
+                uint32_t& head,
+                uint32_t index)
         {
-            if (free_buffers_.empty())
+            nodes_info_[index].next = head;
+            head = index;
+        }
+
+        uint32_t pop_node(
+                uint32_t& head)
+        {
+            uint32_t index = head;
+            if (invalid_node != index)
             {
-                throw std::runtime_error("BufferNodes overflow");
+                head = nodes_info_[index].next;
             }
+            return index;
+        }
 
-            auto node = free_buffers_.back();
-            free_buffers_.pop_back();
-            return node;
+        void push_allocated_node(
+                uint32_t index)
+        {
+            NodeInfo& info = nodes_info_[index];
+            info.prev = allocated_tail_;
+            info.next = invalid_node;
+            if (invalid_node == allocated_tail_)
+            {
+                allocated_head_ = index;
+            }
+            else
+            {
+                nodes_info_[allocated_tail_].next = index;
+            }
+            allocated_tail_ = index;
+        }
+
+        /**
+         * Remove a node from the allocated list, and cache it with its data block.
+         * @return Index of the next allocated node.
+         */
+        uint32_t cache_allocated_node(
+                uint32_t index)
+        {
+            NodeInfo& info = nodes_info_[index];
+            uint32_t next = info.next;
+            (invalid_node == info.prev ? allocated_head_ : nodes_info_[info.prev].next) = next;
+            (invalid_node == next ? allocated_tail_ : nodes_info_[next].prev) = info.prev;
+
+            uint32_t class_size;
+            push_node(cached_nodes_[size_class(info.capacity, false, class_size)], index);
+            cached_bytes_ += info.capacity;
+            return next;
         }
 
-        void release_buffer(
-                BufferNode* buffer_node)
+        /**
+         * Give back to the segment allocator the data block of a cached node.
+         */
+        void release_cached_node(
+                uint32_t class_index)
         {
-            segment_->get().deallocate(
-                segment_->get_address_from_offset(buffer_node->data_offset));
+            uint32_t index = pop_node(cached_nodes_[class_index]);
+            NodeInfo& info = nodes_info_[index];
+            segment_->get().deallocate(segment_->get_address_from_offset(buffer_nodes_[index].data_offset));
+            cached_bytes_ -= info.capacity;
+            free_bytes_ += info.capacity;
+            info.capacity = 0;
+            push_node(empty_nodes_, index);
+        }
 
-            free_bytes_ += buffer_node->data_size;
+        /**
+         * Give back cached data blocks to the segment allocator until there are enough free bytes, or no more
+         * cached blocks.
+         */
+        void release_cached_nodes(
+                uint32_t required_bytes,
+                bool need_empty_node)
+        {
+            for (uint32_t class_index = 0;
+                    class_index < num_size_classes &&
+                    (free_bytes_ < required_bytes || (need_empty_node && invalid_node == empty_nodes_));
+                    ++class_index)
+            {
+                while (invalid_node != cached_nodes_[class_index] &&
+                        (free_bytes_ < required_bytes || (need_empty_node && invalid_node == empty_nodes_)))
+                {
+                    release_cached_node(class_index);
+                }
+            }
         }
 
         /**
-         * Recover unreferenced buffers and, in case of overflow, also recovers the oldest buffers not being
-         * processed by any listener (until enough free bytes is gathered to solve the overflow).
-         * @return true if at least required_data_size bytes are free after the recovery, false otherwise.
+         * Recover the allocated nodes no listener references any more.
+         * When force is true, the oldest nodes not being processed by any listener are also recovered until
+         * required_bytes can be allocated, so they are discarded for the listeners that did not pop them yet.
+         * @return Whether any node was recovered.
          */
         bool recover_buffers(
-                uint32_t required_data_size)
+                uint32_t required_bytes,
+                bool force)
         {
-            auto it = allocated_buffers_.begin();
+            bool recovered = false;
+            uint32_t index = allocated_head_;
 
-            while (it != allocated_buffers_.end())
+            while (invalid_node != index)
             {
-                // There is enough space to allocate the buffer
-                if (free_bytes_ >= required_data_size)
+                BufferNode& node = buffer_nodes_[index];
+                bool enough_space = free_bytes_ + cached_bytes_ >= required_bytes &&
+                        (invalid_node != empty_nodes_ || 0 < cached_bytes_);
+                if (node.is_not_referenced())
                 {
-                    if ((*it)->is_not_referenced())
-                    {
-                        (*it)->invalidate_buffer();
+                    node.invalidate_buffer();
+                }
+                else if (!force || enough_space || !node.invalidate_if_not_processing())
+                {
+                    index = nodes_info_[index].next;
+                    continue;
+                }
 
-                        release_buffer(*it);
+                index = cache_allocated_node(index);
+                recovered = true;
+            }
 
-                        free_buffers_.push_back(*it);
-                        it = allocated_buffers_.erase(it);
-                    }
-                    else
-                    {
-                        it++;
-                    }
+            return recovered;
+        }
+
+        /**
+         * Take a node with a data block of at least size bytes.
+         * Reuses a cached block of the size class of size when possible, and carves a new one otherwise.
+         * @param size Size of the buffer.
+         * @param force Whether buffers not yet processed by their listeners can be recovered.
+         * @return Index of the node, or invalid_node when there is no room for the buffer.
+         */
+        uint32_t try_alloc_node(
+                uint32_t size,
+                bool force)
+        {
+            uint32_t class_size;
+            uint32_t class_index = size_class(size, true, class_size);
+            // Sizes close to the whole payload are allocated exactly, and never reuse a cached block
+            bool use_class = class_size <= payload_size_;
+            uint32_t capacity = use_class ? class_size : size;
+
+            // The oldest buffers are usually the ones already released, so they are checked first
+            uint32_t index = allocated_head_;
+            while (invalid_node != index && buffer_nodes_[index].is_not_referenced())
+            {
+                buffer_nodes_[index].invalidate_buffer();
+                index = cache_allocated_node(index);
+            }
+
+            uint32_t node_index = try_carve_node(use_class, class_index, size, capacity);
+            if (invalid_node == node_index && recover_buffers(capacity, force))
+            {
+                node_index = try_carve_node(use_class, class_index, size, capacity);
+            }
+
+            return node_index;
+        }
+
+        uint32_t try_carve_node(
+                bool use_class,
+                uint32_t class_index,
+                uint32_t size,
+                uint32_t capacity)
+        {
+            if (use_class)
+            {
+                uint32_t index = pop_node(cached_nodes_[class_index]);
+                if (invalid_node != index)
+                {
+                    cached_bytes_ -= nodes_info_[index].capacity;
+                    return index;
                 }
-                else // No enough space, try to recover oldest not processing buffers
+            }
+
+            if (free_bytes_ + cached_bytes_ < capacity)
+            {
+                // Not enough room for the whole class, but maybe for the exact size.
+                // Blocks smaller than the smallest class would be cached on it, and reused for larger buffers.
+                capacity = (std::max)(size, min_class_size);
+                if (free_bytes_ + cached_bytes_ < capacity)
                 {
-                    // Buffer is not being processed by any listener
-                    if ((*it)->invalidate_if_not_processing())
-                    {
-                        release_buffer(*it);
+                    return invalid_node;
+                }
+            }
 
-                        free_buffers_.push_back(*it);
-                        it = allocated_buffers_.erase(it);
-                    }
-                    else
-                    {
-                        it++;
-                    }
+            release_cached_nodes(capacity, true);
+            if (invalid_node == empty_nodes_)
+            {
+                return invalid_node;
+            }
+
+            void* data = segment_->get().allocate(capacity, std::nothrow);
+            if (nullptr == data)
+            {
+                // The segment is fragmented: every cached block is given back before retrying
+                release_cached_nodes((std::numeric_limits<uint32_t>::max)(), true);
+                data = segment_->get().allocate(capacity, std::nothrow);
+                if (nullptr == data)
+                {
+                    return invalid_node;
                 }
             }
 
-            return free_bytes_ >= required_data_size;
+            uint32_t index = pop_node(empty_nodes_);
+            buffer_nodes_[index].data_offset = segment_->get_offset_from_address(data);
+            nodes_info_[index].capacity = capacity;
+            free_bytes_ -= capacity;
+            return index;
         }
 
     }; // Segment
@@ -619,6 +957,7 @@ public:
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , spin_time_(0)
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -675,8 +1014,11 @@ public:
 
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
-                        // Wait until there's data to pop
-                        global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        if (!spin_wait())
+                        {
+                            // Wait until there's data to pop
+                            global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
+                        }
                     }
 
                     if (!head_cell)
@@ -755,6 +1097,17 @@ public:
             *this = std::move(*new_listener);
         }
 
+        /**
+         * Set the time pop() busy-polls the port before blocking on it.
+         * While spinning the listener is not counted as waiting on the port, so producers do not notify it.
+         * @param spin_time Maximum time spinning on each pop() call. 0 makes pop() block straight away.
+         */
+        void spin_time(
+                std::chrono::microseconds spin_time)
+        {
+            spin_time_ = spin_time;
+        }
+
         /**
          * Unblock a thread blocked in pop() call, not allowing pop() to block again.
          * @throw std::exception on error
@@ -776,6 +1129,38 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        std::chrono::microseconds spin_time_;
+
+        /**
+         * Busy-poll the port until a buffer is available, the listener is closed, or spin_time_ elapses.
+         * @return true when the listener has something to do, false when it has to block.
+         */
+        bool spin_wait()
+        {
+            if (spin_time_.count() <= 0)
+            {
+                return false;
+            }
+
+            // The clock is read once every few polls, as reading it costs more than a poll
+            static constexpr uint32_t polls_per_clock_read = 64;
+            auto limit = std::chrono::steady_clock::now() + spin_time_;
+            do
+            {
+                for (uint32_t i = 0; i < polls_per_clock_read; ++i)
+                {
+                    if (is_closed_.load(std::memory_order_relaxed) || nullptr != global_listener_->head())
+                    {
+                        // Pairs with the release of the producer, as no mutex was taken
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        return true;
+                    }
+                }
+            } while (std::chrono::steady_clock::now() < limit);
+
+            return false;
+        }
+
     }; // Listener
 
     /**
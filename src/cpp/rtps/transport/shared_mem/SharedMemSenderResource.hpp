@@ -47,6 +47,16 @@ public:
                                     max_blocking_time_point);
                 };
 
+        send_buffers_lambda_ = [&transport] (
+            const fastrtps::rtps::NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) -> bool
+                {
+                    return transport.send(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                                    max_blocking_time_point);
+                };
     }
 
     virtual ~SharedMemSenderResource()
@@ -46,6 +46,8 @@ using SenderResource = fastrtps::rtps::SenderResource;
 using LocatorSelectorEntry = fastrtps::rtps::LocatorSelectorEntry;
 using LocatorSelector = fastrtps::rtps::LocatorSelector;
 using PortParameters = fastrtps::rtps::PortParameters;
+using NetworkBuffer = fastrtps::rtps::NetworkBuffer;
+using NetworkBufferList = fastrtps::rtps::NetworkBufferList;
 
 TransportInterface* SharedMemTransportDescriptor::create_transport() const
 {
@@ -311,12 +313,15 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
     auto open_mode = locator.address[0] == 'M' ? SharedMemGlobal::Port::OpenMode::ReadShared :
             SharedMemGlobal::Port::OpenMode::ReadExclusive;
 
+    auto listener = shared_mem_manager_->open_port(
+        locator.port,
+        configuration_.port_queue_capacity(),
+        configuration_.healthy_check_timeout_ms(),
+        open_mode)->create_listener();
+    listener->spin_time(std::chrono::microseconds(configuration_.listener_spin_time_us()));
+
     return new SharedMemChannelResource(
-        shared_mem_manager_->open_port(
-            locator.port,
-            configuration_.port_queue_capacity(),
-            configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+        listener,
         locator,
         receiver,
         configuration_.rtps_dump_file());
@@ -387,6 +392,14 @@ bool SharedMemTransport::transform_remote_locator(
     return false;
 }
 
+std::chrono::steady_clock::time_point SharedMemTransport::listeners_wait_limit(
+        const std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    return (std::min)(max_blocking_time_point,
+                   std::chrono::steady_clock::now() +
+                   std::chrono::milliseconds(configuration_.healthy_check_timeout_ms()));
+}
+
 std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -395,19 +408,38 @@ std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buf
     assert(shared_mem_segment_);
 
     std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
-            shared_mem_segment_->alloc_buffer(send_buffer_size, max_blocking_time_point);
+            shared_mem_segment_->alloc_buffer(send_buffer_size, listeners_wait_limit(max_blocking_time_point));
 
     memcpy(shared_buffer->data(), send_buffer, send_buffer_size);
 
     return shared_buffer;
 }
 
-bool SharedMemTransport::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
-        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
-        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    assert(shared_mem_segment_);
+
+    std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
+            shared_mem_segment_->alloc_buffer(total_bytes, listeners_wait_limit(max_blocking_time_point));
+
+    octet* data = static_cast<octet*>(shared_buffer->data());
+    for (const NetworkBuffer& slice : buffers)
+    {
+        memcpy(data, slice.buffer, slice.size);
+        data += slice.size;
+    }
+
+    return shared_buffer;
+}
+
+template<typename GetSharedBuffer>
+bool SharedMemTransport::send_to_locators(
+        const GetSharedBuffer& get_shared_buffer,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -424,7 +456,7 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = get_shared_buffer();
                 }
 
                 ret &= send(shared_buffer, *it);
@@ -455,7 +487,45 @@ bool SharedMemTransport::send(
     }
 
     return ret;
+}
+
+bool SharedMemTransport::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send_to_locators([&]()
+                   {
+                       return copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                   }, destination_locators_begin, destination_locators_end);
+}
+
+bool SharedMemTransport::send(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    // The slices are gathered back to back into a buffer of total_bytes, so they must fill it exactly
+    uint64_t slices_bytes = 0;
+    for (const NetworkBuffer& slice : buffers)
+    {
+        slices_bytes += slice.size;
+    }
+    if (slices_bytes != total_bytes)
+    {
+        logError(RTPS_MSG_OUT, "SharedMemTransport: slices of " << slices_bytes << " bytes sent as a message of "
+                                                               << total_bytes << " bytes");
+        return false;
+    }
 
+    return send_to_locators([&]()
+                   {
+                       return copy_to_shared_buffer(buffers, total_bytes, max_blocking_time_point);
+                   }, destination_locators_begin, destination_locators_end);
 }
 
 std::shared_ptr<SharedMemManager::Port> SharedMemTransport::find_port(
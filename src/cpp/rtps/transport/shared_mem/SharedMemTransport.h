@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_SHAREDMEM_TRANSPORT_H_
 #define _FASTDDS_SHAREDMEM_TRANSPORT_H_
 
+#include <fastdds/rtps/network/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 
@@ -148,6 +149,23 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Blocking Send of a message given as a list of slices.
+     * The slices are gathered directly into the shared memory buffer delivered to the destinations, so the message
+     * is never made contiguous on a buffer of its own.
+     * @param buffers List of slices composing the message, in order.
+     * @param total_bytes Sum of the sizes of all the slices.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point Maximum time this function will block.
+     */
+    virtual bool send(
+            const fastrtps::rtps::NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -233,11 +251,35 @@ protected:
 
 private:
 
+    /**
+     * Time point until which an allocation can wait for the listeners to release buffers.
+     * The wait never goes beyond healthy_check_timeout_ms, as a listener not popping its buffers for that long is
+     * considered hung. Messages sent without a writer deadline (control and discovery) are only delayed that long.
+     * @param max_blocking_time_point Time point given by the caller of send.
+     */
+    std::chrono::steady_clock::time_point listeners_wait_limit(
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) const;
+
     std::shared_ptr<SharedMemManager::Buffer> copy_to_shared_buffer(
             const fastrtps::rtps::octet* send_buffer,
             uint32_t send_buffer_size,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    std::shared_ptr<SharedMemManager::Buffer> copy_to_shared_buffer(
+            const fastrtps::rtps::NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    /**
+     * Pushes a shared buffer to every supported destination.
+     * @param get_shared_buffer Called once, before the first push, to get the buffer holding the message.
+     */
+    template<typename GetSharedBuffer>
+    bool send_to_locators(
+            const GetSharedBuffer& get_shared_buffer,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end);
+
     bool send(
             const std::shared_ptr<SharedMemManager::Buffer>& buffer,
             const fastrtps::rtps::Locator_t& remote_locator);
@@ -24,6 +24,7 @@ namespace rtps {
 static constexpr uint32_t shm_default_segment_size = 0;
 static constexpr uint32_t shm_default_port_queue_capacity = 512;
 static constexpr uint32_t shm_default_healthy_check_timeout_ms = 1000;
+static constexpr uint32_t shm_default_listener_spin_time_us = 0;
 
 } // rtps
 } // fastdds
@@ -38,6 +39,7 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , listener_spin_time_us_(shm_default_listener_spin_time_us)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -49,6 +51,7 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor(
     , port_queue_capacity_(t.port_queue_capacity_)
     , healthy_check_timeout_ms_(t.healthy_check_timeout_ms_)
     , rtps_dump_file_(t.rtps_dump_file_)
+    , listener_spin_time_us_(t.listener_spin_time_us_)
 {
     maxMessageSize = t.max_message_size();
 }
@@ -66,6 +66,22 @@ bool test_SharedMemTransport::send(
                    destination_locators_end, max_blocking_time_point);
 }
 
+bool test_SharedMemTransport::send(
+        const fastrtps::rtps::NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    if (total_bytes >= big_buffer_size_)
+    {
+        (*big_buffer_size_send_count_)++;
+    }
+
+    return SharedMemTransport::send(buffers, total_bytes, destination_locators_begin,
+                   destination_locators_end, max_blocking_time_point);
+}
+
 SharedMemChannelResource* test_SharedMemTransport::CreateInputChannelResource(
         const Locator_t& locator,
         uint32_t maxMsgSize,
@@ -77,12 +93,15 @@ SharedMemChannelResource* test_SharedMemTransport::CreateInputChannelResource(
     auto open_mode = locator.address[0] == 'M' ? SharedMemGlobal::Port::OpenMode::ReadShared :
             SharedMemGlobal::Port::OpenMode::ReadExclusive;
 
+    auto listener = shared_mem_manager_->open_port(
+        locator.port,
+        configuration()->port_queue_capacity(),
+        configuration()->healthy_check_timeout_ms(),
+        open_mode)->create_listener();
+    listener->spin_time(std::chrono::microseconds(configuration()->listener_spin_time_us()));
+
     return new test_SharedMemChannelResource(
-        shared_mem_manager_->open_port(
-            locator.port,
-            configuration()->port_queue_capacity(),
-            configuration()->healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+        listener,
         locator,
         receiver,
         big_buffer_size_,
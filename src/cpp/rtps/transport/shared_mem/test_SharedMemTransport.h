@@ -36,6 +36,13 @@ public:
             fastrtps::rtps::LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
 
+    bool send(
+            const fastrtps::rtps::NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point) override;
+
     SharedMemChannelResource* CreateInputChannelResource(
             const fastrtps::rtps::Locator_t& locator,
             uint32_t max_msg_size,
@@ -159,7 +159,7 @@ bool test_UDPv4Transport::send(
                             socket,
                             *it,
                             only_multicast_purpose,
-                            std::chrono::duration_cast<std::chrono::microseconds>(now - max_blocking_time_point));
+                            std::chrono::duration_cast<std::chrono::microseconds>(max_blocking_time_point - now));
 
             ++it;
         }
@@ -173,6 +173,22 @@ bool test_UDPv4Transport::send(
     return ret;
 }
 
+bool test_UDPv4Transport::send(
+        const std::vector<asio::const_buffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    gather_buffer_.resize(total_bytes);
+    asio::buffer_copy(asio::buffer(gather_buffer_), buffers);
+
+    return send(gather_buffer_.data(), total_bytes, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, max_blocking_time_point);
+}
+
 bool test_UDPv4Transport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
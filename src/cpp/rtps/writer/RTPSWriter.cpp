@@ -141,6 +141,53 @@ RTPSWriter::~RTPSWriter()
     mp_history->mp_mutex = nullptr;
 }
 
+void RTPSWriter::begin_batch(
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (!isAsync() && !batch_group_)
+    {
+        batch_group_.reset(new RTPSMessageGroup(mp_RTPSParticipant, this, *this, max_blocking_time));
+        // Changes may be removed from the history before the batch is sent
+        batch_group_->copy_payloads();
+    }
+}
+
+void RTPSWriter::end_batch()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    if (batch_group_)
+    {
+        flush_batch_nts();
+
+        // Destroying the group retries sending what a timed out flush left on it
+        RTPSMessageGroup* group = batch_group_.release();
+        try
+        {
+            delete group;
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            logError(RTPS_WRITER, "Max blocking time reached");
+        }
+    }
+}
+
+void RTPSWriter::flush_batch_nts()
+{
+    if (batch_group_)
+    {
+        try
+        {
+            batch_group_->flush_and_reset();
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            logError(RTPS_WRITER, "Max blocking time reached");
+        }
+    }
+}
+
 CacheChange_t* RTPSWriter::new_change(
         const std::function<uint32_t()>& dataCdrSerializedSize,
         ChangeKind_t changeKind,
@@ -353,14 +400,28 @@ const std::vector<GUID_t>& RTPSWriter::remote_guids() const
     return all_remote_readers_;
 }
 
-bool RTPSWriter::send(
-        CDRMessage_t* message,
+bool RTPSWriter::send_slices(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        std::chrono::steady_clock::time_point& max_blocking_time_point) const
+{
+    RTPSParticipantImpl* participant = getRTPSParticipant();
+
+    return locator_selector_.selected_size() == 0 ||
+           participant->sendSync(buffers, total_bytes, locator_selector_.begin(), locator_selector_.end(),
+                   max_blocking_time_point);
+}
+
+bool RTPSWriter::send_control(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     RTPSParticipantImpl* participant = getRTPSParticipant();
 
     return locator_selector_.selected_size() == 0 ||
-           participant->sendSync(message, locator_selector_.begin(), locator_selector_.end(), max_blocking_time_point);
+           participant->send_control(buffers, total_bytes, locator_selector_.begin(), locator_selector_.end(),
+                   max_blocking_time_point);
 }
 
 const LivelinessQosPolicyKind& RTPSWriter::get_liveliness_kind() const
@@ -521,8 +521,6 @@ void StatefulWriter::sync_delivery(
             {
                 if (locator_selector_.selected_size() > 0)
                 {
-                    RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
-
                     auto sent_fun = [this, change](
                         FragmentNumber_t frag)
                             {
@@ -539,8 +537,18 @@ void StatefulWriter::sync_delivery(
                                 }
                             };
 
-                    send_data_or_fragments(group, change, expectsInlineQos, sent_fun);
-                    send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_);
+                    if (batch_group_)
+                    {
+                        // A single heartbeat is sent when the batch is flushed
+                        send_data_or_fragments(*batch_group_, change, expectsInlineQos, sent_fun);
+                        batch_heartbeat_pending_ = true;
+                    }
+                    else
+                    {
+                        RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
+                        send_data_or_fragments(group, change, expectsInlineQos, sent_fun);
+                        send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_);
+                    }
                 }
 
                 for (ReaderProxy* it : matched_local_readers_)
@@ -836,6 +844,7 @@ void StatefulWriter::send_heartbeat_to_all_readers()
         if (there_are_remote_readers_)
         {
             RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+            group.control_only();
             send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_);
         }
     }
@@ -1222,13 +1231,16 @@ void StatefulWriter::send_unsent_changes_with_flow_control(
     network.select_locators(locator_selector_);
     compute_selected_guids();
 
-    RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+    {
+        // GAP for holes in history sent to the readers that need it, on a datagram of their own
+        RTPSMessageGroup gap_group(mp_RTPSParticipant, this, *this);
+        gap_group.control_only();
+        send_hole_gaps_to_group(gap_group);
+    }
 
-    // GAP for holes in history sent to the readers that need it
-    send_hole_gaps_to_group(group);
+    RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
 
     // Reset the state of locator_selector to select all readers
-    group.flush_and_reset();
     locator_selector_.reset(true);
     network.select_locators(locator_selector_);
     compute_selected_guids();
@@ -1506,6 +1518,13 @@ bool StatefulWriter::matched_reader_add(
 
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
 
+    // Let the filter know about the reader's content filter before any change is checked for relevance.
+    if (nullptr != reader_data_filter_)
+    {
+        reader_data_filter_->update_reader_filter(rdata.guid(),
+                rdata.has_content_filter() ? &rdata.content_filter() : nullptr);
+    }
+
     // Check if it is already matched.
     if (for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
             [this, &rdata](ReaderProxy* reader)
@@ -1581,7 +1600,9 @@ bool StatefulWriter::matched_reader_add(
         return true;
     }
 
+    // Only the initial HEARTBEAT and GAP messages are sent to the new reader
     RTPSMessageGroup group(mp_RTPSParticipant, this, rp->message_sender());
+    group.control_only();
 
     // Add initial heartbeat to message group
     if (rp->is_local_reader())
@@ -1787,6 +1808,11 @@ bool StatefulWriter::matched_reader_remove(
     locator_selector_.remove_entry(reader_guid);
     update_reader_info(false);
 
+    if (nullptr != reader_data_filter_)
+    {
+        reader_data_filter_->update_reader_filter(reader_guid, nullptr);
+    }
+
     if (getMatchedReadersSize() == 0)
     {
         periodic_hb_event_->cancel_timer();
@@ -1819,6 +1845,30 @@ bool StatefulWriter::matched_reader_is_matched(
                    );
 }
 
+void StatefulWriter::flush_batch_nts()
+{
+    if (batch_group_ && batch_heartbeat_pending_)
+    {
+        batch_heartbeat_pending_ = false;
+        try
+        {
+            send_heartbeat_nts_(all_remote_readers_.size(), *batch_group_, disable_positive_acks_);
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            logError(RTPS_WRITER, "Max blocking time reached");
+        }
+    }
+
+    RTPSWriter::flush_batch_nts();
+}
+
+bool StatefulWriter::has_only_local_readers() const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    return matched_remote_readers_.empty() && matched_datasharing_readers_.empty();
+}
+
 bool StatefulWriter::matched_reader_lookup(
         GUID_t& readerGuid,
         ReaderProxy** RP)
@@ -2049,6 +2099,9 @@ bool StatefulWriter::try_remove_change(
 
     if (calc <= SequenceNumber_t())
     {
+        // Readers cannot acknowledge the changes still grouped on a batch
+        flush_batch_nts();
+
         may_remove_change_ = 0;
         may_remove_change_cond_.wait_until(lock, max_blocking_time_point,
                 [&]()
@@ -2077,6 +2130,9 @@ bool StatefulWriter::wait_for_acknowledgement(
         const std::chrono::steady_clock::time_point& max_blocking_time_point,
         std::unique_lock<RecursiveTimedMutex>& lock)
 {
+    // Readers cannot acknowledge the changes still grouped on a batch
+    flush_batch_nts();
+
     return may_remove_change_cond_.wait_until(lock, max_blocking_time_point,
                    [this, &seq]()
                    {
@@ -2197,6 +2253,7 @@ bool StatefulWriter::send_periodic_heartbeat(
                 try
                 {
                     RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+                    group.control_only();
                     send_heartbeat_nts_(all_remote_readers_.size(), group, disable_positive_acks_, liveliness);
                 }
                 catch (const RTPSMessageGroup::timeout&)
@@ -2225,6 +2282,7 @@ bool StatefulWriter::send_periodic_heartbeat(
             }
 
             RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
+            group.control_only();
             send_heartbeat_nts_(all_remote_readers_.size(), group, final, liveliness);
         }
         catch (const RTPSMessageGroup::timeout&)
@@ -2246,6 +2304,7 @@ void StatefulWriter::send_heartbeat_to_nts(
         try
         {
             RTPSMessageGroup group(mp_RTPSParticipant, this, remoteReaderProxy.message_sender());
+            group.control_only();
             send_heartbeat_nts_(1u, group, disable_positive_acks_, liveliness);
             SequenceNumber_t first_seq = get_seq_num_min();
             if (first_seq != c_SequenceNumber_Unknown)
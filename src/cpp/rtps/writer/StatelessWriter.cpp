@@ -433,26 +433,14 @@ void StatelessWriter::unsent_change_added_to_history(
 
                     if (there_are_remote_readers_ || !fixed_locators_.empty())
                     {
-                        RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
-
-                        uint32_t n_fragments = change->getFragmentCount();
-                        if (n_fragments > 0)
+                        if (batch_group_)
                         {
-                            for (uint32_t frag = 1; frag <= n_fragments; frag++)
-                            {
-                                if (!group.add_data_frag(*change, frag, is_inline_qos_expected_))
-                                {
-                                    logError(RTPS_WRITER, "Error sending fragment (" << change->sequenceNumber <<
-                                            ", " << frag << ")");
-                                }
-                            }
+                            add_change_to_group(*batch_group_, change);
                         }
                         else
                         {
-                            if (!group.add_data(*change, is_inline_qos_expected_))
-                            {
-                                logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
-                            }
+                            RTPSMessageGroup group(mp_RTPSParticipant, this, *this, max_blocking_time);
+                            add_change_to_group(group, change);
                         }
                     }
                 }
@@ -1051,6 +1039,36 @@ bool StatelessWriter::matched_reader_is_matched(
                    );
 }
 
+void StatelessWriter::add_change_to_group(
+        RTPSMessageGroup& group,
+        CacheChange_t* change)
+{
+    uint32_t n_fragments = change->getFragmentCount();
+    if (n_fragments > 0)
+    {
+        for (uint32_t frag = 1; frag <= n_fragments; frag++)
+        {
+            if (!group.add_data_frag(*change, frag, is_inline_qos_expected_))
+            {
+                logError(RTPS_WRITER, "Error sending fragment (" << change->sequenceNumber << ", " << frag << ")");
+            }
+        }
+    }
+    else
+    {
+        if (!group.add_data(*change, is_inline_qos_expected_))
+        {
+            logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+        }
+    }
+}
+
+bool StatelessWriter::has_only_local_readers() const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    return matched_remote_readers_.empty() && matched_datasharing_readers_.empty() && fixed_locators_.empty();
+}
+
 void StatelessWriter::unsent_changes_reset()
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
@@ -1073,18 +1091,19 @@ void StatelessWriter::add_flow_controller(
     flow_controllers_.push_back(std::move(controller));
 }
 
-bool StatelessWriter::send(
-        CDRMessage_t* message,
+bool StatelessWriter::send_slices(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
-    if (!RTPSWriter::send(message, max_blocking_time_point))
+    if (!RTPSWriter::send_slices(buffers, total_bytes, max_blocking_time_point))
     {
         return false;
     }
 
     return ignore_fixed_locators_ ||
            fixed_locators_.empty() ||
-           mp_RTPSParticipant->sendSync(message, Locators(fixed_locators_.begin()), Locators(
+           mp_RTPSParticipant->sendSync(buffers, total_bytes, Locators(fixed_locators_.begin()), Locators(
                        fixed_locators_.end()), max_blocking_time_point);
 }
 
@@ -224,6 +224,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_batch_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
@@ -318,6 +319,14 @@ XMLP_ret XMLParser::parseXMLTransportData(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            // Receive batch size
+            if (nullptr != (p_aux0 = p_root->FirstChildElement(RECEIVE_BATCH_SIZE)))
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->receive_batch_size, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
         }
         else if (sType == TCPv4)
         {
@@ -498,11 +507,11 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, LOGICAL_PORT_INCREMENT) == 0 || strcmp(name, LISTENING_PORTS) == 0 ||
                 strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TLS) == 0 ||
-                strcmp(name, NON_BLOCKING_SEND) == 0  ||
+                strcmp(name, NON_BLOCKING_SEND) == 0  || strcmp(name, RECEIVE_BATCH_SIZE) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 || strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
-                strcmp(name, RTPS_DUMP_FILE) == 0)
+                strcmp(name, RTPS_DUMP_FILE) == 0 || strcmp(name, LISTENER_SPIN_TIME_US) == 0)
         {
             // Parsed outside of this method
         }
@@ -682,6 +691,7 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_spin_time_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
         </xs:complexType>
      */
@@ -730,6 +740,14 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->rtps_dump_file(str);
             }
+            else if (strcmp(name, LISTENER_SPIN_TIME_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->listener_spin_time_us(static_cast<uint32_t>(aux));
+            }
             else if (strcmp(name, MAX_MESSAGE_SIZE) == 0)
             {
                 // maxMessageSize - uint32Type
@@ -23,15 +23,11 @@
 
 #include <openssl/aes.h>
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include <openssl/rand.h>
+#include <algorithm>
 #include <cstring>
 
-#if OPENSSL_VERSION_NUMBER >= 0x10100000L
-#define IS_OPENSSL_1_1 1
-#else
-#define IS_OPENSSL_1_1 0
-#endif // if OPENSSL_VERSION_NUMBER >= 0x10100000L
-
 // Solve error with Win32 macro
 #ifdef WIN32
 #undef max
@@ -61,6 +57,60 @@ static KeyMaterial_AES_GCM_GMAC* find_key(
     return nullptr;
 }
 
+static bool is_same_key_material(
+        const KeyMaterial_AES_GCM_GMAC& lhs,
+        const KeyMaterial_AES_GCM_GMAC& rhs)
+{
+    return lhs.transformation_kind == rhs.transformation_kind &&
+           lhs.master_salt == rhs.master_salt &&
+           lhs.sender_key_id == rhs.sender_key_id &&
+           lhs.master_sender_key == rhs.master_sender_key &&
+           lhs.receiver_specific_key_id == rhs.receiver_specific_key_id &&
+           lhs.master_receiver_specific_key == rhs.master_receiver_specific_key;
+}
+
+/**
+ * Compute the receiver specific MAC of a message, as the GMAC of its common MAC.
+ * @param ctx Context keyed with the receiver specific session key. Fails when the session has no context yet.
+ * @param initialization_vector IV of the message
+ * @param common_mac Common MAC of the message
+ * @param receiver_mac Outputs the receiver specific MAC
+ */
+static bool compute_receiver_mac(
+        EVP_CIPHER_CTX* ctx,
+        const std::array<uint8_t, 12>& initialization_vector,
+        const std::array<uint8_t, 16>& common_mac,
+        std::array<uint8_t, 16>& receiver_mac)
+{
+    int actual_size = 0, final_size = 0;
+
+    if (ctx == nullptr)
+    {
+        logError(SECURITY_CRYPTO, "Unable to create the receiver specific MAC. The session key has not been set");
+        return false;
+    }
+    if (!EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, initialization_vector.data()))
+    {
+        logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit_ex function returns an error");
+        return false;
+    }
+    if (!EVP_EncryptUpdate(ctx, NULL, &actual_size, common_mac.data(), 16))
+    {
+        logError(SECURITY_CRYPTO,
+                "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
+        return false;
+    }
+    if (!EVP_EncryptFinal_ex(ctx, NULL, &final_size))
+    {
+        logError(SECURITY_CRYPTO,
+                "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
+        return false;
+    }
+
+    EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, receiver_mac.data());
+    return true;
+}
+
 AESGCMGMAC_Transform::AESGCMGMAC_Transform()
 {
 }
@@ -109,6 +159,13 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
+
+        if (!init_session_context(*session, keyMat.transformation_kind))
+        {
+            // Start a new session on the next message
+            session->session_block_counter = local_writer->max_blocks_per_session;
+            return false;
+        }
     }
     //In any case, increment session block counter
     session->session_block_counter += 1;
@@ -139,7 +196,7 @@ bool AESGCMGMAC_Transform::encode_serialized_payload(
     // Body
     try
     {
-        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, session->SessionKey,
+        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, *session,
                 initialization_vector, output_buffer, payload.data, payload.length, tag, false))
         {
             return false;
@@ -214,6 +271,13 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
+
+        if (!init_session_context(*session, keyMat.transformation_kind))
+        {
+            // Start a new session on the next message
+            session->session_block_counter = local_writer->max_blocks_per_session;
+            return false;
+        }
     }
 
     session->session_block_counter += 1;
@@ -266,7 +330,7 @@ bool AESGCMGMAC_Transform::encode_datawriter_submessage(
     // Body
     try
     {
-        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, session->SessionKey,
+        if (!serialize_SecureDataBody(serializer, keyMat.transformation_kind, *session,
                 initialization_vector, output_buffer, &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
                 plain_rtps_submessage.length - plain_rtps_submessage.pos, tag, true))
         {
@@ -354,6 +418,13 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
 
         //ReceiverSpecific keys shall be computed specifically when needed
         session->session_block_counter = 0;
+
+        if (!init_session_context(*session, local_reader->EntityKeyMaterial.at(0).transformation_kind))
+        {
+            // Start a new session on the next message
+            session->session_block_counter = local_reader->max_blocks_per_session;
+            return false;
+        }
     }
 
     session->session_block_counter += 1;
@@ -407,7 +478,7 @@ bool AESGCMGMAC_Transform::encode_datareader_submessage(
     try
     {
         if (!serialize_SecureDataBody(serializer, local_reader->EntityKeyMaterial.at(0).transformation_kind,
-                session->SessionKey,
+                *session,
                 initialization_vector, output_buffer, &plain_rtps_submessage.buffer[plain_rtps_submessage.pos],
                 plain_rtps_submessage.length - plain_rtps_submessage.pos, tag, true))
         {
@@ -495,6 +566,14 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
         //ReceiverSpecific keys shall be computed specifically when needed
         local_participant->Session.session_block_counter = 0;
         //Insert outdate session_id values in all RemoteParticipant trackers to trigger a SessionkeyUpdate
+
+        if (!init_session_context(local_participant->Session,
+                local_participant->ParticipantKeyMaterial.transformation_kind))
+        {
+            // Start a new session on the next message
+            local_participant->Session.session_block_counter = local_participant->max_blocks_per_session;
+            return false;
+        }
     }
 
     local_participant->Session.session_block_counter += 1;
@@ -548,7 +627,7 @@ bool AESGCMGMAC_Transform::encode_rtps_message(
     try
     {
         if (!serialize_SecureDataBody(serializer, local_participant->ParticipantKeyMaterial.transformation_kind,
-                local_participant->Session.SessionKey,
+                local_participant->Session,
                 initialization_vector, output_buffer, &plain_rtps_message.buffer[plain_rtps_message.pos],
                 plain_rtps_message.length - plain_rtps_message.pos, tag, true))
         {
@@ -682,10 +761,14 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
     memcpy(&session_id, header.session_id.data(), 4);
 
     //Sessionkey
-    std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key,
-            sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0),
-            session_id);
+    std::unique_lock<std::mutex> lock(sending_participant->decode_mutex_);
+    DecodeSessionData* session = get_decode_session(sending_participant->DecodeSessions,
+            sending_participant->RemoteParticipant2ParticipantKeyMaterial,
+            sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0), session_id);
+    if (session == nullptr)
+    {
+        return false;
+    }
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -773,7 +856,7 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).receiver_specific_key_id,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_receiver_specific_key,
                 sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, *session, exception))
         {
             return false;
         }
@@ -794,7 +877,7 @@ bool AESGCMGMAC_Transform::decode_rtps_message(
     if (!deserialize_SecureDataBody(decoder, is_encrypted ? body_state : protected_body_state, tag,
             is_encrypted ? body_length : body_length + 4,
             sending_participant->RemoteParticipant2ParticipantKeyMaterial.at(0).transformation_kind,
-            session_key, initialization_vector,
+            *session, initialization_vector,
             &plain_buffer.buffer[plain_buffer.pos], length))
     {
         logWarning(SECURITY_CRYPTO, "Error decoding content");
@@ -1051,8 +1134,13 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
     uint32_t session_id;
     memcpy(&session_id, header.session_id.data(), 4);
     //Sessionkey
-    std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    std::unique_lock<std::mutex> lock(sending_writer->decode_mutex_);
+    DecodeSessionData* session = get_decode_session(sending_writer->DecodeSessions,
+            sending_writer->Entity2RemoteKeyMaterial, *keyMat, session_id);
+    if (session == nullptr)
+    {
+        return false;
+    }
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1111,7 +1199,7 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
                 keyMat->receiver_specific_key_id,
                 keyMat->master_receiver_specific_key,
                 keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, *session, exception))
         {
             return false;
         }
@@ -1131,7 +1219,7 @@ bool AESGCMGMAC_Transform::decode_datawriter_submessage(
     uint32_t length = plain_rtps_submessage.max_size - plain_rtps_submessage.pos;
     if (!deserialize_SecureDataBody(decoder, is_encrypted ? body_state : protected_body_state, tag,
             is_encrypted ? body_length : body_length + 4,
-            keyMat->transformation_kind, session_key, initialization_vector,
+            keyMat->transformation_kind, *session, initialization_vector,
             &plain_rtps_submessage.buffer[plain_rtps_submessage.pos], length))
     {
         logWarning(SECURITY_CRYPTO, "Error decoding content");
@@ -1231,8 +1319,13 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
     uint32_t session_id;
     memcpy(&session_id, header.session_id.data(), 4);
     //Sessionkey
-    std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    std::unique_lock<std::mutex> lock(sending_reader->decode_mutex_);
+    DecodeSessionData* session = get_decode_session(sending_reader->DecodeSessions,
+            sending_reader->Entity2RemoteKeyMaterial, *keyMat, session_id);
+    if (session == nullptr)
+    {
+        return false;
+    }
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1291,7 +1384,7 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
                 keyMat->receiver_specific_key_id,
                 keyMat->master_receiver_specific_key,
                 keyMat->master_salt,
-                initialization_vector, session_id, exception))
+                initialization_vector, *session, exception))
         {
             return false;
         }
@@ -1311,7 +1404,7 @@ bool AESGCMGMAC_Transform::decode_datareader_submessage(
     uint32_t length = plain_rtps_submessage.max_size - plain_rtps_submessage.pos;
     if (!deserialize_SecureDataBody(decoder, is_encrypted ? body_state : protected_body_state, tag,
             is_encrypted ? body_length : body_length + 4,
-            keyMat->transformation_kind, session_key, initialization_vector,
+            keyMat->transformation_kind, *session, initialization_vector,
             &plain_rtps_submessage.buffer[plain_rtps_submessage.pos], length))
     {
         logWarning(SECURITY_CRYPTO, "Error decoding content");
@@ -1387,8 +1480,13 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
     memcpy(&session_id, header.session_id.data(), 4);
 
     //Sessionkey
-    std::array<uint8_t, 32> session_key{};
-    compute_sessionkey(session_key, *keyMat, session_id);
+    std::unique_lock<std::mutex> lock(sending_writer->decode_mutex_);
+    DecodeSessionData* session = get_decode_session(sending_writer->DecodeSessions,
+            sending_writer->Entity2RemoteKeyMaterial, *keyMat, session_id);
+    if (session == nullptr)
+    {
+        return false;
+    }
     //IV
     std::array<uint8_t, 12> initialization_vector{};
     memcpy(initialization_vector.data(), header.session_id.data(), 4);
@@ -1428,7 +1526,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
     // Tag
     try
     {
-        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, 0, exception);
+        deserialize_SecureDataTag(decoder, tag, {}, {}, {}, {}, {}, *session, exception);
     }
     catch (eprosima::fastcdr::exception::NotEnoughMemoryException&)
     {
@@ -1438,7 +1536,7 @@ bool AESGCMGMAC_Transform::decode_serialized_payload(
 
     uint32_t length = plain_payload.max_size;
     if (!deserialize_SecureDataBody(decoder, protected_body_state, tag, body_length,
-            keyMat->transformation_kind, session_key, initialization_vector,
+            keyMat->transformation_kind, *session, initialization_vector,
             plain_payload.data, length))
     {
         logWarning(SECURITY_CRYPTO, "Error decoding content");
@@ -1492,28 +1590,95 @@ void AESGCMGMAC_Transform::compute_sessionkey(
     memcpy(source + sourceLen, &session_id, 4);
     sourceLen += 4;
 
-    EVP_PKEY* key = EVP_PKEY_new_mac_key(EVP_PKEY_HMAC, NULL, master_key.data(), key_len);
-    EVP_MD_CTX* ctx =
-#if IS_OPENSSL_1_1
-            EVP_MD_CTX_new();
-#else
-            (EVP_MD_CTX*)malloc(sizeof(EVP_MD_CTX));
-#endif // if IS_OPENSSL_1_1
-    EVP_MD_CTX_init(ctx);
-    EVP_DigestSignInit(ctx, NULL, EVP_sha256(), NULL, key);
-    EVP_DigestSignUpdate(ctx, source, sourceLen);
-
-    size_t finalLen;
-    EVP_DigestSignFinal(ctx, NULL, &finalLen);
-    EVP_DigestSignFinal(ctx, session_key.data(), &finalLen);
-
-    EVP_PKEY_free(key);
-#if IS_OPENSSL_1_1
-    EVP_MD_CTX_free(ctx);
-#else
-    EVP_MD_CTX_cleanup(ctx);
-    free(ctx);
-#endif // if IS_OPENSSL_1_1
+    // One-shot HMAC, as it avoids allocating a key and a digest context for every session key
+    unsigned int finalLen = static_cast<unsigned int>(session_key.size());
+    HMAC(EVP_sha256(), master_key.data(), key_len, source, sourceLen, session_key.data(), &finalLen);
+}
+
+bool AESGCMGMAC_Transform::init_session_context(
+        KeySessionData& session,
+        const CryptoTransformKind& transformation_kind)
+{
+    bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
+            transformation_kind == c_transfrom_kind_aes256_gmac);
+
+    if (session.SessionCtx == nullptr)
+    {
+        session.SessionCtx = EVP_CIPHER_CTX_new();
+    }
+
+    if (!EVP_EncryptInit_ex(session.SessionCtx, use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(), NULL,
+            (const unsigned char*)session.SessionKey.data(), NULL))
+    {
+        logError(SECURITY_CRYPTO, "Unable to set the session key. EVP_EncryptInit_ex function returns an error");
+        return false;
+    }
+
+    return true;
+}
+
+DecodeSessionData* AESGCMGMAC_Transform::get_decode_session(
+        DecodeSessionData_Seq& sessions,
+        const KeyMaterial_AES_GCM_GMAC_Seq& key_materials,
+        const KeyMaterial_AES_GCM_GMAC& key_mat,
+        uint32_t session_id)
+{
+    DecodeSessionData* session = nullptr;
+    for (auto& it : sessions)
+    {
+        if (it->key_material.sender_key_id == key_mat.sender_key_id)
+        {
+            session = it.get();
+            break;
+        }
+    }
+
+    if (session == nullptr)
+    {
+        // Forget the sessions of the KeyMaterials that have been replaced
+        sessions.erase(std::remove_if(sessions.begin(), sessions.end(),
+                [&key_materials](const std::unique_ptr<DecodeSessionData>& old_session)
+                {
+                    return std::none_of(key_materials.begin(), key_materials.end(),
+                    [&old_session](const KeyMaterial_AES_GCM_GMAC& key)
+                    {
+                        return key.sender_key_id == old_session->key_material.sender_key_id;
+                    });
+                }), sessions.end());
+
+        sessions.emplace_back(new DecodeSessionData());
+        session = sessions.back().get();
+        session->SessionCtx = EVP_CIPHER_CTX_new();
+        session->ReceiverSpecificCtx = EVP_CIPHER_CTX_new();
+    }
+    else if (session->session_ready && session->session_id == session_id &&
+            is_same_key_material(session->key_material, key_mat))
+    {
+        return session;
+    }
+
+    session->key_material = key_mat;
+
+    bool use_256_bits = (key_mat.transformation_kind == c_transfrom_kind_aes256_gcm ||
+            key_mat.transformation_kind == c_transfrom_kind_aes256_gmac);
+
+    std::array<uint8_t, 32> session_key{};
+    compute_sessionkey(session_key, key_mat, session_id);
+
+    // The session is not valid until the new key is set, so a failure is retried on the next message
+    session->session_id = session_id;
+    session->session_ready = false;
+    session->receiver_specific_ready = false;
+
+    if (!EVP_DecryptInit_ex(session->SessionCtx, use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(), NULL,
+            (const unsigned char*)session_key.data(), NULL))
+    {
+        logError(SECURITY_CRYPTO, "Unable to set the session key. EVP_DecryptInit_ex function returns an error");
+        return nullptr;
+    }
+
+    session->session_ready = true;
+    return session;
 }
 
 void AESGCMGMAC_Transform::serialize_SecureDataHeader(
@@ -1529,7 +1694,7 @@ void AESGCMGMAC_Transform::serialize_SecureDataHeader(
 bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         eprosima::fastcdr::Cdr& serializer,
         const std::array<uint8_t, 4>& transformation_kind,
-        const std::array<uint8_t, 32>& session_key,
+        KeySessionData& session,
         const std::array<uint8_t, 12>& initialization_vector,
         eprosima::fastcdr::FastBuffer& output_buffer,
         octet* plain_buffer,
@@ -1539,36 +1704,16 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 {
     bool do_encryption = (transformation_kind == c_transfrom_kind_aes128_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gcm);
-    bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
-            transformation_kind == c_transfrom_kind_aes256_gmac);
 
+    // The session key was set on the context when the session started, only the IV changes between messages
     // AES_BLOCK_SIZE = 16
-    int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* e_ctx = session.SessionCtx;
+    int cipher_block_size = EVP_CIPHER_CTX_block_size(e_ctx), actual_size = 0, final_size = 0;
 
-    if (!use_256_bits)
+    if (!EVP_EncryptInit_ex(e_ctx, NULL, NULL, NULL, initialization_vector.data()))
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
-    }
-    else
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
+        logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit_ex function returns an error");
+        return false;
     }
 
     if (!do_encryption)
@@ -1578,7 +1723,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             logError(SECURITY_CRYPTO, "Not enough memory to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.getCurrentPosition(), plain_buffer, plain_buffer_len);
@@ -1587,14 +1731,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         if (!EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, plain_buffer, static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, nullptr, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, nullptr, &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
     }
@@ -1638,7 +1780,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             logError(SECURITY_CRYPTO, "Not enough memory to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1646,14 +1787,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, &output_buffer_raw[actual_size], &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, &output_buffer_raw[actual_size], &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
 
@@ -1679,7 +1818,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1751,59 +1889,25 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
         }
 
         //Update the key if needed
-        if (update_specific_keys || remote_entity->Sessions[sessionIndex].session_id != session_id)
+        KeySessionData& session = remote_entity->Sessions[sessionIndex];
+        if (update_specific_keys || session.session_id != session_id || session.SessionCtx == nullptr)
         {
             //Update triggered!
-            remote_entity->Sessions[sessionIndex].session_id = session_id;
-            compute_sessionkey(remote_entity->Sessions[sessionIndex].SessionKey, true,
+            compute_sessionkey(session.SessionKey, true,
                     keyMat.master_receiver_specific_key, keyMat.master_salt, session_id, key_len);
-        }
-
-        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
-        int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
+            if (!init_session_context(session, transformation_kind))
             {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
                 continue;
             }
+            session.session_id = session_id;
         }
-        if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
-        {
-            logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+
+        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
+        if (!compute_receiver_mac(session.SessionCtx, initialization_vector, tag.common_mac, tag.receiver_mac))
         {
-            logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
-        EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
-        serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
+        serializer << keyMat.receiver_specific_key_id << tag.receiver_mac;
 
         ++length;
     }
@@ -1860,62 +1964,27 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
         int key_len = use_256_bits ? 32 : 16;
 
         //Update the key if needed
-        if ((update_specific_keys || remote_participant->Session.session_id != local_participant->Session.session_id) &&
-                (*remote_participant != *local_participant))
+        KeySessionData& session = remote_participant->Session;
+        if ((update_specific_keys || session.session_id != local_participant->Session.session_id ||
+                session.SessionCtx == nullptr) && (*remote_participant != *local_participant))
         {
             //Update triggered!
-            remote_participant->Session.session_id = local_participant->Session.session_id;
-            compute_sessionkey(remote_participant->Session.SessionKey, true,
-                    keyMat.master_receiver_specific_key, keyMat.master_salt, remote_participant->Session.session_id,
+            compute_sessionkey(session.SessionKey, true,
+                    keyMat.master_receiver_specific_key, keyMat.master_salt, local_participant->Session.session_id,
                     key_len);
-        }
-
-        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
-        int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
+            if (!init_session_context(session, keyMat.transformation_kind))
             {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
                 continue;
             }
+            session.session_id = local_participant->Session.session_id;
         }
-        if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
-        {
-            logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            continue;
-        }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+
+        //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
+        if (!compute_receiver_mac(session.SessionCtx, initialization_vector, tag.common_mac, tag.receiver_mac))
         {
-            logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
-        EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
-        serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
+        serializer << keyMat.receiver_specific_key_id << tag.receiver_mac;
 
         ++length;
     }
@@ -1944,7 +2013,7 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         SecureDataTag& tag,
         const uint32_t body_length,
         const std::array<uint8_t, 4>& transformation_kind,
-        const std::array<uint8_t, 32>& session_key,
+        DecodeSessionData& session,
         const std::array<uint8_t, 12>& initialization_vector,
         octet* plain_buffer,
         uint32_t& plain_buffer_len)
@@ -1954,35 +2023,15 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
 
     bool do_encryption = (transformation_kind == c_transfrom_kind_aes128_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gcm);
-    bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
-            transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
-    int cipher_block_size = 0, actual_size = 0, final_size = 0;
+    // The session key was set on the context when the session started, only the IV changes between messages
+    EVP_CIPHER_CTX* d_ctx = session.SessionCtx;
+    int cipher_block_size = EVP_CIPHER_CTX_block_size(d_ctx), actual_size = 0, final_size = 0;
 
-    if (!use_256_bits)
+    if (!EVP_DecryptInit_ex(d_ctx, NULL, NULL, NULL, initialization_vector.data()))
     {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
-    }
-    else
-    {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
+        logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit_ex function returns an error");
+        return false;
     }
 
     uint32_t protected_len = body_length;
@@ -1995,7 +2044,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             logWarning(SECURITY_CRYPTO, "Not enough memory to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -2005,19 +2053,16 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     if (!EVP_DecryptUpdate(d_ctx, output_buffer, &actual_size, input_buffer, protected_len))
     {
         logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
     EVP_CIPHER_CTX_ctrl(d_ctx, EVP_CTRL_GCM_SET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
 
-    if (!EVP_DecryptFinal(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
+    if (!EVP_DecryptFinal_ex(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
     {
-        logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
+        logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal_ex function returns an error");
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2084,7 +2129,7 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         const std::array<uint8_t, 32>& receiver_specific_key,
         const std::array<uint8_t, 32>& master_salt,
         const std::array<uint8_t, 12>& initialization_vector,
-        const uint32_t session_id,
+        DecodeSessionData& session,
         SecurityException& exception)
 {
     decoder >> tag.common_mac;
@@ -2119,39 +2164,51 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
-        const EVP_CIPHER* d_cipher = nullptr;
+        EVP_CIPHER_CTX* d_ctx = session.ReceiverSpecificCtx;
 
         int actual_size = 0, final_size = 0;
 
-        //Get ReceiverSpecificSessionKey
-        std::array<uint8_t, 32> specific_session_key{};
-
-        //Verify specific MAC
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 16);
-            d_cipher = EVP_aes_128_gcm();
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
-        {
-            compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt, session_id, 32);
-            d_cipher = EVP_aes_256_gcm();
-        }
-        else
+        //Get ReceiverSpecificSessionKey, once per session
+        if (!session.receiver_specific_ready)
         {
-            logError(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
+            std::array<uint8_t, 32> specific_session_key{};
+            const EVP_CIPHER* d_cipher = nullptr;
+
+            if (transformation_kind == c_transfrom_kind_aes128_gcm ||
+                    transformation_kind == c_transfrom_kind_aes128_gmac)
+            {
+                compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt,
+                        session.session_id, 16);
+                d_cipher = EVP_aes_128_gcm();
+            }
+            else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
+                    transformation_kind == c_transfrom_kind_aes256_gmac)
+            {
+                compute_sessionkey(specific_session_key, true, receiver_specific_key, master_salt,
+                        session.session_id, 32);
+                d_cipher = EVP_aes_256_gcm();
+            }
+            else
+            {
+                logError(SECURITY_CRYPTO, "Invalid transformation kind)");
+                return false;
+            }
+
+            if (!EVP_DecryptInit_ex(d_ctx, d_cipher, NULL, (const unsigned char*)specific_session_key.data(), NULL))
+            {
+                logError(SECURITY_CRYPTO,
+                        "Unable to authenticate the message. EVP_DecryptInit_ex function returns an error");
+                return false;
+            }
+
+            session.receiver_specific_ready = true;
         }
 
-        if (!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char*)specific_session_key.data(),
-                initialization_vector.data()))
+        //Verify specific MAC
+        if (!EVP_DecryptInit_ex(d_ctx, NULL, NULL, NULL, initialization_vector.data()))
         {
-            logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
+            logError(SECURITY_CRYPTO,
+                    "Unable to authenticate the message. EVP_DecryptInit_ex function returns an error");
             return false;
         }
 
@@ -2159,7 +2216,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2167,7 +2223,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2175,11 +2230,8 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
-
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
@@ -118,6 +118,32 @@ public:
             const KeyMaterial_AES_GCM_GMAC& key,
             const uint32_t session_id);
 
+    /**
+     * Set the current session key of an encode session on its cipher context, creating the context if needed.
+     * @param session Session whose SessionKey has just been computed
+     * @param transformation_kind Transformation the session key is used with
+     * @return false when the key could not be set
+     */
+    bool init_session_context(
+            KeySessionData& session,
+            const CryptoTransformKind& transformation_kind);
+
+    /**
+     * Get the decode session of a KeyMaterial of a remote element, setting the keys of a new session on it.
+     * Sessions of KeyMaterials the remote element no longer has are removed when a new one is added.
+     * Has to be called with the mutex of the remote CryptoHandle taken.
+     * @param sessions Decode sessions of the remote CryptoHandle
+     * @param key_materials KeyMaterials of the remote CryptoHandle
+     * @param key_mat KeyMaterial of the remote element the message was encoded with
+     * @param session_id Session of the message
+     * @return nullptr when the session key could not be set
+     */
+    DecodeSessionData* get_decode_session(
+            DecodeSessionData_Seq& sessions,
+            const KeyMaterial_AES_GCM_GMAC_Seq& key_materials,
+            const KeyMaterial_AES_GCM_GMAC& key_mat,
+            uint32_t session_id);
+
     //Serialization and deserialization of message components
     void serialize_SecureDataHeader(
             eprosima::fastcdr::Cdr& serializer,
@@ -129,7 +155,7 @@ public:
     bool serialize_SecureDataBody(
             eprosima::fastcdr::Cdr& serializer,
             const std::array<uint8_t, 4>& transformation_kind,
-            const std::array<uint8_t, 32>& session_key,
+            KeySessionData& session,
             const std::array<uint8_t, 12>& initialization_vector,
             eprosima::fastcdr::FastBuffer& output_buffer,
             octet* plain_buffer,
@@ -176,7 +202,7 @@ public:
             SecureDataTag& tag,
             uint32_t body_length,
             const std::array<uint8_t, 4>& transformation_kind,
-            const std::array<uint8_t, 32>& session_key,
+            DecodeSessionData& session,
             const std::array<uint8_t, 12>& initialization_vector,
             octet* plain_buffer,
             uint32_t& plain_buffer_len);
@@ -189,7 +215,7 @@ public:
             const std::array<uint8_t, 32>& receiver_specific_key,
             const std::array<uint8_t, 32>& master_salt,
             const std::array<uint8_t, 12>& initialization_vector,
-            uint32_t session_id,
+            DecodeSessionData& session,
             SecurityException& exception);
 
     uint32_t calculate_extra_size_for_rtps_message(
@@ -26,6 +26,9 @@
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
+#include <openssl/evp.h>
+
+#include <memory>
 #include <mutex>
 #include <limits>
 
@@ -135,11 +138,63 @@ struct SecureDataTag
 
 struct KeySessionData
 {
+    KeySessionData() = default;
+
+    KeySessionData(
+            const KeySessionData&) = delete;
+
+    KeySessionData& operator =(
+            const KeySessionData&) = delete;
+
+    ~KeySessionData()
+    {
+        EVP_CIPHER_CTX_free(SessionCtx);
+    }
+
     uint32_t session_id = std::numeric_limits<uint32_t>::max();
     std::array<uint8_t, 32> SessionKey = c_empty_key_material;
     uint64_t session_block_counter = 0;
+    //Context keyed with SessionKey when the session starts, so only the IV is set on it for each message
+    EVP_CIPHER_CTX* SessionCtx = nullptr;
 };
 
+/* Decode Sessions
+ * ---------------
+ * Session keys used to decode the messages of a remote element, derived once per session instead of once per message.
+ * There is an instance for each KeyMaterial of the remote element, holding the session it last received.
+ * Each cipher context is initialized with its session key, and only the IV is set on it for each message.
+ * The instance keeps a copy of the KeyMaterial, so new keys announced with the same ids are not decoded with the old
+ * ones.
+ */
+struct DecodeSessionData
+{
+    DecodeSessionData() = default;
+
+    DecodeSessionData(
+            const DecodeSessionData&) = delete;
+
+    DecodeSessionData& operator =(
+            const DecodeSessionData&) = delete;
+
+    ~DecodeSessionData()
+    {
+        EVP_CIPHER_CTX_free(SessionCtx);
+        EVP_CIPHER_CTX_free(ReceiverSpecificCtx);
+    }
+
+    //KeyMaterial the session keys are derived from
+    KeyMaterial_AES_GCM_GMAC key_material;
+    uint32_t session_id = std::numeric_limits<uint32_t>::max();
+    //Context keyed with the session key, used to decode the body
+    EVP_CIPHER_CTX* SessionCtx = nullptr;
+    bool session_ready = false;
+    //Context keyed with the receiver specific session key, derived on the first message with a receiver specific MAC
+    EVP_CIPHER_CTX* ReceiverSpecificCtx = nullptr;
+    bool receiver_specific_ready = false;
+};
+
+typedef std::vector<std::unique_ptr<DecodeSessionData>> DecodeSessionData_Seq;
+
 struct EntityKeyHandle
 {
     static const char* const class_id_;
@@ -162,6 +217,9 @@ struct EntityKeyHandle
     //Data used to store the current session keys and to determine when it has to be updated
     KeySessionData Sessions[2];
     uint64_t max_blocks_per_session = 0;
+    //Sessions used to decode the messages of a RemoteCryptoHandle, one per KeyMaterial in Entity2RemoteKeyMaterial
+    DecodeSessionData_Seq DecodeSessions;
+    std::mutex decode_mutex_;
     std::mutex mutex_;
 };
 
@@ -191,6 +249,10 @@ struct ParticipantKeyHandle
     //Data used to store the current session keys and to determine when it has to be updated
     KeySessionData Session;
     uint64_t max_blocks_per_session = 0;
+    //Sessions used to decode the messages of a RemoteCryptoHandle, one per KeyMaterial in
+    //RemoteParticipant2ParticipantKeyMaterial. Mutable, as remote participants are decoded through const handles.
+    mutable DecodeSessionData_Seq DecodeSessions;
+    mutable std::mutex decode_mutex_;
     std::mutex mutex_;
 };
 
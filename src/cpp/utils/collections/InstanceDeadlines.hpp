@@ -0,0 +1,126 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceDeadlines.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_INSTANCEDEADLINES_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_INSTANCEDEADLINES_HPP_
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+#include <chrono>
+#include <set>
+#include <utility>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief Index of the deadlines of the instances of a history, ordered by time.
+ *
+ * The owner keeps the current deadline of each instance (i.e. on its KeyedChanges), and passes it when the deadline
+ * changes or the instance is removed, so every operation is logarithmic on the number of instances.
+ */
+class InstanceDeadlines
+{
+public:
+
+    using time_point = std::chrono::steady_clock::time_point;
+
+    /**
+     * @brief Start tracking an instance
+     * @param handle The instance handle
+     * @param deadline The current deadline of the instance
+     */
+    void add(
+            const rtps::InstanceHandle_t& handle,
+            const time_point& deadline)
+    {
+        deadlines_.emplace(deadline, handle);
+    }
+
+    /**
+     * @brief Change the deadline of an instance
+     * @param handle The instance handle
+     * @param old_deadline The deadline the instance was tracked with
+     * @param new_deadline The new deadline of the instance
+     */
+    void update(
+            const rtps::InstanceHandle_t& handle,
+            const time_point& old_deadline,
+            const time_point& new_deadline)
+    {
+        deadlines_.erase(entry(old_deadline, handle));
+        deadlines_.emplace(new_deadline, handle);
+    }
+
+    /**
+     * @brief Stop tracking an instance
+     * @param handle The instance handle
+     * @param deadline The deadline the instance was tracked with
+     */
+    void remove(
+            const rtps::InstanceHandle_t& handle,
+            const time_point& deadline)
+    {
+        deadlines_.erase(entry(deadline, handle));
+    }
+
+    /**
+     * @brief Get the instance that is next going to miss its deadline
+     * @param handle The handle of the instance
+     * @param deadline The time point when the deadline will occur
+     * @return False if no instance is being tracked
+     */
+    bool next(
+            rtps::InstanceHandle_t& handle,
+            time_point& deadline) const
+    {
+        if (deadlines_.empty())
+        {
+            return false;
+        }
+
+        handle = deadlines_.begin()->second;
+        deadline = deadlines_.begin()->first;
+        return true;
+    }
+
+    //! Stop tracking all the instances
+    void clear()
+    {
+        deadlines_.clear();
+    }
+
+    //! Number of instances being tracked
+    size_t size() const
+    {
+        return deadlines_.size();
+    }
+
+private:
+
+    using entry = std::pair<time_point, rtps::InstanceHandle_t>;
+
+    //! Instances ordered by deadline, with the handle breaking ties
+    std::set<entry> deadlines_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_INSTANCEDEADLINES_HPP_ */
@@ -158,3 +158,46 @@ TEST(AcknackQos, NotRecoverAfterLosingCommunicationWithDisablePositiveAck)
     // Block reader until reception finished or timeout.
     ASSERT_EQ(reader.block_for_all(std::chrono::seconds(1)), 0u);
 }
+
+TEST(AcknackQos, RecoverLostSamplesWithControlMessageCoalescing)
+{
+    // This test makes both participants coalesce their control messages, and checks that a reliable reader still
+    // recovers the samples lost by the network through the heartbeats and ACKNACKs held on the coalescing window.
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    PropertyPolicy property_policy;
+    property_policy.properties().emplace_back("fastdds.control_coalescing.window_us", "2000");
+
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 40;
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS);
+    writer.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    writer.heartbeat_period_seconds(0);
+    writer.heartbeat_period_nanosec(100000000);
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+    writer.property_policy(property_policy).init();
+
+    reader.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS);
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    reader.property_policy(property_policy).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    std::list<HelloWorld> data = default_helloworld_data_generator();
+    reader.startReception(data);
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
@@ -21,6 +21,7 @@
 
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastdds/rtps/attributes/EndpointAttributes.h>
+#include <fastdds/rtps/common/Guid.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -34,6 +35,11 @@ public:
 
     virtual ~Endpoint() = default;
 
+    const GUID_t& getGuid() const
+    {
+        return m_guid;
+    }
+
     inline RecursiveTimedMutex& getMutex()
     {
         return mp_mutex;
@@ -48,6 +54,7 @@ public:
     bool supports_rtps_protection_;
 #endif // HAVE_SECURITY
 
+    GUID_t m_guid;
     mutable RecursiveTimedMutex mp_mutex;
     EndpointAttributes m_att;
     RTPSParticipantImpl* mp_RTPSParticipant;
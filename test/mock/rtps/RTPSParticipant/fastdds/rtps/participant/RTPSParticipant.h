@@ -52,6 +52,7 @@ class RTPSWriter;
 class RTPSReader;
 class WriterProxyData;
 class ReaderProxyData;
+struct ContentFilterProperty;
 class ResourceEvent;
 class WLP;
 
@@ -127,15 +128,17 @@ public:
                 const TopicAttributes& topicAtt,
                 const WriterQos& wqos));
 
-    MOCK_METHOD3(registerReader, bool(
+    MOCK_METHOD4(registerReader, bool(
                 RTPSReader * Reader,
                 const TopicAttributes& topicAtt,
-                const ReaderQos& rqos));
+                const ReaderQos& rqos,
+                const ContentFilterProperty* content_filter));
 
-    MOCK_METHOD3(updateReader, bool(
+    MOCK_METHOD4(updateReader, bool(
                 RTPSReader * Reader,
                 const TopicAttributes& topicAtt,
-                const ReaderQos& rqos));
+                const ReaderQos& rqos,
+                const ContentFilterProperty* content_filter));
 
     const RTPSParticipantAttributes& getRTPSParticipantAttributes()
     {
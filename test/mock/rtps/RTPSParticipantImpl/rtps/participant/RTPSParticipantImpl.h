@@ -31,7 +31,9 @@
 #include <fastrtps/rtps/participant/RTPSParticipantListener.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/network/NetworkFactory.h>
+#include <fastdds/rtps/network/NetworkBuffer.hpp>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <rtps/messages/RTPSMessageGroup_t.hpp>
 
 #if HAVE_SECURITY
 #include <fastrtps/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
@@ -127,10 +129,15 @@ public:
     MOCK_METHOD0(userReadersListBegin, std::vector<RTPSReader*>::iterator ());
     MOCK_METHOD0(userReadersListEnd, std::vector<RTPSReader*>::iterator ());
 
+    MOCK_CONST_METHOD1(userWritersOnTopic, const std::vector<RTPSWriter*>* (const std::string& topic_name));
+    MOCK_CONST_METHOD1(userReadersOnTopic, const std::vector<RTPSReader*>* (const std::string& topic_name));
+
     MOCK_METHOD0(async_thread, AsyncWriterThread & ());
 
     MOCK_CONST_METHOD0(getParticipantMutex, std::recursive_mutex* ());
 
+    MOCK_METHOD1(assert_remote_participant_liveliness, void(const GuidPrefix_t& remote_guid));
+
     bool createWriter(
             RTPSWriter** writer,
             WriterAttributes& param,
@@ -243,6 +250,31 @@ public:
         return 65536;
     }
 
+    template<class LocatorIteratorT>
+    bool send_control(
+            const NetworkBufferList& /*buffers*/,
+            uint32_t /*total_bytes*/,
+            const LocatorIteratorT& /*destination_locators_begin*/,
+            const LocatorIteratorT& /*destination_locators_end*/,
+            std::chrono::steady_clock::time_point& /*max_blocking_time_point*/)
+    {
+        return true;
+    }
+
+    std::unique_ptr<RTPSMessageGroup_t> get_send_buffer()
+    {
+        return std::unique_ptr<RTPSMessageGroup_t>(new RTPSMessageGroup_t(
+#if HAVE_SECURITY
+                           false,
+#endif // if HAVE_SECURITY
+                           getMaxMessageSize(), getGuid().guidPrefix));
+    }
+
+    void return_send_buffer(
+            std::unique_ptr <RTPSMessageGroup_t>&& /*buffer*/)
+    {
+    }
+
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
     {
         return attr_;
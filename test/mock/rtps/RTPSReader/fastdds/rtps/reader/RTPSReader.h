@@ -63,11 +63,6 @@ public:
     virtual bool matched_writer_is_matched(
             const GUID_t& wguid) = 0;
 
-    const GUID_t& getGuid()
-    {
-        return m_guid;
-    }
-
     ReaderListener* getListener() const
     {
         return listener_;
@@ -162,6 +157,11 @@ public:
         return history_;
     }
 
+    uint64_t get_unread_count() const
+    {
+        return 0;
+    }
+
     bool is_sample_valid(
             const void* /*data*/,
             const GUID_t& /*writer*/,
@@ -197,7 +197,11 @@ public:
 
     ReaderListener* listener_;
 
-    const GUID_t m_guid;
+    bool m_acceptMessagesToUnknownReaders = true;
+
+    bool m_acceptMessagesFromUnkownWriters = false;
+
+    EntityId_t m_trustedWriterEntityId;
 };
 
 } // namespace rtps
@@ -25,6 +25,7 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 #include <fastdds/rtps/messages/RTPSMessageGroup.h>
 
+#include <chrono>
 #include <condition_variable>
 #include <gmock/gmock.h>
 
@@ -143,6 +144,20 @@ public:
         return true;
     }
 
+    virtual bool has_only_local_readers() const
+    {
+        return false;
+    }
+
+    void begin_batch(
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+    }
+
+    void end_batch()
+    {
+    }
+
     virtual bool process_acknack(
             const GUID_t& writer_guid,
             const GUID_t& reader_guid,
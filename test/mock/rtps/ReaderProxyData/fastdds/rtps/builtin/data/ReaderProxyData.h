@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/common/RemoteLocators.hpp>
 #include <fastrtps/qos/ReaderQos.h>
 #include <fastrtps/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
+#include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 
 #if HAVE_SECURITY
 #include <fastrtps/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
@@ -272,6 +273,27 @@ public:
         return type_info_;
     }
 
+    void content_filter(
+            const ContentFilterProperty& filter)
+    {
+        content_filter_ = filter;
+    }
+
+    const ContentFilterProperty& content_filter() const
+    {
+        return content_filter_;
+    }
+
+    ContentFilterProperty& content_filter()
+    {
+        return content_filter_;
+    }
+
+    bool has_content_filter() const
+    {
+        return !content_filter_.filter_expression.empty();
+    }
+
     void key(
             const InstanceHandle_t& key)
     {
@@ -357,6 +379,7 @@ private:
     TypeIdV1 type_id_;
     TypeObjectV1 type_;
     xtypes::TypeInformation type_info_;
+    ContentFilterProperty content_filter_;
     InstanceHandle_t m_key;
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
@@ -0,0 +1,253 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_BackupTest.cpp
+ *
+ * Measures the cost of restoring a Discovery Server backup on databases with many entities. A BACKUP server is
+ * started on a journal holding the DATA(p) and one DATA(w) of each remote participant, which it replays through its
+ * PDP and EDP readers. Once the server has compacted the journal into a json snapshot, it is started again on the
+ * snapshot alone. Both times are measured around the creation of the server, which restores the backup before
+ * returning.
+ * Usage: BackupTest [entities]
+ */
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::ddb::DiscoveryJournal;
+using std::chrono::steady_clock;
+
+static const char* server_prefix = "44.53.00.5f.45.50.52.4f.53.49.4d.41";
+static const uint32_t server_port = 11611;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+//! Name of the server backup files, without extension, as PDPServer builds it
+static std::string backup_file_name()
+{
+    GuidPrefix_t prefix;
+    std::istringstream(server_prefix) >> prefix;
+    std::ostringstream name;
+    name << "server-" << prefix;
+    std::string file_name = name.str();
+    std::replace(file_name.begin(), file_name.end(), '.', '-');
+    return file_name;
+}
+
+static std::streamoff file_size(
+        const std::string& file_name)
+{
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+    return file.is_open() ? static_cast<std::streamoff>(file.tellg()) : -1;
+}
+
+static void remove_backup_files(
+        const std::string& base_name)
+{
+    std::remove((base_name + ".json").c_str());
+    std::remove((base_name + "_queue.bin").c_str());
+    std::remove((base_name + "_writer.db").c_str());
+    std::remove((base_name + "_reader.db").c_str());
+}
+
+static void append(
+        DiscoveryJournal& journal,
+        const CDRMessage_t& msg,
+        const GUID_t& writer_guid,
+        const GUID_t& entity_guid)
+{
+    CacheChange_t change(msg.length);
+    memcpy(change.serializedPayload.data, msg.buffer, msg.length);
+    change.serializedPayload.length = msg.length;
+    change.kind = ALIVE;
+    change.writerGUID = writer_guid;
+    change.instanceHandle = entity_guid;
+    change.sequenceNumber = SequenceNumber_t(0, 1);
+    change.write_params.sample_identity().writer_guid(writer_guid);
+    change.write_params.sample_identity().sequence_number(change.sequenceNumber);
+    change.write_params.related_sample_identity(change.write_params.sample_identity());
+    journal.append(change);
+}
+
+//! Append the DATA(p) of a remote client and the DATA(w) of one of its writers, as received by the server
+static void append_remote_participant(
+        DiscoveryJournal& journal,
+        uint32_t id)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0x0F;
+    for (size_t i = 0; i < sizeof(id); ++i)
+    {
+        prefix.value[4 + i] = static_cast<octet>(id >> (8 * i));
+    }
+
+    Locator_t locator;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    locator.port = 7400;
+
+    RTPSParticipantAllocationAttributes allocation;
+    ParticipantProxyData pdata(allocation);
+    pdata.m_guid = GUID_t(prefix, c_EntityId_RTPSParticipant);
+    pdata.m_key = pdata.m_guid;
+    pdata.m_VendorId = c_VendorId_eProsima;
+    pdata.m_availableBuiltinEndpoints = DISC_BUILTIN_ENDPOINT_PARTICIPANT_ANNOUNCER |
+            DISC_BUILTIN_ENDPOINT_PARTICIPANT_DETECTOR | DISC_BUILTIN_ENDPOINT_PUBLICATION_ANNOUNCER |
+            DISC_BUILTIN_ENDPOINT_PUBLICATION_DETECTOR | DISC_BUILTIN_ENDPOINT_SUBSCRIPTION_ANNOUNCER |
+            DISC_BUILTIN_ENDPOINT_SUBSCRIPTION_DETECTOR;
+    pdata.m_leaseDuration = eprosima::fastrtps::Duration_t(3600, 0);
+    pdata.m_participantName = "BackupTestClient";
+    pdata.metatraffic_locators.add_unicast_locator(locator);
+    pdata.default_locators.add_unicast_locator(locator);
+
+    CDRMessage_t pdata_msg(pdata.get_serialized_size(true));
+    pdata.writeToCDRMessage(&pdata_msg, true);
+    append(journal, pdata_msg, GUID_t(prefix, c_EntityId_SPDPWriter), pdata.m_guid);
+
+    EntityId_t writer_id;
+    writer_id.value[2] = 0x01;
+    writer_id.value[3] = 0x03;
+    WriterProxyData wdata(4, 1);
+    wdata.guid(GUID_t(prefix, writer_id));
+    wdata.key(wdata.guid());
+    wdata.RTPSParticipantKey(pdata.m_guid);
+    wdata.topicName("BackupTestTopic");
+    wdata.typeName("BackupTestType");
+
+    CDRMessage_t wdata_msg(wdata.get_serialized_size(true));
+    wdata.writeToCDRMessage(&wdata_msg, true);
+    append(journal, wdata_msg, GUID_t(prefix, c_EntityId_SEDPPubWriter), wdata.guid());
+}
+
+static DomainParticipant* create_server()
+{
+    DomainParticipantQos qos;
+    qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::BACKUP;
+    std::istringstream(server_prefix) >> qos.wire_protocol().prefix;
+    Locator_t locator;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    locator.port = server_port;
+    qos.wire_protocol().builtin.metatrafficUnicastLocatorList.push_back(locator);
+    return DomainParticipantFactory::get_instance()->create_participant(0, qos);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_entities = 10000;
+    if (argc > 1)
+    {
+        max_entities = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == max_entities)
+    {
+        std::cerr << "Usage: BackupTest [entities]" << std::endl;
+        return 1;
+    }
+
+    Log::SetVerbosity(Log::Error);
+    const std::string base_name = backup_file_name();
+    const std::string journal_file_name = base_name + "_queue.bin";
+    const std::string snapshot_file_name = base_name + ".json";
+
+    std::cout << std::setw(10) << "entities" << std::setw(18) << "journal add us" << std::setw(20)
+              << "journal restore ms" << std::setw(21) << "snapshot restore ms" << std::endl;
+
+    for (uint32_t num_entities = 100; num_entities <= max_entities; num_entities *= 10)
+    {
+        remove_backup_files(base_name);
+
+        // Journal appends, as stored for every change received
+        DiscoveryJournal journal;
+        journal.open(journal_file_name);
+        auto start = steady_clock::now();
+        for (uint32_t i = 0; i < num_entities; ++i)
+        {
+            append_remote_participant(journal, i);
+        }
+        double journal_add_us = elapsed_ms(start) * 1000.0 / (2.0 * num_entities);
+        journal.close();
+
+        // Restart on the journal alone, replaying every change through the PDP and EDP readers
+        start = steady_clock::now();
+        DomainParticipant* server = create_server();
+        double journal_restore_ms = elapsed_ms(start);
+        if (nullptr == server)
+        {
+            std::cerr << "Cannot create the server" << std::endl;
+            return 1;
+        }
+
+        // The replay makes the server compact the journal into a snapshot
+        auto deadline = steady_clock::now() + std::chrono::seconds(60);
+        while (!(file_size(snapshot_file_name) > 0 && file_size(journal_file_name) == 0))
+        {
+            if (steady_clock::now() > deadline)
+            {
+                std::cerr << "The server did not take a snapshot of " << num_entities << " entities" << std::endl;
+                DomainParticipantFactory::get_instance()->delete_participant(server);
+                return 1;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        DomainParticipantFactory::get_instance()->delete_participant(server);
+
+        // Restart on the snapshot alone
+        std::remove(journal_file_name.c_str());
+        start = steady_clock::now();
+        server = create_server();
+        double snapshot_restore_ms = elapsed_ms(start);
+        if (nullptr == server)
+        {
+            std::cerr << "Cannot create the server" << std::endl;
+            return 1;
+        }
+        DomainParticipantFactory::get_instance()->delete_participant(server);
+
+        std::cout << std::setw(10) << num_entities << std::fixed << std::setprecision(2)
+                  << std::setw(18) << journal_add_us << std::setw(20) << journal_restore_ms
+                  << std::setw(21) << snapshot_restore_ms << std::endl;
+    }
+
+    remove_backup_files(base_name);
+
+    return 0;
+}
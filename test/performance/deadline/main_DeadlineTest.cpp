@@ -0,0 +1,145 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DeadlineTest.cpp
+ *
+ * Measures the cost of a deadline event on histories with many instances: finding the instance that is next
+ * going to miss its deadline and moving its deadline forward, as the deadline timers of DataWriterImpl and
+ * DataReaderImpl do on every expiration.
+ * Usage: DeadlineTest [instances] [events]
+ */
+
+#include <fastrtps/common/KeyedChanges.h>
+
+#include <utils/collections/InstanceDeadlines.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <utility>
+
+using namespace eprosima::fastrtps;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using std::chrono::steady_clock;
+
+using InstanceMap = std::map<InstanceHandle_t, KeyedChanges>;
+
+static InstanceHandle_t make_handle(
+        size_t id)
+{
+    InstanceHandle_t handle;
+    for (size_t i = 0; i < sizeof(id); ++i)
+    {
+        handle.value[i] = static_cast<rtps::octet>(id >> (8 * i));
+    }
+    return handle;
+}
+
+static double run_scan(
+        InstanceMap& instances,
+        size_t events,
+        const steady_clock::duration& period)
+{
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < events; ++i)
+    {
+        auto min = std::min_element(instances.begin(), instances.end(),
+                        [](
+                            const std::pair<const InstanceHandle_t, KeyedChanges>& lhs,
+                            const std::pair<const InstanceHandle_t, KeyedChanges>& rhs)
+                        {
+                            return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
+                        });
+        min->second.next_deadline_us += period;
+    }
+    auto end = steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+static double run_index(
+        InstanceMap& instances,
+        size_t events,
+        const steady_clock::duration& period)
+{
+    InstanceDeadlines deadlines;
+    for (const auto& instance : instances)
+    {
+        deadlines.add(instance.first, instance.second.next_deadline_us);
+    }
+
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < events; ++i)
+    {
+        InstanceHandle_t handle;
+        steady_clock::time_point deadline;
+        deadlines.next(handle, deadline);
+        KeyedChanges& instance = instances.find(handle)->second;
+        deadlines.update(handle, instance.next_deadline_us, instance.next_deadline_us + period);
+        instance.next_deadline_us += period;
+    }
+    auto end = steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t max_instances = 100000;
+    size_t events = 1000;
+    if (argc > 1)
+    {
+        max_instances = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        events = static_cast<size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == max_instances || 0 == events)
+    {
+        std::cerr << "Usage: DeadlineTest [instances] [events]" << std::endl;
+        return 1;
+    }
+
+    const steady_clock::duration period = std::chrono::milliseconds(100);
+
+    std::cout << std::setw(12) << "instances" << std::setw(16) << "scan ns/event" << std::setw(16)
+              << "index ns/event" << std::endl;
+
+    for (size_t num_instances = 10; num_instances <= max_instances; num_instances *= 10)
+    {
+        // Spread the deadlines of the instances along a period
+        InstanceMap instances;
+        steady_clock::time_point now = steady_clock::now();
+        for (size_t i = 0; i < num_instances; ++i)
+        {
+            instances[make_handle(i)].next_deadline_us = now + (period * static_cast<int>(i)) /
+                    static_cast<int>(num_instances);
+        }
+        InstanceMap instances_copy = instances;
+
+        double scan_ns = run_scan(instances, events, period);
+        double index_ns = run_index(instances_copy, events, period);
+
+        std::cout << std::setw(12) << num_instances << std::fixed << std::setprecision(1)
+                  << std::setw(16) << scan_ns / static_cast<double>(events)
+                  << std::setw(16) << index_ns / static_cast<double>(events) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryTest.cpp
+ *
+ * Measures the time it takes for two participants with many endpoints to fully match.
+ * The first participant creates one writer on each of a number of topics, the second one creates one reader on each
+ * topic, and the time from the creation of the second participant until every writer is matched is reported.
+ * Usage: DiscoveryTest [topics] [domain]
+ */
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::types;
+
+class MatchCounter : public DataWriterListener
+{
+public:
+
+    void on_publication_matched(
+            DataWriter*,
+            const PublicationMatchedStatus& info) override
+    {
+        if (info.current_count_change > 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++matched_;
+            cv_.notify_all();
+        }
+    }
+
+    bool wait(
+            size_t expected,
+            const std::chrono::seconds& timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return matched_ >= expected;
+                       });
+    }
+
+    size_t matched()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return matched_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t matched_ = 0;
+};
+
+static TypeSupport create_type()
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+    builder->add_member(0, "index", factory->create_uint32_type());
+    builder->set_name("DiscoveryTestType");
+    return TypeSupport(new DynamicPubSubType(builder->build()));
+}
+
+static DomainParticipant* create_participant(
+        DomainId_t domain,
+        size_t num_topics,
+        std::vector<Topic*>& topics)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        return nullptr;
+    }
+
+    TypeSupport type = create_type();
+    type.register_type(participant);
+    for (size_t i = 0; i < num_topics; ++i)
+    {
+        topics.push_back(participant->create_topic("DiscoveryTest_" + std::to_string(i), type.get_type_name(),
+                TOPIC_QOS_DEFAULT));
+    }
+    return participant;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_topics = 1000;
+    DomainId_t domain = 0;
+    if (argc > 1)
+    {
+        num_topics = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        domain = static_cast<DomainId_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == num_topics)
+    {
+        std::cerr << "Usage: DiscoveryTest [topics] [domain]" << std::endl;
+        return 1;
+    }
+
+    MatchCounter counter;
+
+    // Writers side
+    std::vector<Topic*> pub_topics;
+    DomainParticipant* pub_participant = create_participant(domain, num_topics, pub_topics);
+    if (nullptr == pub_participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+    Publisher* publisher = pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    for (Topic* topic : pub_topics)
+    {
+        publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT, &counter);
+    }
+
+    // Readers side
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Topic*> sub_topics;
+    DomainParticipant* sub_participant = create_participant(domain, num_topics, sub_topics);
+    if (nullptr == sub_participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+    Subscriber* subscriber = sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    for (Topic* topic : sub_topics)
+    {
+        subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+    }
+
+    int result = 0;
+    if (counter.wait(num_topics, std::chrono::seconds(600)))
+    {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << num_topics << " writers matched in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << " ms" << std::endl;
+    }
+    else
+    {
+        std::cerr << "Only " << counter.matched() << " of " << num_topics << " writers matched" << std::endl;
+        result = 1;
+    }
+
+    sub_participant->delete_contained_entities();
+    pub_participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(sub_participant);
+    DomainParticipantFactory::get_instance()->delete_participant(pub_participant);
+    Log::KillThread();
+    return result;
+}
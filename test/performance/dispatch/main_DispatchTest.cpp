@@ -0,0 +1,278 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DispatchTest.cpp
+ *
+ * Measures how fast a participant dispatches the samples it receives on a single multicast group shared by many
+ * topics, each with its own best-effort DataReader. Samples are written on one topic only, and then on all of them in
+ * turn. Intraprocess delivery is disabled so the samples go through the transports.
+ * Usage: DispatchTest [topics] [samples]
+ */
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using eprosima::fastrtps::rtps::IPLocator;
+using eprosima::fastrtps::rtps::Locator_t;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+using std::chrono::steady_clock;
+
+static constexpr uint32_t sample_size = 64;
+
+struct Sample
+{
+    uint8_t data[sample_size];
+};
+
+// Serialized as the encapsulation and the bytes of the sample
+class SampleType : public TopicDataType
+{
+public:
+
+    SampleType()
+    {
+        setName("DispatchSample");
+        m_typeSize = 4 + sample_size;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        const uint8_t header[4] = {0, 1, 0, 0};
+        memcpy(payload->data, header, 4);
+        memcpy(payload->data + 4, static_cast<Sample*>(data)->data, sample_size);
+        payload->length = 4 + sample_size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < 4 + sample_size)
+        {
+            return false;
+        }
+        memcpy(static_cast<Sample*>(data)->data, payload->data + 4, sample_size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []()
+               {
+                   return 4 + sample_size;
+               };
+    }
+
+    void* createData() override
+    {
+        return new Sample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<Sample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+class CountingListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        Sample sample;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            ++received_;
+        }
+    }
+
+    std::atomic<size_t> received_{0};
+};
+
+// Waits for the samples still on their way to the readers, and returns how many arrived
+static size_t wait_received(
+        CountingListener& listener,
+        size_t expected)
+{
+    auto limit = steady_clock::now() + std::chrono::seconds(2);
+    while (listener.received_ < expected && steady_clock::now() < limit)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return listener.received_.exchange(0);
+}
+
+static void run(
+        const char* name,
+        const std::vector<DataWriter*>& writers,
+        CountingListener& listener,
+        size_t num_samples)
+{
+    Sample sample;
+    memset(sample.data, 0, sample_size);
+
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        writers[i % writers.size()]->write(&sample);
+    }
+    size_t received = wait_received(listener, num_samples);
+    double ms = std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+
+    std::cout << std::setw(12) << name << std::setw(12) << writers.size() << std::setw(12) << received
+              << std::fixed << std::setprecision(0) << std::setw(16) << received / ms * 1000.0 << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_topics = 500;
+    size_t num_samples = 100000;
+    if (argc > 1)
+    {
+        num_topics = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_samples = static_cast<size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == num_topics || 0 == num_samples)
+    {
+        std::cerr << "Usage: DispatchTest [topics] [samples]" << std::endl;
+        return 1;
+    }
+
+    eprosima::fastrtps::LibrarySettingsAttributes library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastrtps::INTRAPROCESS_OFF;
+    eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings(library_settings);
+
+    // All the user readers only listen on the multicast group, so every sample reaches all of them
+    Locator_t group;
+    IPLocator::setIPv4(group, "239.255.0.1");
+    group.port = 7900;
+    DomainParticipantQos sub_qos = PARTICIPANT_QOS_DEFAULT;
+    sub_qos.wire_protocol().default_multicast_locator_list.push_back(group);
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipant* pub_participant = factory->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    DomainParticipant* sub_participant = factory->create_participant(0, sub_qos);
+    if (nullptr == pub_participant || nullptr == sub_participant)
+    {
+        std::cerr << "Cannot create participants" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new SampleType());
+    type.register_type(pub_participant);
+    type.register_type(sub_participant);
+    Publisher* publisher = pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.data_sharing().off();
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.data_sharing().off();
+
+    CountingListener listener;
+    std::vector<DataWriter*> writers;
+    for (size_t i = 0; i < num_topics; ++i)
+    {
+        std::string topic_name = "DispatchTopic_" + std::to_string(i);
+        Topic* pub_topic = pub_participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        Topic* sub_topic = sub_participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+        DataWriter* writer = publisher->create_datawriter(pub_topic, writer_qos);
+        DataReader* reader = subscriber->create_datareader(sub_topic, reader_qos, &listener);
+        if (nullptr == writer || nullptr == reader)
+        {
+            std::cerr << "Cannot create endpoints" << std::endl;
+            return 1;
+        }
+        writers.push_back(writer);
+    }
+
+    auto limit = steady_clock::now() + std::chrono::seconds(60);
+    for (DataWriter* writer : writers)
+    {
+        PublicationMatchedStatus status;
+        while (writer->get_publication_matched_status(status), 0 == status.current_count)
+        {
+            if (steady_clock::now() > limit)
+            {
+                std::cerr << "Endpoints did not match" << std::endl;
+                return 1;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    std::cout << std::setw(12) << "run" << std::setw(12) << "topics" << std::setw(12) << "received"
+              << std::setw(16) << "received/s" << std::endl;
+    run("one topic", std::vector<DataWriter*>(1, writers.front()), listener, num_samples);
+    run("all topics", writers, listener, num_samples);
+
+    pub_participant->delete_contained_entities();
+    sub_participant->delete_contained_entities();
+    factory->delete_participant(pub_participant);
+    factory->delete_participant(sub_participant);
+    Log::KillThread();
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DynamicTypesTest.cpp
+ *
+ * Measures how long it takes to serialize and deserialize a sample with the types generated by fastddsgen, with a
+ * DynamicPubSubType, which goes through the serialization plan of its type, and with DynamicData on its own.
+ * Usage: DynamicTypesTest [samples]
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include "Test.h"
+#include "TestPubSubTypes.h"
+#include "TestTypeObject.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace eprosima::fastrtps::types;
+using eprosima::fastdds::dds::Log;
+using eprosima::fastdds::dds::TopicDataType;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+using std::chrono::steady_clock;
+
+static DynamicType_ptr dynamic_type(
+        const std::string& name)
+{
+    const TypeIdentifier* id = TypeObjectFactory::get_instance()->get_type_identifier(name, true);
+    const TypeObject* obj = TypeObjectFactory::get_instance()->get_type_object(id);
+    return TypeObjectFactory::get_instance()->build_dynamic_type(name, id, obj);
+}
+
+// Serializes the sample as a DataWriter does, asking first for its size, and then deserializes it.
+// The payload is sized for the generated type, as DynamicData may underestimate the size of arrays.
+static void run(
+        const std::string& name,
+        const char* path,
+        TopicDataType& type,
+        void* sample,
+        uint32_t payload_size,
+        size_t num_samples)
+{
+    SerializedPayload_t payload(payload_size);
+
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        if (0 == type.getSerializedSizeProvider(sample)() || !type.serialize(sample, &payload))
+        {
+            std::cerr << "Cannot serialize " << name << std::endl;
+            return;
+        }
+    }
+    double serialize_ns = std::chrono::duration<double, std::nano>(steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        if (!type.deserialize(&payload, sample))
+        {
+            std::cerr << "Cannot deserialize " << name << std::endl;
+            return;
+        }
+    }
+    double deserialize_ns = std::chrono::duration<double, std::nano>(steady_clock::now() - start).count();
+
+    std::cout << std::setw(16) << name << std::setw(12) << path << std::setw(12) << payload.length
+              << std::fixed << std::setprecision(0) << std::setw(16) << serialize_ns / num_samples
+              << std::setw(16) << deserialize_ns / num_samples << std::endl;
+}
+
+template<typename Sample, typename SamplePubSubType>
+static void compare(
+        const std::string& name,
+        const Sample& sample,
+        size_t num_samples)
+{
+    Sample static_sample(sample);
+    SamplePubSubType static_type;
+    uint32_t payload_size = static_type.getSerializedSizeProvider(&static_sample)();
+    run(name, "generated", static_type, &static_sample, payload_size, num_samples);
+
+    // Fill the dynamic sample with the same values
+    SerializedPayload_t payload(payload_size);
+    static_type.serialize(&static_sample, &payload);
+
+    DynamicPubSubType plan_type(dynamic_type(name));
+    DynamicData* dynamic_sample = static_cast<DynamicData*>(plan_type.createData());
+    plan_type.deserialize(&payload, dynamic_sample);
+    run(name, "plan", plan_type, dynamic_sample, payload_size, num_samples);
+
+    // Without a registered type, DynamicData serializes itself
+    DynamicPubSubType data_type;
+    run(name, "data", data_type, dynamic_sample, payload_size, num_samples);
+
+    plan_type.deleteData(dynamic_sample);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_samples = 100000;
+    if (argc > 1)
+    {
+        num_samples = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == num_samples)
+    {
+        std::cerr << "Usage: DynamicTypesTest [samples]" << std::endl;
+        return 1;
+    }
+
+    registerTestTypes();
+
+    BasicStruct basic;
+    basic.my_bool(true);
+    basic.my_octet(166);
+    basic.my_int16(-10401);
+    basic.my_int32(5884001);
+    basic.my_int64(884481567);
+    basic.my_uint16(250);
+    basic.my_uint32(15884);
+    basic.my_uint64(765241);
+    basic.my_float32(158.55f);
+    basic.my_float64(765241.58);
+    basic.my_float128(765241878.154874);
+    basic.my_char('L');
+    basic.my_wchar(L'G');
+    basic.my_string("Luis@eProsima");
+    basic.my_wstring(L"LuisGasco@eProsima");
+
+    ComplexStruct complex;
+    complex.my_octet(66);
+    complex.my_basic_struct(basic);
+    complex.my_enum(B);
+    complex.my_sequence_octet().assign(55, 7);
+    complex.my_sequence_struct().assign(8, basic);
+    complex.my_array_struct().fill(basic);
+    complex.my_small_string_8("short");
+    complex.my_sequences_array()[22].assign(64, 5);
+
+    std::cout << std::setw(16) << "type" << std::setw(12) << "path" << std::setw(12) << "bytes"
+              << std::setw(16) << "serialize ns" << std::setw(16) << "deserialize ns" << std::endl;
+    compare<BasicStruct, BasicStructPubSubType>("BasicStruct", basic, num_samples);
+    compare<ComplexStruct, ComplexStructPubSubType>("ComplexStruct", complex, num_samples / 100 + 1);
+
+    Log::KillThread();
+    return 0;
+}
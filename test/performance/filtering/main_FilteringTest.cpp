@@ -0,0 +1,147 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_FilteringTest.cpp
+ *
+ * Measures the cost of evaluating content filter expressions on serialized samples.
+ * Usage: FilteringTest [samples]
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterCompiler.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::types;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+// struct Sample { string name; long index; double value; sequence<octet> data; };
+static DynamicType_ptr create_type()
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+    builder->add_member(0, "name", factory->create_string_type());
+    builder->add_member(1, "index", factory->create_int32_type());
+    builder->add_member(2, "value", factory->create_float64_type());
+    builder->add_member(3, "data", factory->create_sequence_builder(factory->create_byte_type())->build());
+    builder->set_name("Sample");
+    return builder->build();
+}
+
+static void create_samples(
+        const DynamicType_ptr& type,
+        size_t count,
+        std::vector<SerializedPayload_t>& payloads)
+{
+    DynamicPubSubType pubsub_type(type);
+    payloads.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(type);
+        data->set_string_value("sample_" + std::to_string(i % 100), 0);
+        data->set_int32_value(static_cast<int32_t>(i), 1);
+        data->set_float64_value(static_cast<double>(i % 1000) / 10.0, 2);
+        DynamicData* bytes = data->loan_value(3);
+        MemberId id;
+        for (size_t j = 0; j < 64; ++j)
+        {
+            bytes->insert_byte_value(static_cast<octet>(j), id);
+        }
+        data->return_loaned_value(bytes);
+
+        payloads[i].reserve(pubsub_type.getSerializedSizeProvider(data)());
+        pubsub_type.serialize(data, &payloads[i]);
+        DynamicDataFactory::get_instance()->delete_data(data);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t samples = 100000;
+    if (argc > 1)
+    {
+        samples = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == samples)
+    {
+        std::cerr << "Usage: FilteringTest [samples]" << std::endl;
+        return 1;
+    }
+
+    DynamicType_ptr type = create_type();
+    std::vector<SerializedPayload_t> payloads;
+    create_samples(type, samples, payloads);
+
+    const std::vector<std::string> expressions =
+    {
+        "index > 100",
+        "value BETWEEN 10.0 AND 20.0",
+        "name = 'sample_42'",
+        "name LIKE 'sample_4%'",
+        "index > %0 AND (value < %1 OR name LIKE %2)",
+    };
+    const std::vector<std::string> parameters = { "100", "50.0", "'sample_1%'" };
+
+    std::cout << std::left << std::setw(50) << "Expression" << std::right << std::setw(12) << "ns/sample"
+              << std::setw(12) << "passed" << std::endl;
+
+    int result = 0;
+    for (const std::string& expression : expressions)
+    {
+        std::unique_ptr<DDSSQLFilter::DDSFilterExpression> filter;
+        if (!DDSSQLFilter::DDSFilterCompiler::compile(expression, parameters, type, filter))
+        {
+            std::cerr << "Cannot compile " << expression << std::endl;
+            result = 1;
+            continue;
+        }
+
+        size_t passed = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const SerializedPayload_t& payload : payloads)
+        {
+            if (filter->evaluate(payload))
+            {
+                ++passed;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        std::cout << std::left << std::setw(50) << expression << std::right << std::setw(12) << std::fixed
+                  << std::setprecision(1) << ns / static_cast<double>(samples) << std::setw(12) << passed
+                  << std::endl;
+    }
+
+    Log::KillThread();
+    return result;
+}
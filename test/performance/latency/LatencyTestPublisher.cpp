@@ -25,6 +25,7 @@
 #include <cmath>
 #include <fstream>
 
+#include <fastdds/dds/core/condition/WaitSet.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -98,6 +99,7 @@ bool LatencyTestPublisher::init(
         bool dynamic_data,
         bool data_sharing,
         bool data_loans,
+        bool waitset,
         int forced_domain,
         LatencyDataSizes& latency_data_sizes)
 {
@@ -111,6 +113,7 @@ bool LatencyTestPublisher::init(
     dynamic_types_ = dynamic_data;
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
+    waitset_ = waitset;
     forced_domain_ = forced_domain;
     raw_data_file_ = raw_data_file;
     pid_ = pid;
@@ -1162,17 +1165,29 @@ bool LatencyTestPublisher::create_data_endpoints()
         return false;
     }
 
-    // Create Echo DataReader
+    // Create Echo DataReader. On WaitSet mode the samples are not notified through the listener
+    StatusMask reader_mask = StatusMask::all();
+    if (waitset_)
+    {
+        reader_mask >> StatusMask::data_available();
+    }
+
     data_reader_ = subscriber_->create_datareader(
         latency_data_sub_topic_,
         dr_qos_,
-        &data_reader_listener_);
+        &data_reader_listener_,
+        reader_mask);
 
     if (data_reader_ == nullptr)
     {
         return false;
     }
 
+    if (waitset_ && !start_waitset_reception())
+    {
+        return false;
+    }
+
     return true;
 }
 
@@ -1192,6 +1207,8 @@ bool LatencyTestPublisher::destroy_data_endpoints()
     data_writer_ = nullptr;
     data_writer_listener_.reset();
 
+    stop_waitset_reception();
+
     if (nullptr == data_reader_
             || ReturnCode_t::RETCODE_OK != subscriber_->delete_datareader(data_reader_))
     {
@@ -1231,3 +1248,54 @@ bool LatencyTestPublisher::destroy_data_endpoints()
 
     return true;
 }
+
+bool LatencyTestPublisher::start_waitset_reception()
+{
+    assert(nullptr != data_reader_);
+
+    // Triggers while the reader holds samples not yet processed
+    data_read_condition_ = data_reader_->create_readcondition(
+        {NOT_READ_SAMPLE_STATE},
+        {NEW_VIEW_STATE, NOT_NEW_VIEW_STATE},
+        {ALIVE_INSTANCE_STATE, NOT_ALIVE_DISPOSED_INSTANCE_STATE, NOT_ALIVE_NO_WRITERS_INSTANCE_STATE});
+    if (nullptr == data_read_condition_)
+    {
+        logError(LATENCYPUBLISHER, "ERROR creating the data ReadCondition");
+        return false;
+    }
+
+    stop_waitset_condition_.set_trigger_value(false);
+    waitset_thread_ = std::thread(&LatencyTestPublisher::waitset_reception_loop, this);
+
+    return true;
+}
+
+void LatencyTestPublisher::waitset_reception_loop()
+{
+    WaitSet waitset;
+    waitset.attach_condition(*data_read_condition_);
+    waitset.attach_condition(stop_waitset_condition_);
+
+    ConditionSeq active_conditions;
+    while (ReturnCode_t::RETCODE_OK == waitset.wait(active_conditions, eprosima::fastrtps::c_TimeInfinite)
+            && !stop_waitset_condition_.get_trigger_value())
+    {
+        // Same processing as the listener, but on this thread
+        data_reader_listener_.on_data_available(data_reader_);
+    }
+}
+
+void LatencyTestPublisher::stop_waitset_reception()
+{
+    if (waitset_thread_.joinable())
+    {
+        stop_waitset_condition_.set_trigger_value(true);
+        waitset_thread_.join();
+    }
+
+    if (nullptr != data_read_condition_)
+    {
+        data_reader_->delete_readcondition(data_read_condition_);
+        data_read_condition_ = nullptr;
+    }
+}
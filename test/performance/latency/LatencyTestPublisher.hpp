@@ -22,12 +22,15 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <thread>
 
 #include <asio.hpp>
+#include <fastdds/dds/core/condition/GuardCondition.hpp>
 #include <fastdds/dds/publisher/DataWriterListener.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastrtps/types/DynamicData.h>
@@ -99,6 +102,7 @@ public:
             bool dynamic_data,
             bool data_sharing,
             bool data_loans,
+            bool waitset,
             int forced_domain,
             LatencyDataSizes& latency_data_sizes);
 
@@ -115,6 +119,12 @@ private:
 
     bool destroy_data_endpoints();
 
+    bool start_waitset_reception();
+
+    void stop_waitset_reception();
+
+    void waitset_reception_loop();
+
     bool test(
             uint32_t datasize);
 
@@ -201,12 +211,18 @@ private:
     bool dynamic_types_ = false;
     bool data_sharing_ = false;
     bool data_loans_ = false;
+    bool waitset_ = false;
     int forced_domain_ = -1;
     int subscribers_ = 0;
     unsigned int samples_ = 0;
     bool hostname_ = false;
     uint32_t pid_ = 0;
 
+    /* WaitSet reception */
+    eprosima::fastdds::dds::ReadCondition* data_read_condition_ = nullptr;
+    eprosima::fastdds::dds::GuardCondition stop_waitset_condition_;
+    std::thread waitset_thread_;
+
     /* Topics */
     eprosima::fastdds::dds::Topic* latency_data_sub_topic_ = nullptr;
     eprosima::fastdds::dds::Topic* latency_data_pub_topic_ = nullptr;
@@ -20,6 +20,7 @@
 
 #include <cassert>
 
+#include <fastdds/dds/core/condition/WaitSet.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/log/Colors.hpp>
@@ -87,6 +88,7 @@ bool LatencyTestSubscriber::init(
         bool dynamic_data,
         bool data_sharing,
         bool data_loans,
+        bool waitset,
         int forced_domain,
         LatencyDataSizes& latency_data_sizes)
 {
@@ -97,6 +99,7 @@ bool LatencyTestSubscriber::init(
     dynamic_types_ = dynamic_data;
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
+    waitset_ = waitset;
     forced_domain_ = forced_domain;
     pid_ = pid;
     hostname_ = hostname;
@@ -886,16 +889,29 @@ bool LatencyTestSubscriber::create_data_endpoints()
         return false;
     }
 
+    // On WaitSet mode the samples are not notified through the listener
+    StatusMask reader_mask = StatusMask::all();
+    if (waitset_)
+    {
+        reader_mask >> StatusMask::data_available();
+    }
+
     if (nullptr ==
             (data_reader_ = subscriber_->create_datareader(
                 latency_data_sub_topic_,
                 dr_qos_,
-                &data_reader_listener_)))
+                &data_reader_listener_,
+                reader_mask)))
     {
         logError(LatencyTest, "ERROR creating the subscriber data reader");
         return false;
     }
 
+    if (waitset_ && !start_waitset_reception())
+    {
+        return false;
+    }
+
     return true;
 }
 
@@ -915,6 +931,8 @@ bool LatencyTestSubscriber::destroy_data_endpoints()
     data_writer_ = nullptr;
     data_writer_listener_.reset();
 
+    stop_waitset_reception();
+
     if (nullptr == data_reader_
             || ReturnCode_t::RETCODE_OK != subscriber_->delete_datareader(data_reader_))
     {
@@ -954,3 +972,54 @@ bool LatencyTestSubscriber::destroy_data_endpoints()
 
     return true;
 }
+
+bool LatencyTestSubscriber::start_waitset_reception()
+{
+    assert(nullptr != data_reader_);
+
+    // Triggers while the reader holds samples not yet processed
+    data_read_condition_ = data_reader_->create_readcondition(
+        {NOT_READ_SAMPLE_STATE},
+        {NEW_VIEW_STATE, NOT_NEW_VIEW_STATE},
+        {ALIVE_INSTANCE_STATE, NOT_ALIVE_DISPOSED_INSTANCE_STATE, NOT_ALIVE_NO_WRITERS_INSTANCE_STATE});
+    if (nullptr == data_read_condition_)
+    {
+        logError(LatencyTest, "ERROR creating the data ReadCondition");
+        return false;
+    }
+
+    stop_waitset_condition_.set_trigger_value(false);
+    waitset_thread_ = std::thread(&LatencyTestSubscriber::waitset_reception_loop, this);
+
+    return true;
+}
+
+void LatencyTestSubscriber::waitset_reception_loop()
+{
+    WaitSet waitset;
+    waitset.attach_condition(*data_read_condition_);
+    waitset.attach_condition(stop_waitset_condition_);
+
+    ConditionSeq active_conditions;
+    while (ReturnCode_t::RETCODE_OK == waitset.wait(active_conditions, eprosima::fastrtps::c_TimeInfinite)
+            && !stop_waitset_condition_.get_trigger_value())
+    {
+        // Same processing as the listener, but on this thread
+        data_reader_listener_.on_data_available(data_reader_);
+    }
+}
+
+void LatencyTestSubscriber::stop_waitset_reception()
+{
+    if (waitset_thread_.joinable())
+    {
+        stop_waitset_condition_.set_trigger_value(true);
+        waitset_thread_.join();
+    }
+
+    if (nullptr != data_read_condition_)
+    {
+        data_reader_->delete_readcondition(data_read_condition_);
+        data_read_condition_ = nullptr;
+    }
+}
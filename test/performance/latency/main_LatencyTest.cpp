@@ -141,7 +141,8 @@ enum  optionIndex
     FORCED_DOMAIN,
     FILE_R,
     DATA_SHARING,
-    DATA_LOAN
+    DATA_LOAN,
+    WAITSET
 };
 
 enum TestAgent
@@ -197,6 +198,8 @@ const option::Descriptor usage[] = {
       "               --data_sharing        Enable data sharing feature." },
     { DATA_LOAN,        0, "l", "data_loans",            Arg::None,
       "               --data_loans          Use loan sample API." },
+    { WAITSET,         0, "w", "waitset",               Arg::None,
+      "  -w           --waitset             Receive samples on a WaitSet thread instead of the listener." },
     { 0, 0, 0, 0, 0, 0 }
 };
 
@@ -303,6 +306,7 @@ int main(
     std::string demands_file = "";
     bool data_sharing = false;
     bool data_loans = false;
+    bool waitset = false;
 
     argc -= (argc > 0);
     argv += (argc > 0); // skip program name argv[0] if present
@@ -462,6 +466,9 @@ int main(
             case DATA_LOAN:
                 data_loans = true;
                 break;
+            case WAITSET:
+                waitset = true;
+                break;
             case UNKNOWN_OPT:
             default:
                 option::printUsage(fwrite, stdout, usage, columns);
@@ -550,7 +557,7 @@ int main(
         LatencyTestPublisher latency_publisher;
         if (latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv, export_prefix,
                 raw_data_file, pub_part_property_policy, pub_property_policy, xml_config_file,
-                dynamic_types, data_sharing, data_loans, forced_domain, data_sizes))
+                dynamic_types, data_sharing, data_loans, waitset, forced_domain, data_sizes))
         {
             latency_publisher.run();
         }
@@ -565,7 +572,7 @@ int main(
         LatencyTestSubscriber latency_subscriber;
         if (latency_subscriber.init(echo, samples, reliable, seed, hostname, sub_part_property_policy,
                 sub_property_policy,
-                xml_config_file, dynamic_types, data_sharing, data_loans, forced_domain, data_sizes))
+                xml_config_file, dynamic_types, data_sharing, data_loans, waitset, forced_domain, data_sizes))
         {
             latency_subscriber.run();
         }
@@ -584,7 +591,7 @@ int main(
         LatencyTestPublisher latency_publisher;
         bool pub_init = latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv,
                         export_prefix, raw_data_file, pub_part_property_policy, pub_property_policy,
-                        xml_config_file, dynamic_types, data_sharing, data_loans, forced_domain, data_sizes);
+                        xml_config_file, dynamic_types, data_sharing, data_loans, waitset, forced_domain, data_sizes);
 
         // Initialize subscribers
         std::vector<std::shared_ptr<LatencyTestSubscriber>> latency_subscribers;
@@ -596,7 +603,7 @@ int main(
             sub_init &= latency_subscribers.back()->init(echo, samples, reliable, seed, hostname,
                             sub_part_property_policy,
                             sub_property_policy, xml_config_file, dynamic_types, data_sharing, data_loans,
-                            forced_domain, data_sizes);
+                            waitset, forced_domain, data_sizes);
         }
 
         // Spawn run threads
@@ -0,0 +1,152 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_LogTest.cpp
+ *
+ * Measures the time spent by the logging threads on each entry, and the time until every entry is consumed, when
+ * the message is formatted on the calling thread (default macros) and when it is recorded in binary form (macros
+ * built with LOG_BINARY). Entries are consumed by a consumer that discards them.
+ * Usage: LogTest [entries_per_thread] [threads]
+ */
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using std::chrono::steady_clock;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+class NullConsumer : public LogConsumer
+{
+public:
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        consumed_ += entry.message.size() > 0 ? 1 : 0;
+    }
+
+    static std::atomic<size_t> consumed_;
+};
+
+std::atomic<size_t> NullConsumer::consumed_{0};
+
+// Same entry the macros would log, formatted on the calling thread
+static void log_formatted(
+        uint32_t index,
+        const std::string& topic)
+{
+    std::stringstream stream;
+    stream << "Sample " << index << " of topic " << topic << " sent to " << 3 << " readers in " << 0.25 << " ms";
+    Log::QueueLog(stream.str(), Log::Context{__FILE__, __LINE__, __func__, "LOG_TEST"}, Log::Kind::Warning);
+}
+
+// Same entry the macros would log, recorded in binary form
+static void log_binary(
+        uint32_t index,
+        const std::string& topic)
+{
+    static Log::CallSite site = { {__FILE__, __LINE__, __func__, "LOG_TEST"}, Log::Kind::Warning, 0u, 0u, false};
+    Log::Record record(site);
+    record << "Sample " << index << " of topic " << topic << " sent to " << 3 << " readers in " << 0.25 << " ms";
+}
+
+static void run(
+        const char* name,
+        void (* log_entry)(uint32_t, const std::string&),
+        uint32_t num_entries,
+        uint32_t num_threads)
+{
+    NullConsumer::consumed_ = 0;
+    std::atomic<int64_t> logging_ns{0};
+    const std::string topic("HelloWorldTopic");
+
+    auto start = steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    auto thread_start = steady_clock::now();
+                    for (uint32_t i = 0; i < num_entries; ++i)
+                    {
+                        log_entry(i, topic);
+                    }
+                    logging_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        steady_clock::now() - thread_start).count();
+                });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    Log::Flush();
+    double total_ms = elapsed_ms(start);
+
+    size_t total_entries = static_cast<size_t>(num_entries) * num_threads;
+    std::cout << std::setw(10) << name << std::setw(10) << num_threads << std::setw(12) << total_entries
+              << std::setw(12) << NullConsumer::consumed_.load() << std::fixed << std::setprecision(1)
+              << std::setw(14) << static_cast<double>(logging_ns.load()) / total_entries
+              << std::setw(12) << total_ms << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_entries = 100000;
+    uint32_t num_threads = 4;
+    if (argc > 1)
+    {
+        num_entries = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_threads = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == num_entries || 0 == num_threads)
+    {
+        std::cerr << "Usage: LogTest [entries_per_thread] [threads]" << std::endl;
+        return 1;
+    }
+
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new NullConsumer()));
+    Log::SetVerbosity(Log::Kind::Warning);
+
+    std::cout << std::setw(10) << "mode" << std::setw(10) << "threads" << std::setw(12) << "entries"
+              << std::setw(12) << "consumed" << std::setw(14) << "ns/entry" << std::setw(12) << "total ms"
+              << std::endl;
+    run("formatted", log_formatted, num_entries, num_threads);
+    run("binary", log_binary, num_entries, num_threads);
+
+    Log::KillThread();
+    return 0;
+}
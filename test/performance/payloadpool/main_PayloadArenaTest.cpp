@@ -0,0 +1,174 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_PayloadArenaTest.cpp
+ *
+ * Measures the access to the payloads of a preallocated history when they are allocated one by one, carved from a
+ * contiguous arena, and carved from an arena backed by huge pages: the time to reserve the history, and the bandwidth
+ * of writing (as when serializing) and reading (as when deserializing) every payload in random order.
+ * Usage: PayloadArenaTest [rounds] [numa_node]
+ */
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <rtps/history/TopicPayloadPool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using std::chrono::steady_clock;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+static bool run(
+        const char* backing,
+        uint32_t payload_size,
+        uint32_t num_payloads,
+        uint32_t rounds,
+        const PayloadArenaConfig& arena)
+{
+    PoolConfig config{ PREALLOCATED_MEMORY_MODE, payload_size, num_payloads, num_payloads };
+    config.payload_arena = arena;
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+
+    auto start = steady_clock::now();
+    pool->reserve_history(config, false);
+    double reserve_ms = elapsed_ms(start);
+
+    std::vector<CacheChange_t> changes(num_payloads);
+    for (CacheChange_t& change : changes)
+    {
+        if (!pool->get_payload(payload_size, change))
+        {
+            std::cerr << "Could not get a payload from the pool" << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<octet> sample(payload_size, 0x5A);
+    std::vector<octet> received(payload_size);
+    std::vector<uint32_t> order(num_payloads);
+    for (uint32_t i = 0; i < num_payloads; ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937 generator(num_payloads);
+
+    // First round faults the pages in, as the first samples written on a new history do
+    for (CacheChange_t& change : changes)
+    {
+        memcpy(change.serializedPayload.data, sample.data(), payload_size);
+    }
+
+    double write_ms = 0;
+    double read_ms = 0;
+    uint64_t checksum = 0;
+    for (uint32_t round = 0; round < rounds; ++round)
+    {
+        std::shuffle(order.begin(), order.end(), generator);
+        start = steady_clock::now();
+        for (uint32_t index : order)
+        {
+            memcpy(changes[index].serializedPayload.data, sample.data(), payload_size);
+        }
+        write_ms += elapsed_ms(start);
+
+        std::shuffle(order.begin(), order.end(), generator);
+        start = steady_clock::now();
+        for (uint32_t index : order)
+        {
+            memcpy(received.data(), changes[index].serializedPayload.data, payload_size);
+            checksum += received[index % payload_size];
+        }
+        read_ms += elapsed_ms(start);
+    }
+
+    for (CacheChange_t& change : changes)
+    {
+        pool->release_payload(change);
+    }
+    pool->release_history(config, false);
+
+    if (checksum != static_cast<uint64_t>(rounds) * num_payloads * 0x5A)
+    {
+        std::cerr << "Payloads were corrupted" << std::endl;
+        return false;
+    }
+
+    double total_mb = static_cast<double>(payload_size) * num_payloads * rounds / (1024.0 * 1024.0);
+    std::cout << std::setw(10) << payload_size / 1024 << std::setw(10) << num_payloads << std::setw(12) << backing
+              << std::fixed << std::setprecision(2) << std::setw(12) << reserve_ms
+              << std::setprecision(0) << std::setw(14) << total_mb * 1000.0 / write_ms
+              << std::setw(14) << total_mb * 1000.0 / read_ms << std::endl;
+    return true;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t rounds = 20;
+    int32_t numa_node = -1;
+    if (argc > 1)
+    {
+        rounds = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        numa_node = static_cast<int32_t>(std::strtol(argv[2], nullptr, 10));
+    }
+    if (0 == rounds)
+    {
+        std::cerr << "Usage: PayloadArenaTest [rounds] [numa_node]" << std::endl;
+        return 1;
+    }
+
+    PayloadArenaConfig heap;
+    heap.numa_node = numa_node;
+    PayloadArenaConfig arena;
+    arena.enabled = true;
+    arena.numa_node = numa_node;
+    PayloadArenaConfig huge_pages = arena;
+    huge_pages.huge_pages = true;
+
+    std::cout << std::setw(10) << "KB" << std::setw(10) << "payloads" << std::setw(12) << "backing"
+              << std::setw(12) << "reserve ms" << std::setw(14) << "write MB/s" << std::setw(14) << "read MB/s"
+              << std::endl;
+
+    // Histories of 64 KB and 1 MB samples, with the same amount of memory
+    const uint32_t payload_sizes[] = { 64 * 1024, 1024 * 1024 };
+    const uint32_t history_depths[] = { 1024, 64 };
+    for (size_t i = 0; i < 2; ++i)
+    {
+        if (!run("heap", payload_sizes[i], history_depths[i], rounds, heap) ||
+                !run("arena", payload_sizes[i], history_depths[i], rounds, arena) ||
+                !run("huge pages", payload_sizes[i], history_depths[i], rounds, huge_pages))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_PayloadPoolTest.cpp
+ *
+ * Measures the contention on the payload pool shared by all the local DataWriters and DataReaders of a topic: every
+ * thread acts as a writer that takes a payload for each sample, lends it to some local readers and releases it when
+ * the readers are done, and the number of threads doing so concurrently is increased on each round.
+ * Usage: PayloadPoolTest [samples_per_thread] [max_threads] [readers] [payload_size]
+ */
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <rtps/history/TopicPayloadPoolRegistry.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using std::chrono::steady_clock;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+static bool run_writer(
+        ITopicPayloadPool& pool,
+        uint32_t num_samples,
+        uint32_t num_readers,
+        uint32_t payload_size,
+        const std::atomic<bool>& go)
+{
+    CacheChange_t writer_change;
+    writer_change.writerGUID = GUID_t(GuidPrefix_t(), 1);
+    std::vector<CacheChange_t> reader_changes(num_readers);
+
+    while (!go.load())
+    {
+        std::this_thread::yield();
+    }
+
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        if (!pool.get_payload(payload_size, writer_change))
+        {
+            return false;
+        }
+        writer_change.serializedPayload.length = payload_size;
+        writer_change.sequenceNumber = SequenceNumber_t(0, i + 1);
+
+        // Local readers share the payload of the writer
+        IPayloadPool* owner = writer_change.payload_owner();
+        for (CacheChange_t& reader_change : reader_changes)
+        {
+            reader_change.writerGUID = writer_change.writerGUID;
+            reader_change.sequenceNumber = writer_change.sequenceNumber;
+            if (!pool.get_payload(writer_change.serializedPayload, owner, reader_change))
+            {
+                return false;
+            }
+        }
+
+        for (CacheChange_t& reader_change : reader_changes)
+        {
+            pool.release_payload(reader_change);
+        }
+        pool.release_payload(writer_change);
+    }
+
+    return true;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_samples = 200000;
+    uint32_t max_threads = 16;
+    uint32_t num_readers = 2;
+    uint32_t payload_size = 512;
+    if (argc > 1)
+    {
+        num_samples = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        max_threads = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        num_readers = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (argc > 4)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[4], nullptr, 10));
+    }
+    if (0 == num_samples || 0 == max_threads || 0 == payload_size)
+    {
+        std::cerr << "Usage: PayloadPoolTest [samples_per_thread] [max_threads] [readers] [payload_size]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << std::setw(10) << "threads" << std::setw(14) << "samples/s" << std::setw(14) << "ns/sample"
+              << std::endl;
+
+    for (uint32_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        // Same pool configuration the histories of a DataWriter and its DataReaders would request
+        PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, payload_size, 16, 0 };
+        std::shared_ptr<ITopicPayloadPool> pool = TopicPayloadPoolRegistry::get("PayloadPoolTest", config);
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            pool->reserve_history(config, false);
+            for (uint32_t j = 0; j < num_readers; ++j)
+            {
+                pool->reserve_history(config, true);
+            }
+        }
+
+        std::atomic<bool> go{false};
+        std::atomic<uint32_t> failures{0};
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back([&]()
+                    {
+                        if (!run_writer(*pool, num_samples, num_readers, payload_size, go))
+                        {
+                            ++failures;
+                        }
+                    });
+        }
+
+        auto start = steady_clock::now();
+        go.store(true);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        double run_ms = elapsed_ms(start);
+
+        if (failures.load() != 0)
+        {
+            std::cerr << "Could not get a payload from the pool" << std::endl;
+            return 1;
+        }
+
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            pool->release_history(config, false);
+            for (uint32_t j = 0; j < num_readers; ++j)
+            {
+                pool->release_history(config, true);
+            }
+        }
+
+        double total_samples = static_cast<double>(num_samples) * num_threads;
+        std::cout << std::setw(10) << num_threads << std::fixed << std::setprecision(0)
+                  << std::setw(14) << total_samples * 1000.0 / run_ms
+                  << std::setprecision(1) << std::setw(14) << run_ms * 1000000.0 / total_samples << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,266 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_SecureThroughputTest.cpp
+ *
+ * Measures the throughput of the builtin AES-GCM-GMAC cryptographic plugin, without the transports and discovery of
+ * the secure ThroughputTest runs: messages are encoded as serialized payloads of a writer and as RTPS messages of a
+ * participant with several matched participants (one receiver specific MAC each), and then decoded.
+ * Usage: SecureThroughputTest [messages] [payload_size] [max_blocks_per_session] [receivers]
+ */
+
+#include <security/cryptography/AESGCMGMAC.h>
+#include <security/authentication/PKIIdentityHandle.h>
+#include <security/accesscontrol/AccessPermissionsHandle.h>
+#include <fastrtps/rtps/common/CDRMessage_t.h>
+
+#include <openssl/rand.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+using std::chrono::steady_clock;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+static void fill_shared_secret(
+        SharedSecretHandle& shared_secret)
+{
+    const char* names[] = { "Challenge1", "Challenge2", "SharedSecret" };
+    for (const char* name : names)
+    {
+        SharedSecret::BinaryData binary_data;
+        std::vector<uint8_t> value(32);
+        RAND_bytes(value.data(), 32);
+        binary_data.name(name);
+        binary_data.value(value);
+        shared_secret->data_.push_back(binary_data);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_messages = 100000;
+    uint32_t payload_size = 256;
+    std::string max_blocks_per_session = "32";
+    uint32_t num_receivers = 16;
+    if (argc > 1)
+    {
+        num_messages = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        payload_size = static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (argc > 3)
+    {
+        max_blocks_per_session = argv[3];
+    }
+    if (argc > 4)
+    {
+        num_receivers = static_cast<uint32_t>(std::strtoul(argv[4], nullptr, 10));
+    }
+    if (0 == num_messages || 0 == payload_size || payload_size > 60000 || 0 == num_receivers)
+    {
+        std::cerr << "Usage: SecureThroughputTest [messages] [payload_size] [max_blocks_per_session] [receivers]"
+                  << std::endl;
+        return 1;
+    }
+
+    AESGCMGMAC plugin;
+    CryptoKeyFactory* factory = plugin.keyfactory();
+    CryptoKeyExchange* exchange = plugin.keyexchange();
+    CryptoTransform* transform = plugin.cryptotransform();
+
+    PKIIdentityHandle i_handle;
+    AccessPermissionsHandle perm_handle;
+    SharedSecretHandle shared_secret;
+    fill_shared_secret(shared_secret);
+    SecurityException exception;
+
+    PropertySeq properties;
+    properties.emplace_back("dds.sec.crypto.maxblockspersession", max_blocks_per_session);
+
+    ParticipantSecurityAttributes part_sec_attr;
+    part_sec_attr.is_rtps_protected = true;
+    part_sec_attr.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+            PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    EndpointSecurityAttributes sec_attrs;
+    sec_attrs.is_submessage_protected = true;
+    sec_attrs.is_payload_protected = true;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ORIGIN_AUTHENTICATED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
+
+    // Participant A owns the writer, participant B owns the reader
+    ParticipantCryptoHandle* participant_A = factory->register_local_participant(i_handle, perm_handle, properties,
+                    part_sec_attr, exception);
+    ParticipantCryptoHandle* participant_B = factory->register_local_participant(i_handle, perm_handle, properties,
+                    part_sec_attr, exception);
+    ParticipantCryptoHandle* remote_B = factory->register_matched_remote_participant(*participant_A, i_handle,
+                    perm_handle, shared_secret, exception);
+    ParticipantCryptoHandle* remote_A = factory->register_matched_remote_participant(*participant_B, i_handle,
+                    perm_handle, shared_secret, exception);
+
+    DatawriterCryptoHandle* writer = factory->register_local_datawriter(*participant_A, properties, sec_attrs,
+                    exception);
+    DatareaderCryptoHandle* reader = factory->register_local_datareader(*participant_B, properties, sec_attrs,
+                    exception);
+    DatareaderCryptoHandle* remote_reader = factory->register_matched_remote_datareader(*writer, *remote_B,
+                    shared_secret, false, exception);
+    DatawriterCryptoHandle* remote_writer = factory->register_matched_remote_datawriter(*reader, *remote_A,
+                    shared_secret, exception);
+
+    ParticipantCryptoTokenSeq participant_A_tokens, participant_B_tokens;
+    exchange->create_local_participant_crypto_tokens(participant_A_tokens, *participant_A, *remote_B, exception);
+    exchange->create_local_participant_crypto_tokens(participant_B_tokens, *participant_B, *remote_A, exception);
+    exchange->set_remote_participant_crypto_tokens(*participant_A, *remote_B, participant_B_tokens, exception);
+    exchange->set_remote_participant_crypto_tokens(*participant_B, *remote_A, participant_A_tokens, exception);
+
+    DatawriterCryptoTokenSeq writer_tokens;
+    DatareaderCryptoTokenSeq reader_tokens;
+    exchange->create_local_datawriter_crypto_tokens(writer_tokens, *writer, *remote_reader, exception);
+    exchange->create_local_datareader_crypto_tokens(reader_tokens, *reader, *remote_writer, exception);
+    exchange->set_remote_datareader_crypto_tokens(*writer, *remote_reader, reader_tokens, exception);
+    exchange->set_remote_datawriter_crypto_tokens(*reader, *remote_writer, writer_tokens, exception);
+
+    // Other participants matched with participant A, which also receive its RTPS messages
+    std::vector<ParticipantCryptoHandle*> receivers{ remote_B };
+    for (uint32_t i = 1; i < num_receivers; ++i)
+    {
+        receivers.push_back(factory->register_matched_remote_participant(*participant_A, i_handle, perm_handle,
+                shared_secret, exception));
+    }
+
+    std::vector<uint8_t> inline_qos;
+
+    SerializedPayload_t plain_payload(payload_size);
+    plain_payload.length = payload_size;
+    RAND_bytes(plain_payload.data, static_cast<int>(payload_size));
+    CDRMessage_t plain_message(RTPSMESSAGE_DEFAULT_SIZE);
+    memcpy(plain_message.buffer, plain_payload.data, payload_size);
+    plain_message.length = payload_size;
+
+    // Messages are encoded before decoding them, so each side is measured on its own
+    std::vector<SerializedPayload_t> encoded_payloads(num_messages);
+    std::vector<CDRMessage_t> encoded_messages;
+    encoded_messages.reserve(num_messages);
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        encoded_payloads[i].reserve(payload_size + 128);
+        encoded_messages.emplace_back(RTPSMESSAGE_DEFAULT_SIZE);
+    }
+
+    auto start = steady_clock::now();
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        if (!transform->encode_serialized_payload(encoded_payloads[i], inline_qos, plain_payload, *writer,
+                exception))
+        {
+            std::cerr << "Error encoding payload " << i << std::endl;
+            return 1;
+        }
+    }
+    double payload_encode_ms = elapsed_ms(start);
+
+    start = steady_clock::now();
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        plain_message.pos = 0;
+        if (!transform->encode_rtps_message(encoded_messages[i], plain_message, *participant_A, receivers,
+                exception))
+        {
+            std::cerr << "Error encoding RTPS message " << i << std::endl;
+            return 1;
+        }
+        encoded_messages[i].pos = 0;
+    }
+    double message_encode_ms = elapsed_ms(start);
+
+    SerializedPayload_t decoded_payload(payload_size + 128);
+    start = steady_clock::now();
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        if (!transform->decode_serialized_payload(decoded_payload, encoded_payloads[i], inline_qos, *reader,
+                *remote_writer, exception) || decoded_payload.length != payload_size)
+        {
+            std::cerr << "Error decoding payload " << i << std::endl;
+            return 1;
+        }
+    }
+    double payload_decode_ms = elapsed_ms(start);
+
+    CDRMessage_t decoded_message(RTPSMESSAGE_DEFAULT_SIZE);
+    start = steady_clock::now();
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        decoded_message.pos = 0;
+        decoded_message.length = 0;
+        if (!transform->decode_rtps_message(decoded_message, encoded_messages[i], *participant_B, *remote_A,
+                exception) || decoded_message.length != payload_size)
+        {
+            std::cerr << "Error decoding RTPS message " << i << std::endl;
+            return 1;
+        }
+    }
+    double message_decode_ms = elapsed_ms(start);
+
+    if (memcmp(decoded_payload.data, plain_payload.data, payload_size) != 0 ||
+            memcmp(decoded_message.buffer, plain_message.buffer, payload_size) != 0)
+    {
+        std::cerr << "Decoded data differs from the original" << std::endl;
+        return 1;
+    }
+
+    auto rate = [num_messages](double ms)
+            {
+                return num_messages * 1000.0 / ms;
+            };
+    std::cout << std::setw(10) << "messages" << std::setw(8) << "bytes" << std::setw(11) << "receivers"
+              << std::setw(20) << "payload enc msg/s" << std::setw(20) << "payload dec msg/s"
+              << std::setw(17) << "rtps enc msg/s" << std::setw(17) << "rtps dec msg/s" << std::endl;
+    std::cout << std::setw(10) << num_messages << std::setw(8) << payload_size << std::setw(11) << num_receivers
+              << std::fixed << std::setprecision(0)
+              << std::setw(20) << rate(payload_encode_ms) << std::setw(20) << rate(payload_decode_ms)
+              << std::setw(17) << rate(message_encode_ms) << std::setw(17) << rate(message_decode_ms) << std::endl;
+
+    factory->unregister_datawriter(writer, exception);
+    factory->unregister_datawriter(remote_writer, exception);
+    factory->unregister_datareader(reader, exception);
+    factory->unregister_datareader(remote_reader, exception);
+    factory->unregister_participant(remote_A, exception);
+    for (ParticipantCryptoHandle* receiver : receivers)
+    {
+        factory->unregister_participant(receiver, exception);
+    }
+    factory->unregister_participant(participant_A, exception);
+    factory->unregister_participant(participant_B, exception);
+
+    return 0;
+}
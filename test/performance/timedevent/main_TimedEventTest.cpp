@@ -0,0 +1,187 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TimedEventTest.cpp
+ *
+ * Measures the cost of ResourceEvent operations with many concurrently armed timers, as on a participant with
+ * thousands of matched proxies: arming, restarting and cancelling every timer, firing a few short timers while the
+ * rest are armed, and destroying the timers.
+ * Usage: TimedEventTest [timers] [short_timers]
+ */
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using std::chrono::steady_clock;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+/**
+ * Timer with no interval whose expiration tells that the event thread has processed every order notified before it.
+ */
+class Probe
+{
+public:
+
+    explicit Probe(
+            ResourceEvent& service)
+        : event_(service, [this]()
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    fired_ = true;
+                    cv_.notify_one();
+                    return false;
+                }, 0)
+    {
+    }
+
+    void wait()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            fired_ = false;
+        }
+        event_.restart_timer();
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]()
+                {
+                    return fired_;
+                });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool fired_ = false;
+    TimedEvent event_;
+};
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_timers = 100000;
+    size_t num_short_timers = 1000;
+    if (argc > 1)
+    {
+        num_timers = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        num_short_timers = static_cast<size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == num_timers || 0 == num_short_timers)
+    {
+        std::cerr << "Usage: TimedEventTest [timers] [short_timers]" << std::endl;
+        return 1;
+    }
+
+    ResourceEvent service;
+    service.init_thread();
+    Probe probe(service);
+
+    // Timers that are kept armed during the test, as heartbeat and nack supression timers of matched proxies
+    std::vector<std::unique_ptr<TimedEvent>> timers;
+    for (size_t i = 0; i < num_timers; ++i)
+    {
+        timers.emplace_back(new TimedEvent(service, []()
+                {
+                    return true;
+                }, 3600000.0 + static_cast<double>(i)));
+    }
+
+    auto start = steady_clock::now();
+    for (auto& timer : timers)
+    {
+        timer->restart_timer();
+    }
+    probe.wait();
+    double arm_ms = elapsed_ms(start);
+
+    start = steady_clock::now();
+    for (auto& timer : timers)
+    {
+        timer->restart_timer();
+    }
+    probe.wait();
+    double restart_ms = elapsed_ms(start);
+
+    // Short timers expiring while the others are armed
+    std::atomic<size_t> fired{0};
+    std::vector<std::unique_ptr<TimedEvent>> short_timers;
+    for (size_t i = 0; i < num_short_timers; ++i)
+    {
+        short_timers.emplace_back(new TimedEvent(service, [&fired]()
+                {
+                    ++fired;
+                    return false;
+                }, static_cast<double>(i % 10)));
+    }
+
+    start = steady_clock::now();
+    for (auto& timer : short_timers)
+    {
+        timer->restart_timer();
+    }
+    while (fired.load() < num_short_timers)
+    {
+        std::this_thread::yield();
+    }
+    double fire_ms = elapsed_ms(start);
+    short_timers.clear();
+
+    start = steady_clock::now();
+    for (auto& timer : timers)
+    {
+        timer->cancel_timer();
+    }
+    probe.wait();
+    double cancel_ms = elapsed_ms(start);
+
+    for (auto& timer : timers)
+    {
+        timer->restart_timer();
+    }
+    probe.wait();
+
+    start = steady_clock::now();
+    timers.clear();
+    double destroy_ms = elapsed_ms(start);
+
+    std::cout << std::setw(10) << "timers" << std::setw(12) << "arm ms" << std::setw(12) << "restart ms"
+              << std::setw(12) << "fire ms" << std::setw(12) << "cancel ms" << std::setw(12) << "destroy ms"
+              << std::endl;
+    std::cout << std::setw(10) << num_timers << std::fixed << std::setprecision(2)
+              << std::setw(12) << arm_ms << std::setw(12) << restart_ms << std::setw(12) << fire_ms
+              << std::setw(12) << cancel_ms << std::setw(12) << destroy_ms << std::endl;
+
+    return 0;
+}
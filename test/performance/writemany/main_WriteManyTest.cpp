@@ -0,0 +1,298 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_WriteManyTest.cpp
+ *
+ * Measures the throughput of a synchronous best-effort DataWriter writing small samples one by one with write(),
+ * and in batches with write_many(), towards a DataReader on another participant. Intraprocess delivery is disabled so
+ * the samples go through the transports.
+ * Usage: WriteManyTest [samples] [batch]
+ */
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+using std::chrono::steady_clock;
+
+static constexpr uint32_t max_sample_size = 256;
+
+static double elapsed_ms(
+        const steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(steady_clock::now() - start).count();
+}
+
+struct Sample
+{
+    uint32_t size = 0;
+    uint8_t data[max_sample_size];
+};
+
+// Serialized as the encapsulation, the size, and the bytes of the sample
+class SampleType : public TopicDataType
+{
+public:
+
+    SampleType()
+    {
+        setName("WriteManySample");
+        m_typeSize = 4 + 4 + max_sample_size;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        const Sample* sample = static_cast<Sample*>(data);
+        const uint8_t header[4] = {0, 1, 0, 0};
+        memcpy(payload->data, header, 4);
+        memcpy(payload->data + 4, &sample->size, 4);
+        memcpy(payload->data + 8, sample->data, sample->size);
+        payload->length = 8 + sample->size;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        Sample* sample = static_cast<Sample*>(data);
+        if (payload->length < 8)
+        {
+            return false;
+        }
+        memcpy(&sample->size, payload->data + 4, 4);
+        if (sample->size > max_sample_size || payload->length < 8 + sample->size)
+        {
+            return false;
+        }
+        memcpy(sample->data, payload->data + 8, sample->size);
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        uint32_t size = 8 + static_cast<Sample*>(data)->size;
+        return [size]()
+               {
+                   return size;
+               };
+    }
+
+    void* createData() override
+    {
+        return new Sample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<Sample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+class CountingListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        Sample sample;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            ++received_;
+        }
+    }
+
+    std::atomic<size_t> received_{0};
+};
+
+// Waits for the samples still on their way to the reader, and returns how many arrived
+static size_t wait_received(
+        CountingListener& listener,
+        size_t expected)
+{
+    auto limit = steady_clock::now() + std::chrono::seconds(1);
+    while (listener.received_ < expected && steady_clock::now() < limit)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return listener.received_.exchange(0);
+}
+
+static void run(
+        DataWriter* writer,
+        CountingListener& listener,
+        uint32_t sample_size,
+        size_t num_samples,
+        size_t batch)
+{
+    std::vector<Sample> samples(batch);
+    std::vector<void*> pointers(batch);
+    for (size_t i = 0; i < batch; ++i)
+    {
+        samples[i].size = sample_size;
+        memset(samples[i].data, static_cast<int>(i), sample_size);
+        pointers[i] = &samples[i];
+    }
+
+    auto start = steady_clock::now();
+    for (size_t sent = 0; sent < num_samples; sent += batch)
+    {
+        for (size_t i = 0; i < batch; ++i)
+        {
+            writer->write(pointers[i]);
+        }
+    }
+    double write_ms = elapsed_ms(start);
+    size_t write_received = wait_received(listener, num_samples);
+
+    start = steady_clock::now();
+    for (size_t sent = 0; sent < num_samples; sent += batch)
+    {
+        writer->write_many(pointers.data(), batch);
+    }
+    double write_many_ms = elapsed_ms(start);
+    size_t write_many_received = wait_received(listener, num_samples);
+
+    std::cout << std::setw(8) << sample_size << std::fixed << std::setprecision(0)
+              << std::setw(16) << num_samples / write_ms * 1000.0 << std::setw(12) << write_received
+              << std::setw(16) << num_samples / write_many_ms * 1000.0 << std::setw(12) << write_many_received
+              << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    size_t num_samples = 100000;
+    size_t batch = 32;
+    if (argc > 1)
+    {
+        num_samples = static_cast<size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (argc > 2)
+    {
+        batch = static_cast<size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+    if (0 == num_samples || 0 == batch)
+    {
+        std::cerr << "Usage: WriteManyTest [samples] [batch]" << std::endl;
+        return 1;
+    }
+    num_samples = (num_samples + batch - 1) / batch * batch;
+
+    eprosima::fastrtps::LibrarySettingsAttributes library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastrtps::INTRAPROCESS_OFF;
+    eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings(library_settings);
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipant* pub_participant = factory->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    DomainParticipant* sub_participant = factory->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == pub_participant || nullptr == sub_participant)
+    {
+        std::cerr << "Cannot create participants" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new SampleType());
+    type.register_type(pub_participant);
+    type.register_type(sub_participant);
+    Topic* pub_topic = pub_participant->create_topic("WriteManyTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Topic* sub_topic = sub_participant->create_topic("WriteManyTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = static_cast<int32_t>(batch);
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.data_sharing().off();
+    DataWriter* writer = pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT)->create_datawriter(
+        pub_topic, writer_qos);
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.data_sharing().off();
+    CountingListener listener;
+    DataReader* reader = sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT)->create_datareader(
+        sub_topic, reader_qos, &listener);
+    if (nullptr == writer || nullptr == reader)
+    {
+        std::cerr << "Cannot create endpoints" << std::endl;
+        return 1;
+    }
+
+    PublicationMatchedStatus status;
+    auto limit = steady_clock::now() + std::chrono::seconds(10);
+    while (writer->get_publication_matched_status(status), 0 == status.current_count)
+    {
+        if (steady_clock::now() > limit)
+        {
+            std::cerr << "Endpoints did not match" << std::endl;
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::cout << std::setw(8) << "bytes" << std::setw(16) << "write/s" << std::setw(12) << "received"
+              << std::setw(16) << "write_many/s" << std::setw(12) << "received" << std::endl;
+    for (uint32_t sample_size : {16u, 64u, 256u})
+    {
+        run(writer, listener, sample_size, num_samples, batch);
+    }
+
+    pub_participant->delete_contained_entities();
+    sub_participant->delete_contained_entities();
+    factory->delete_participant(pub_participant);
+    factory->delete_participant(sub_participant);
+    Log::KillThread();
+    return 0;
+}
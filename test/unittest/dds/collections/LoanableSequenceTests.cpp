@@ -19,7 +19,9 @@
 
 #include <array>
 #include <atomic>
+#include <cstdlib>
 #include <memory>
+#include <new>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -27,6 +29,27 @@
 using namespace eprosima::fastdds::dds;
 using test_size_type = LoanableCollection::size_type;
 
+// Number of allocations done through the global operator new, to check when sequences allocate
+static std::atomic<size_t> num_allocations{0};
+
+void* operator new(
+        std::size_t size)
+{
+    ++num_allocations;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (nullptr == ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(
+        void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
 static constexpr test_size_type num_test_elements = 10u;
 static const std::array<int, num_test_elements> result_values =
 {
@@ -797,6 +820,83 @@ TEST(LoanableSequenceTests, sum_collections)
     }
 }
 
+TEST(LoanableSequenceTests, contiguous_storage)
+{
+    TestSeq uut(num_test_elements);
+    EXPECT_EQ(num_test_elements, uut.maximum());
+
+    // Pre-allocated elements are contiguous
+    ASSERT_TRUE(uut.length(num_test_elements));
+    const int* first = &uut[0];
+    for (test_size_type n = 0; n < num_test_elements; ++n)
+    {
+        EXPECT_EQ(first + n, &uut[n]);
+        EXPECT_EQ(0, uut[n]);
+    }
+
+    // Growing keeps the address of existing elements, and new ones are contiguous among them
+    ASSERT_TRUE(uut.length(3 * num_test_elements));
+    EXPECT_EQ(first, &uut[0]);
+    EXPECT_EQ(first + num_test_elements - 1, &uut[num_test_elements - 1]);
+    const int* second = &uut[num_test_elements];
+    for (test_size_type n = num_test_elements; n < 3 * num_test_elements; ++n)
+    {
+        EXPECT_EQ(second + (n - num_test_elements), &uut[n]);
+        EXPECT_EQ(0, uut[n]);
+    }
+
+    // Shrinking and growing again does not reallocate
+    ASSERT_TRUE(uut.length(0));
+    ASSERT_TRUE(uut.length(3 * num_test_elements));
+    EXPECT_EQ(first, &uut[0]);
+    EXPECT_EQ(second, &uut[num_test_elements]);
+}
+
+struct TestSample
+{
+    int32_t index = 0;
+    std::string message;
+};
+
+FASTDDS_SEQUENCE(TestSampleSeq, TestSample);
+
+template<typename Seq>
+void fill_samples(
+        Seq& seq,
+        const std::string& message)
+{
+    ASSERT_TRUE(seq.length(num_test_elements));
+    for (test_size_type n = 0; n < num_test_elements; ++n)
+    {
+        seq[n].index = n;
+        seq[n].message = message;
+    }
+}
+
+TEST(LoanableSequenceTests, steady_state_without_allocations)
+{
+    const std::string message(64, 'x');
+    TestSampleSeq uut(num_test_elements);
+    TestSampleSeq copy(num_test_elements);
+
+    // First use gives the variable-size members their capacity
+    fill_samples(uut, message);
+    copy = uut;
+
+    // Filling the sequence again, as a take into it does, allocates nothing
+    size_t allocations_before = num_allocations.load();
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(uut.length(0));
+        fill_samples(uut, message);
+        copy = uut;
+    }
+    EXPECT_EQ(allocations_before, num_allocations.load());
+
+    EXPECT_EQ(num_test_elements, copy.length());
+    EXPECT_EQ(message, copy[num_test_elements - 1].message);
+}
+
 int main(
         int argc,
         char** argv)
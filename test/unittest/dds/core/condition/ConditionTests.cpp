@@ -16,6 +16,10 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 #include <fastdds/dds/core/condition/Condition.hpp>
 #include <fastdds/dds/core/condition/GuardCondition.hpp>
 #include <fastdds/dds/core/condition/StatusCondition.hpp>
@@ -23,6 +27,8 @@
 #include <fastdds/rtps/common/Time_t.h>
 #include <fastrtps/types/TypesBase.h>
 
+#include <fastdds/core/condition/StatusConditionImpl.hpp>
+
 using eprosima::fastrtps::types::ReturnCode_t;
 
 using namespace eprosima::fastdds::dds;
@@ -75,44 +81,178 @@ public:
 
 };
 
+class TestCondition : public Condition
+{
+};
+
 TEST_F(ConditionTests, unsupported_condition_methods)
 {
-    Condition cond;
+    TestCondition cond;
 
     ASSERT_FALSE(cond.get_trigger_value());
 
     HELPER_WaitForEntries(1);
 }
 
-TEST_F(ConditionTests, unsupported_wait_set_methods)
+TEST_F(ConditionTests, guard_condition_methods)
+{
+    GuardCondition cond;
+
+    ASSERT_FALSE(cond.get_trigger_value());
+    ASSERT_EQ(cond.set_trigger_value(true), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(cond.get_trigger_value());
+    ASSERT_EQ(cond.set_trigger_value(false), ReturnCode_t::RETCODE_OK);
+    ASSERT_FALSE(cond.get_trigger_value());
+}
+
+TEST_F(ConditionTests, status_condition_methods)
+{
+    StatusCondition cond(nullptr);
+
+    ASSERT_EQ(cond.get_entity(), nullptr);
+    ASSERT_EQ(cond.get_enabled_statuses().to_string(), StatusMask::all().to_string());
+    ASSERT_FALSE(cond.get_trigger_value());
+
+    // Raising a status triggers the condition
+    cond.get_impl()->set_status(StatusMask::data_available(), true);
+    ASSERT_TRUE(cond.get_trigger_value());
+    ASSERT_TRUE(cond.get_impl()->get_raised_statuses().is_active(StatusMask::data_available()));
+
+    // Disabling the raised status resets the trigger
+    ASSERT_EQ(cond.set_enabled_statuses(StatusMask::liveliness_changed()), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(cond.get_enabled_statuses().to_string(), StatusMask::liveliness_changed().to_string());
+    ASSERT_FALSE(cond.get_trigger_value());
+
+    cond.get_impl()->set_status(StatusMask::liveliness_changed(), true);
+    ASSERT_TRUE(cond.get_trigger_value());
+
+    cond.get_impl()->set_status(StatusMask::liveliness_changed(), false);
+    ASSERT_FALSE(cond.get_trigger_value());
+}
+
+TEST_F(ConditionTests, wait_set_attach_detach)
+{
+    WaitSet ws;
+    GuardCondition cond_1;
+    GuardCondition cond_2;
+    ConditionSeq conditions;
+
+    ASSERT_EQ(ws.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
+
+    ASSERT_EQ(ws.attach_condition(cond_1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(ws.attach_condition(cond_2), ReturnCode_t::RETCODE_OK);
+    // Attaching twice has no effect
+    ASSERT_EQ(ws.attach_condition(cond_1), ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(ws.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(conditions.size(), 2u);
+
+    ASSERT_EQ(ws.detach_condition(cond_1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(ws.detach_condition(cond_1), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    ASSERT_EQ(ws.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(conditions.size(), 1u);
+    ASSERT_EQ(conditions[0], &cond_2);
+}
+
+TEST_F(ConditionTests, wait_set_wait)
 {
     WaitSet ws;
-    Condition aux_cond;
-    ConditionSeq aux_cond_seq;
-    eprosima::fastrtps::Duration_t timeout(1, 0u);
-
-    ASSERT_EQ(ws.attach_condition(aux_cond), ReturnCode_t::RETCODE_UNSUPPORTED);
-    ASSERT_EQ(ws.detach_condition(aux_cond), ReturnCode_t::RETCODE_UNSUPPORTED);
-    ASSERT_EQ(ws.get_conditions(aux_cond_seq), ReturnCode_t::RETCODE_UNSUPPORTED);
-    ASSERT_EQ(ws.wait(aux_cond_seq, timeout), ReturnCode_t::RETCODE_UNSUPPORTED);
+    GuardCondition cond_1;
+    GuardCondition cond_2;
+    ConditionSeq active_conditions;
+    eprosima::fastrtps::Duration_t timeout(0, 100000000u);
+
+    ASSERT_EQ(ws.attach_condition(cond_1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(ws.attach_condition(cond_2), ReturnCode_t::RETCODE_OK);
+
+    // Nothing triggered
+    ASSERT_EQ(ws.wait(active_conditions, timeout), ReturnCode_t::RETCODE_TIMEOUT);
+    ASSERT_TRUE(active_conditions.empty());
+
+    // Condition already triggered when entering wait
+    cond_2.set_trigger_value(true);
+    ASSERT_EQ(ws.wait(active_conditions, timeout), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(active_conditions[0], &cond_2);
+    cond_2.set_trigger_value(false);
+
+    // Condition triggered from another thread while waiting
+    std::thread trigger_thread([&cond_1]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                cond_1.set_trigger_value(true);
+            });
+    ASSERT_EQ(ws.wait(active_conditions, eprosima::fastrtps::c_TimeInfinite), ReturnCode_t::RETCODE_OK);
+    trigger_thread.join();
+    ASSERT_EQ(active_conditions.size(), 1u);
+    ASSERT_EQ(active_conditions[0], &cond_1);
 }
 
-TEST_F(ConditionTests, unsupported_guard_condition_methods)
+TEST_F(ConditionTests, wait_set_condition_deleted_while_attached)
 {
-    GuardCondition cond;
+    WaitSet ws;
+    ConditionSeq conditions;
+
+    {
+        GuardCondition cond;
+        ASSERT_EQ(ws.attach_condition(cond), ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(ws.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(conditions.size(), 1u);
+    }
 
-    ASSERT_EQ(cond.set_trigger_value(true), ReturnCode_t::RETCODE_UNSUPPORTED);
+    ASSERT_EQ(ws.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
 }
 
-TEST_F(ConditionTests, unsupported_status_condition_methods)
+TEST_F(ConditionTests, wait_set_conditions_deleted_while_waiting)
 {
-    StatusCondition cond;
+    WaitSet ws;
+    std::atomic<bool> stop(false);
 
-    ASSERT_EQ(cond.set_enabled_statuses(StatusMask()), ReturnCode_t::RETCODE_UNSUPPORTED);
-    ASSERT_EQ(cond.get_enabled_statuses().to_string(), StatusMask().to_string());
-    ASSERT_EQ(cond.get_entity(), nullptr);
+    // The waiting thread evaluates the trigger values while the conditions are being destroyed
+    std::thread wait_thread([&ws, &stop]()
+            {
+                ConditionSeq active_conditions;
+                while (!stop)
+                {
+                    ws.wait(active_conditions, eprosima::fastrtps::Duration_t(0, 1000000));
+                }
+            });
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        GuardCondition guard_cond;
+        StatusCondition status_cond(nullptr);
+        ASSERT_EQ(ws.attach_condition(guard_cond), ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(ws.attach_condition(status_cond), ReturnCode_t::RETCODE_OK);
+        guard_cond.set_trigger_value(true);
+    }
 
-    HELPER_WaitForEntries(2);
+    stop = true;
+    wait_thread.join();
+
+    ConditionSeq conditions;
+    ASSERT_EQ(ws.get_conditions(conditions), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(conditions.empty());
+}
+
+TEST_F(ConditionTests, wait_set_and_condition_deleted_concurrently)
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::unique_ptr<WaitSet> ws(new WaitSet());
+        std::unique_ptr<GuardCondition> cond(new GuardCondition());
+        ASSERT_EQ(ws->attach_condition(*cond), ReturnCode_t::RETCODE_OK);
+
+        std::thread delete_thread([&cond]()
+                {
+                    cond.reset();
+                });
+        ws.reset();
+        delete_thread.join();
+    }
 }
 
 int main(
@@ -151,15 +151,19 @@ TEST_F(EntityTests, entity_equal_operator)
     ASSERT_FALSE(entity1 == entity4);
 }
 
-/* Test unsupported methods behaviour*/
-TEST_F(EntityTests, unsupported_entity_methods)
+/* Test status condition associated to the entity */
+TEST_F(EntityTests, entity_status_condition)
 {
     Entity entity;
 
-    // It cannot compare because StatusCondition does not have comparaison methods
-    entity.get_statuscondition();
+    StatusCondition& condition = entity.get_statuscondition();
+    ASSERT_EQ(condition.get_entity(), &entity);
+    ASSERT_FALSE(condition.get_trigger_value());
+    ASSERT_EQ(condition.get_enabled_statuses(), StatusMask::all());
 
-    HELPER_WaitForEntries(1);
+    const Entity& const_entity = entity;
+    ASSERT_EQ(&const_entity.get_statuscondition(), &condition);
+    ASSERT_EQ(const_entity.get_status_changes(), StatusMask::none());
 }
 
 int main(
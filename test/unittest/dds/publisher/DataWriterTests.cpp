@@ -442,6 +442,50 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteMany)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    qos.history().depth = 2;
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    // More samples than the depth of the history, so some of them are removed before the batch is sent
+    FooType data[5];
+    void* samples[5];
+    for (size_t i = 0; i < 5; ++i)
+    {
+        data[i].message("HelloWorld");
+        samples[i] = &data[i];
+    }
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_many(samples, 5));
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_many(samples, 0));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_many(nullptr, 1));
+
+    // Samples after an invalid one are not written
+    samples[2] = nullptr;
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_many(samples, 5));
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <cassert>
+#include <cstdlib>
+#include <new>
 #include <thread>
 
 #include <gmock/gmock.h>
@@ -54,6 +57,31 @@
 
 #include "../../logging/mock/MockConsumer.h"
 
+// Number of allocations done through the global operator new while the calling thread counts them
+static std::atomic<size_t> num_allocations{0};
+static thread_local bool count_allocations = false;
+
+void* operator new(
+        std::size_t size)
+{
+    if (count_allocations)
+    {
+        ++num_allocations;
+    }
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (nullptr == ptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(
+        void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
 namespace eprosima {
 namespace fastdds {
 namespace dds {
@@ -1278,6 +1306,184 @@ TEST_F(DataReaderTests, read_unread)
     }
 }
 
+/*
+ * Type able to copy samples, which counts the samples it serializes.
+ */
+class CopyableFooTypeSupport : public FooTypeSupport
+{
+public:
+
+    bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        ++serialized_samples;
+        return !fail_serialization && FooTypeSupport::serialize(data, payload);
+    }
+
+    inline bool copy_sample(
+            const void* source,
+            void* destination) const override
+    {
+        *static_cast<FooType*>(destination) = *static_cast<const FooType*>(source);
+        return true;
+    }
+
+    std::atomic<uint32_t> serialized_samples{0};
+    std::atomic<bool> fail_serialization{false};
+};
+
+/*
+ * This test checks that samples written to readers on the same process are copied instead of serialized, and that
+ * they are only serialized when a loan needs a payload.
+ */
+TEST_F(DataReaderTests, typed_intraprocess_delivery)
+{
+    static constexpr int32_t num_samples = 3;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    CopyableFooTypeSupport* copyable_type = new CopyableFooTypeSupport();
+    type_.reset(copyable_type);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.durability().kind = VOLATILE_DURABILITY_QOS;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.data_sharing().off();
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.data_sharing().off();
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(1);
+    data.message()[1] = '\0';
+
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    }
+
+    // Taking into owned samples copies them
+    {
+        FooSeq data_seq(num_samples);
+        SampleInfoSeq info_seq(num_samples);
+
+        EXPECT_EQ(ok_code, data_reader_->take(data_seq, info_seq, 2));
+        check_collection(data_seq, true, num_samples, 2);
+        check_sample_values(data_seq, "01");
+        EXPECT_EQ(0u, copyable_type->serialized_samples.load());
+    }
+
+    // Loans need a payload, so the sample is serialized
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+
+        EXPECT_EQ(ok_code, data_reader_->take(data_seq, info_seq));
+        check_collection(data_seq, false, 1, 1);
+        check_sample_values(data_seq, "2");
+        EXPECT_EQ(1u, copyable_type->serialized_samples.load());
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+    }
+
+    // A sample that can not be serialized for a loan is released, and the loan is not kept
+    data.message()[0] = '3';
+    EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    copyable_type->fail_serialization = true;
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+
+        EXPECT_EQ(ReturnCode_t::RETCODE_ERROR, data_reader_->take(data_seq, info_seq));
+        EXPECT_TRUE(data_seq.has_ownership());
+        EXPECT_EQ(0, data_seq.length());
+        EXPECT_TRUE(info_seq.has_ownership());
+        EXPECT_EQ(0, info_seq.length());
+
+        EXPECT_EQ(ReturnCode_t::RETCODE_NO_DATA, data_reader_->take(data_seq, info_seq));
+    }
+}
+
+/*
+ * This test checks that taking samples on loan and returning the loan allocates nothing once the reader has loaned
+ * all the samples it can keep. Only the allocations of the thread calling take and return_loan are counted.
+ */
+TEST_F(DataReaderTests, take_and_return_loan_without_allocations)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 10;
+    static constexpr int num_iterations = 100;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.data_sharing().off();
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_instances = 1;
+    reader_qos.resource_limits().max_samples_per_instance = num_samples;
+    reader_qos.resource_limits().max_samples = num_samples;
+    reader_qos.data_sharing().off();
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(1);
+    data.message()[1] = '\0';
+
+    FooSeq data_seq;
+    SampleInfoSeq info_seq;
+
+    // The first iteration warms up the loans and the sample pool, and is not counted
+    size_t allocations = 0;
+    for (int i = 0; i <= num_iterations; ++i)
+    {
+        for (char n = 0; n < num_samples; ++n)
+        {
+            data.message()[0] = n + '0';
+            ASSERT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+        }
+
+        int32_t taken = 0;
+        while (taken < num_samples)
+        {
+            ASSERT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+            size_t allocations_before = num_allocations.load();
+            count_allocations = true;
+            ReturnCode_t take_ret = data_reader_->take(data_seq, info_seq);
+            int32_t length = data_seq.length();
+            ReturnCode_t return_loan_ret = data_reader_->return_loan(data_seq, info_seq);
+            count_allocations = false;
+
+            ASSERT_EQ(ok_code, take_ret);
+            ASSERT_EQ(ok_code, return_loan_ret);
+            taken += length;
+            if (i > 0)
+            {
+                allocations += num_allocations.load() - allocations_before;
+            }
+        }
+        ASSERT_EQ(num_samples, taken);
+    }
+
+    EXPECT_EQ(0u, allocations);
+}
+
 TEST_F(DataReaderTests, TerminateWithoutDestroyingReader)
 {
     destroy_entities_ = false;
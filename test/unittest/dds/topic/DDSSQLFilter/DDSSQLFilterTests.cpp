@@ -0,0 +1,314 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterCompiler.hpp>
+#include <fastdds/topic/DDSSQLFilter/DDSFilterExpression.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace DDSSQLFilter {
+
+using namespace fastrtps::types;
+using fastrtps::rtps::SerializedPayload_t;
+
+/**
+ * Builds the following type, and a serialized sample of it:
+ *
+ * enum Color { RED, GREEN, BLUE };
+ * struct Position { double x; long y; };
+ * struct Sample
+ * {
+ *     string name;
+ *     sequence<long> values;
+ *     Color color;
+ *     Position position;
+ *     long count;
+ *     string tail;
+ * };
+ */
+class DDSSQLFilterTests : public ::testing::Test
+{
+public:
+
+    DDSSQLFilterTests()
+        : payload_(1000)
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+        DynamicTypeBuilder_ptr enum_builder = factory->create_enum_builder();
+        enum_builder->add_empty_member(0, "RED");
+        enum_builder->add_empty_member(1, "GREEN");
+        enum_builder->add_empty_member(2, "BLUE");
+        enum_builder->set_name("Color");
+        DynamicType_ptr color_type = enum_builder->build();
+
+        DynamicTypeBuilder_ptr position_builder = factory->create_struct_builder();
+        position_builder->add_member(0, "x", factory->create_float64_type());
+        position_builder->add_member(1, "y", factory->create_int32_type());
+        position_builder->set_name("Position");
+        DynamicType_ptr position_type = position_builder->build();
+
+        DynamicTypeBuilder_ptr sample_builder = factory->create_struct_builder();
+        sample_builder->add_member(0, "name", factory->create_string_type());
+        sample_builder->add_member(1, "values", factory->create_sequence_builder(factory->create_int32_type())->build());
+        sample_builder->add_member(2, "color", color_type);
+        sample_builder->add_member(3, "position", position_type);
+        sample_builder->add_member(4, "count", factory->create_int32_type());
+        sample_builder->add_member(5, "tail", factory->create_string_type());
+        sample_builder->set_name("Sample");
+        type_ = sample_builder->build();
+
+        serialize("hello world", GREEN, 2.5, -3, 42);
+    }
+
+    ~DDSSQLFilterTests()
+    {
+        Log::KillThread();
+    }
+
+protected:
+
+    enum ColorValue
+    {
+        RED = 0,
+        GREEN = 1,
+        BLUE = 2
+    };
+
+    void serialize(
+            const std::string& name,
+            ColorValue color,
+            double x,
+            int32_t y,
+            int32_t count)
+    {
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(type_);
+        data->set_string_value(name, 0);
+        DynamicData* values = data->loan_value(1);
+        MemberId id;
+        values->insert_int32_value(5, id);
+        values->insert_int32_value(7, id);
+        data->return_loaned_value(values);
+        data->set_enum_value(static_cast<uint32_t>(color), 2);
+        DynamicData* position = data->loan_value(3);
+        position->set_float64_value(x, 0);
+        position->set_int32_value(y, 1);
+        data->return_loaned_value(position);
+        data->set_int32_value(count, 4);
+        data->set_string_value("tail", 5);
+
+        DynamicPubSubType pubsub_type(type_);
+        ASSERT_TRUE(pubsub_type.serialize(data, &payload_));
+        DynamicDataFactory::get_instance()->delete_data(data);
+    }
+
+    bool evaluate(
+            const std::string& expression,
+            const std::vector<std::string>& parameters = {})
+    {
+        std::unique_ptr<DDSFilterExpression> filter;
+        EXPECT_EQ(ReturnCode_t::RETCODE_OK, DDSFilterCompiler::compile(expression, parameters, type_, filter));
+        return filter ? filter->evaluate(payload_) : false;
+    }
+
+    ReturnCode_t compile(
+            const std::string& expression,
+            const std::vector<std::string>& parameters = {})
+    {
+        std::unique_ptr<DDSFilterExpression> filter;
+        return DDSFilterCompiler::compile(expression, parameters, type_, filter);
+    }
+
+    DynamicType_ptr type_;
+    SerializedPayload_t payload_;
+};
+
+TEST_F(DDSSQLFilterTests, relational_operators)
+{
+    EXPECT_TRUE(evaluate("count = 42"));
+    EXPECT_FALSE(evaluate("count = 41"));
+    EXPECT_TRUE(evaluate("count <> 41"));
+    EXPECT_TRUE(evaluate("count != 41"));
+    EXPECT_TRUE(evaluate("count < 43"));
+    EXPECT_TRUE(evaluate("count <= 42"));
+    EXPECT_FALSE(evaluate("count > 42"));
+    EXPECT_TRUE(evaluate("count >= 42"));
+    EXPECT_TRUE(evaluate("41 < count"));
+    EXPECT_TRUE(evaluate("position.y = -3"));
+    EXPECT_TRUE(evaluate("position.x > 2"));
+    EXPECT_TRUE(evaluate("position.x < 2.6"));
+    EXPECT_TRUE(evaluate("position.x > position.y"));
+}
+
+TEST_F(DDSSQLFilterTests, between)
+{
+    EXPECT_TRUE(evaluate("count BETWEEN 40 AND 50"));
+    EXPECT_TRUE(evaluate("count BETWEEN 42 AND 42"));
+    EXPECT_FALSE(evaluate("count BETWEEN 43 AND 50"));
+    EXPECT_FALSE(evaluate("count NOT BETWEEN 40 AND 50"));
+    EXPECT_TRUE(evaluate("position.x BETWEEN %0 AND %1", {"2.0", "3.0"}));
+}
+
+TEST_F(DDSSQLFilterTests, strings)
+{
+    EXPECT_TRUE(evaluate("name = 'hello world'"));
+    EXPECT_FALSE(evaluate("name = 'hello'"));
+    EXPECT_TRUE(evaluate("name > 'hello'"));
+    EXPECT_TRUE(evaluate("name LIKE 'hello%'"));
+    EXPECT_TRUE(evaluate("name LIKE '%world'"));
+    EXPECT_TRUE(evaluate("name LIKE 'h_llo w_rld'"));
+    EXPECT_FALSE(evaluate("name LIKE 'h_llo'"));
+    EXPECT_TRUE(evaluate("name NOT LIKE '%xyz%'"));
+    EXPECT_TRUE(evaluate("tail = \"tail\""));
+}
+
+TEST_F(DDSSQLFilterTests, enumerations)
+{
+    EXPECT_TRUE(evaluate("color = GREEN"));
+    EXPECT_FALSE(evaluate("color = BLUE"));
+    EXPECT_TRUE(evaluate("color = 'GREEN'"));
+    EXPECT_TRUE(evaluate("color < BLUE"));
+    EXPECT_TRUE(evaluate("color = %0", {"GREEN"}));
+    EXPECT_FALSE(evaluate("color = %0", {"RED"}));
+    EXPECT_TRUE(evaluate("color = %0", {"'GREEN'"}));
+}
+
+TEST_F(DDSSQLFilterTests, logical_operators)
+{
+    EXPECT_TRUE(evaluate("count = 42 AND name = 'hello world'"));
+    EXPECT_FALSE(evaluate("count = 42 AND name = 'hello'"));
+    EXPECT_TRUE(evaluate("count = 41 OR name = 'hello world'"));
+    EXPECT_FALSE(evaluate("NOT count = 42"));
+    EXPECT_TRUE(evaluate("NOT (count = 41 OR color = RED)"));
+    EXPECT_TRUE(evaluate("count = 41 OR color = RED OR position.y < 0 AND tail = 'tail'"));
+    EXPECT_FALSE(evaluate("(count = 41 OR color = GREEN) AND position.y > 0"));
+}
+
+TEST_F(DDSSQLFilterTests, parameters)
+{
+    std::unique_ptr<DDSFilterExpression> filter;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK,
+            DDSFilterCompiler::compile("count < %0 AND name LIKE %1", {"50", "'%world'"}, type_, filter));
+    EXPECT_TRUE(filter->evaluate(payload_));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, filter->set_parameters({"10", "'%world'"}));
+    EXPECT_FALSE(filter->evaluate(payload_));
+
+    // Invalid values keep the previous ones
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, filter->set_parameters({"'text'", "'%world'"}));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, filter->set_parameters({"50"}));
+    EXPECT_FALSE(filter->evaluate(payload_));
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, filter->set_parameters({"50", "'hello%'"}));
+    EXPECT_TRUE(filter->evaluate(payload_));
+}
+
+TEST_F(DDSSQLFilterTests, samples)
+{
+    std::unique_ptr<DDSFilterExpression> filter;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK,
+            DDSFilterCompiler::compile("color = BLUE AND count > 10", {}, type_, filter));
+    EXPECT_FALSE(filter->evaluate(payload_));
+
+    serialize("other", BLUE, 0.0, 0, 11);
+    EXPECT_TRUE(filter->evaluate(payload_));
+
+    serialize("other", BLUE, 0.0, 0, 10);
+    EXPECT_FALSE(filter->evaluate(payload_));
+
+    // Truncated payloads cannot be evaluated, and are considered as passing the filter
+    payload_.length = 8;
+    EXPECT_TRUE(filter->evaluate(payload_));
+}
+
+TEST_F(DDSSQLFilterTests, invalid_expressions)
+{
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile(""));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count = "));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count = 1 AND"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("(count = 1"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count = 'text'"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count LIKE 'text'"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("missing = 1"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("position = 1"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("values = 1"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("color = PURPLE"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("color = 'PURPLE'"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("color = %0", {"PURPLE"}));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("name = 'unterminated"));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count = %1", {"1"}));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, compile("count = %0", {"'text'"}));
+}
+
+TEST_F(DDSSQLFilterTests, non_structure_types)
+{
+    std::unique_ptr<DDSFilterExpression> filter;
+    DynamicType_ptr int_type = DynamicTypeBuilderFactory::get_instance()->create_int32_type();
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, DDSFilterCompiler::compile("a = 1", {}, int_type, filter));
+}
+
+TEST_F(DDSSQLFilterTests, mutable_types)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    std::unique_ptr<DDSFilterExpression> filter;
+
+    DynamicTypeBuilder_ptr inner_builder = factory->create_struct_builder();
+    inner_builder->add_member(0, "a", factory->create_int32_type());
+    inner_builder->set_name("MutableInner");
+    inner_builder->apply_annotation(ANNOTATION_MUTABLE_ID, "value", "true");
+    DynamicType_ptr inner_type = inner_builder->build();
+
+    // Samples of a mutable type are serialized as parameter lists
+    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, DDSFilterCompiler::compile("a = 1", {}, inner_type, filter));
+    EXPECT_FALSE(filter);
+
+    // Mutable members cannot be walked either
+    DynamicTypeBuilder_ptr outer_builder = factory->create_struct_builder();
+    outer_builder->add_member(0, "inner", inner_type);
+    outer_builder->add_member(1, "count", factory->create_int32_type());
+    outer_builder->set_name("FinalOuter");
+    DynamicType_ptr outer_type = outer_builder->build();
+    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, DDSFilterCompiler::compile("count = 1", {}, outer_type, filter));
+    EXPECT_EQ(ReturnCode_t::RETCODE_UNSUPPORTED, DDSFilterCompiler::compile("inner.a = 1", {}, outer_type, filter));
+    EXPECT_FALSE(filter);
+}
+
+} // namespace DDSSQLFilter
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
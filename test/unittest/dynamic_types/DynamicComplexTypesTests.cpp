@@ -27,12 +27,17 @@
 #include <fastrtps/types/DynamicType.h>
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/types/TypeObjectFactory.h>
+#include <fastrtps/utils/md5.h>
 #include <fastdds/dds/log/Log.hpp>
 
 #include "idl/Test.h"
 #include "idl/TestPubSubTypes.h"
 #include "idl/TestTypeObject.h"
 
+#include <cfloat>
+#include <cstring>
+#include <vector>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace eprosima::fastrtps::types;
@@ -2214,6 +2219,255 @@ TEST_F(DynamicComplexTypesTests, Data_Comparison_with_Keys)
     DynamicDataFactory::get_instance()->delete_data(dynDataFromDynamic);
 }
 
+// CDR gives a long double 16 bytes, but the x87 format only defines the first 10 and the rest is whatever the
+// serialized copy held there. The samples set every long double to a marker to find where those bytes land.
+static const long double long_double_marker = -1.234567890123456789e-300L;
+static const uint32_t long_double_value_size = LDBL_MANT_DIG == 64 ? 10 : sizeof(long double);
+
+static void mark_long_doubles(
+        ComplexStruct& data)
+{
+    data.my_basic_struct().my_float128(long_double_marker);
+    for (BasicStruct& basic : data.my_sequence_struct())
+    {
+        basic.my_float128(long_double_marker);
+    }
+    for (BasicStruct& basic : data.my_array_struct())
+    {
+        basic.my_float128(long_double_marker);
+    }
+}
+
+static std::vector<uint32_t> find_long_doubles(
+        const SerializedPayload_t& payload)
+{
+    std::vector<uint32_t> positions;
+    // CDR alignment counts from the end of the encapsulation.
+    for (uint32_t i = 4; i + 16 <= payload.length; i += 8)
+    {
+        if (memcmp(&payload.data[i], &long_double_marker, long_double_value_size) == 0)
+        {
+            positions.push_back(i);
+        }
+    }
+    return positions;
+}
+
+static ::testing::AssertionResult same_payload_bytes(
+        const SerializedPayload_t& expected,
+        const SerializedPayload_t& actual,
+        const std::vector<uint32_t>& long_doubles)
+{
+    if (expected.length != actual.length)
+    {
+        return ::testing::AssertionFailure() << "length " << actual.length << " != " << expected.length;
+    }
+
+    uint32_t begin = 0;
+    for (uint32_t position : long_doubles)
+    {
+        uint32_t end = position + long_double_value_size;
+        if (memcmp(&expected.data[begin], &actual.data[begin], end - begin) != 0)
+        {
+            return ::testing::AssertionFailure() << "bytes differ between offsets " << begin << " and " << end;
+        }
+        begin = position + 16;
+    }
+    if (memcmp(&expected.data[begin], &actual.data[begin], expected.length - begin) != 0)
+    {
+        return ::testing::AssertionFailure() << "bytes differ after offset " << begin;
+    }
+    return ::testing::AssertionSuccess();
+}
+
+TEST_F(DynamicComplexTypesTests, Data_Comparison_Serialization_Plan)
+{
+    ComplexStruct staticData;
+    staticData.my_octet(66);
+    staticData.my_basic_struct().my_bool(true);
+    staticData.my_basic_struct().my_int16(-10401);
+    staticData.my_basic_struct().my_int64(884481567);
+    staticData.my_basic_struct().my_float128(765241878.154874);
+    staticData.my_basic_struct().my_wchar(L'G');
+    staticData.my_basic_struct().my_string("Luis@eProsima");
+    staticData.my_basic_struct().my_wstring(L"LuisGasco@eProsima");
+    staticData.my_alias_enum(C);
+    staticData.my_enum(B);
+    staticData.my_sequence_octet().push_back(1);
+    staticData.my_sequence_octet().push_back(2);
+    staticData.my_sequence_struct().resize(2);
+    staticData.my_sequence_struct()[1].my_string("G It's");
+    staticData.my_array_octet()[3][2][1] = 'Z';
+    staticData.my_octet_array_500()[499] = 5;
+    staticData.my_array_struct()[4].my_uint32(15884);
+    staticData.my_map_octet_short()[3] = 300;
+    staticData.my_small_string_8("short");
+    staticData.my_large_string_16(L"Working");
+    staticData.my_array_string()[1][2] = "Array";
+    staticData.my_sequences_array()[22].push_back(7);
+    // The generated constructor leaves it uninitialized, and DynamicData drops the elements of an array of arrays
+    // because it compares them as equal to the default one.
+    for (auto& mini : staticData.my_array_arrays())
+    {
+        mini.fill(0);
+    }
+
+    ComplexStructPubSubType staticPubSub;
+    SerializedPayload_t stPayload(static_cast<uint32_t>(staticPubSub.getSerializedSizeProvider(&staticData)()));
+    ASSERT_TRUE(staticPubSub.serialize(&staticData, &stPayload));
+
+    // The type registered with the topic serializes through its compiled plan.
+    DynamicPubSubType pubsubType(GetComplexStructType());
+    types::DynamicData_ptr dynData(DynamicDataFactory::get_instance()->create_data(GetComplexStructType()));
+    ASSERT_TRUE(pubsubType.deserialize(&stPayload, dynData.get()));
+
+    uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(dynData.get())());
+    SerializedPayload_t dynPayload(payloadSize);
+    ASSERT_TRUE(pubsubType.serialize(dynData.get(), &dynPayload));
+
+    // Without a registered type, DynamicData serializes itself.
+    DynamicPubSubType dataPubSub;
+    SerializedPayload_t dataPayload(payloadSize);
+    ASSERT_TRUE(dataPubSub.serialize(dynData.get(), &dataPayload));
+
+    // Both write the same bytes as the generated type.
+    ComplexStruct markedData(staticData);
+    mark_long_doubles(markedData);
+    SerializedPayload_t markedPayload(stPayload.length);
+    ASSERT_TRUE(staticPubSub.serialize(&markedData, &markedPayload));
+    std::vector<uint32_t> long_doubles = find_long_doubles(markedPayload);
+    ASSERT_EQ(8u, long_doubles.size());
+    ASSERT_TRUE(same_payload_bytes(stPayload, dynPayload, long_doubles));
+    ASSERT_TRUE(same_payload_bytes(stPayload, dataPayload, long_doubles));
+
+    // Each one reads what the other wrote.
+    types::DynamicData_ptr dynData2(DynamicDataFactory::get_instance()->create_data(GetComplexStructType()));
+    ASSERT_TRUE(dataPubSub.deserialize(&dynPayload, dynData2.get()));
+    ASSERT_TRUE(dynData2->equals(dynData.get()));
+    types::DynamicData_ptr dynData3(DynamicDataFactory::get_instance()->create_data(GetComplexStructType()));
+    ASSERT_TRUE(pubsubType.deserialize(&dataPayload, dynData3.get()));
+    ASSERT_TRUE(dynData3->equals(dynData.get()));
+
+    ComplexStruct staticData2;
+    ASSERT_TRUE(staticPubSub.deserialize(&dynPayload, &staticData2));
+    ASSERT_EQ(staticData2.my_basic_struct().my_wstring(), staticData.my_basic_struct().my_wstring());
+    ASSERT_EQ(staticData2.my_sequence_struct()[1].my_string(), staticData.my_sequence_struct()[1].my_string());
+    ASSERT_EQ(staticData2.my_array_octet()[3][2][1], 'Z');
+    ASSERT_EQ(staticData2.my_array_struct()[4].my_uint32(), 15884u);
+    ASSERT_EQ(staticData2.my_map_octet_short()[3], 300);
+    ASSERT_EQ(staticData2.my_array_string()[1][2], "Array");
+    ASSERT_EQ(staticData2.my_sequences_array()[22], staticData.my_sequences_array()[22]);
+
+    // Deserializing again reuses the elements already there.
+    ASSERT_TRUE(pubsubType.deserialize(&dynPayload, dynData2.get()));
+    ASSERT_TRUE(dynData2->equals(dynData.get()));
+}
+
+TEST_F(DynamicComplexTypesTests, Key_Comparison_Serialization_Plan)
+{
+    // Only types whose members carry the key annotation are serialized into the key, so the key is an union.
+    // It follows a member without keys.
+    DynamicTypeBuilder_ptr octet_builder = m_factory->create_byte_builder();
+    DynamicTypeBuilder_ptr int32_builder = m_factory->create_int32_builder();
+    DynamicTypeBuilder_ptr key_union_builder = m_factory->create_union_builder(octet_builder.get());
+    key_union_builder->add_member(0, "uno", int32_builder.get(), "0", { 0 }, false);
+    key_union_builder->add_member(1, "dos", int32_builder.get(), "1", { 1 }, false);
+    key_union_builder->apply_annotation_to_member(1, ANNOTATION_KEY_ID, "value", "true");
+    key_union_builder->set_name("KeyUnion");
+    DynamicTypeBuilder_ptr keyed_builder = m_factory->create_struct_builder();
+    keyed_builder->add_member(0, "basic", GetBasicStructType());
+    keyed_builder->add_member(1, "key", key_union_builder->build());
+    keyed_builder->apply_annotation_to_member(1, ANNOTATION_KEY_ID, "value", "true");
+    keyed_builder->set_name("KeyedPlanStruct");
+    DynamicType_ptr keyed_type = keyed_builder->build();
+
+    DynamicData_ptr dynData(DynamicDataFactory::get_instance()->create_data(keyed_type));
+    DynamicData* basic = dynData->loan_value(dynData->get_member_id_by_name("basic"));
+    basic->set_int32_value(-12000000, basic->get_member_id_by_name("my_int32"));
+    basic->set_string_value("G It's", basic->get_member_id_by_name("my_string"));
+    dynData->return_loaned_value(basic);
+    DynamicData* key = dynData->loan_value(dynData->get_member_id_by_name("key"));
+    key->set_int32_value(-12000000, key->get_member_id_by_name("dos"));
+    dynData->return_loaned_value(key);
+
+    // Big endian key: the discriminator, the padding of the int32 and the int32. Then its MD5.
+    unsigned char keyBuffer[16] = { 1, 0, 0, 0, 0xFF, 0x48, 0xE5, 0x00 };
+    MD5 md5;
+    md5.init();
+    md5.update(keyBuffer, 8);
+    md5.finalize();
+
+    // The type registered with the topic gets the key through its compiled plan.
+    DynamicPubSubType pubsubType(keyed_type);
+    InstanceHandle_t handle;
+    ASSERT_TRUE(pubsubType.getKey(dynData.get(), &handle, false));
+    ASSERT_EQ(0, memcmp(handle.value, keyBuffer, sizeof(keyBuffer)));
+    ASSERT_TRUE(pubsubType.getKey(dynData.get(), &handle, true));
+    ASSERT_EQ(0, memcmp(handle.value, md5.digest, sizeof(md5.digest)));
+}
+
+TEST_F(DynamicComplexTypesTests, Copy_Sample)
+{
+    ComplexStruct staticData;
+    staticData.my_octet(66);
+    staticData.my_basic_struct().my_string("Luis@eProsima");
+    staticData.my_basic_struct().my_wstring(L"LuisGasco@eProsima");
+    staticData.my_sequence_struct().resize(2);
+    staticData.my_sequence_struct()[1].my_string("G It's");
+    staticData.my_array_struct()[4].my_uint32(15884);
+    staticData.my_map_octet_short()[3] = 300;
+    staticData.my_array_string()[1][2] = "Array";
+    for (auto& mini : staticData.my_array_arrays())
+    {
+        mini.fill(0);
+    }
+
+    ComplexStructPubSubType staticPubSub;
+    SerializedPayload_t stPayload(static_cast<uint32_t>(staticPubSub.getSerializedSizeProvider(&staticData)()));
+    ASSERT_TRUE(staticPubSub.serialize(&staticData, &stPayload));
+
+    DynamicPubSubType pubsubType(GetComplexStructType());
+    DynamicData* source = static_cast<DynamicData*>(pubsubType.createData());
+    ASSERT_TRUE(pubsubType.deserialize(&stPayload, source));
+
+    // The copy replaces whatever the destination held, and does not share anything with the source
+    DynamicData* destination = static_cast<DynamicData*>(pubsubType.createData());
+    ASSERT_TRUE(pubsubType.copy_sample(source, destination));
+    ASSERT_TRUE(destination->equals(source));
+    ASSERT_TRUE(pubsubType.copy_sample(source, destination));
+    ASSERT_TRUE(destination->equals(source));
+    pubsubType.deleteData(source);
+
+    SerializedPayload_t copyPayload(stPayload.length);
+    ASSERT_TRUE(pubsubType.serialize(destination, &copyPayload));
+    ComplexStruct staticCopy;
+    ASSERT_TRUE(staticPubSub.deserialize(&copyPayload, &staticCopy));
+    ASSERT_EQ(staticCopy.my_basic_struct().my_wstring(), staticData.my_basic_struct().my_wstring());
+    ASSERT_EQ(staticCopy.my_sequence_struct()[1].my_string(), staticData.my_sequence_struct()[1].my_string());
+    ASSERT_EQ(staticCopy.my_array_struct()[4].my_uint32(), 15884u);
+    ASSERT_EQ(staticCopy.my_map_octet_short()[3], 300);
+    ASSERT_EQ(staticCopy.my_array_string()[1][2], "Array");
+
+    // Unions own their discriminator
+    DynamicPubSubType completePubSub(m_DynManualType);
+    DynamicData* union_source = static_cast<DynamicData*>(completePubSub.createData());
+    DynamicData* my_union_2 = union_source->loan_value(union_source->get_member_id_by_name("my_union_2"));
+    my_union_2->set_int32_value(156, my_union_2->get_member_id_by_name("uno"));
+    union_source->return_loaned_value(my_union_2);
+    DynamicData* union_destination = static_cast<DynamicData*>(completePubSub.createData());
+    ASSERT_TRUE(completePubSub.copy_sample(union_source, union_destination));
+    completePubSub.deleteData(union_source);
+    my_union_2 = union_destination->loan_value(union_destination->get_member_id_by_name("my_union_2"));
+    ASSERT_EQ(156, my_union_2->get_int32_value(my_union_2->get_member_id_by_name("uno")));
+    union_destination->return_loaned_value(my_union_2);
+
+    // Samples of other types are not copied
+    ASSERT_FALSE(completePubSub.copy_sample(destination, union_destination));
+
+    completePubSub.deleteData(union_destination);
+    pubsubType.deleteData(destination);
+}
+
 TEST_F(DynamicComplexTypesTests, TypeInformation)
 {
     const TypeObject* compl_obj = TypeObjectFactory::get_instance()->get_type_object("CompleteStruct", true);
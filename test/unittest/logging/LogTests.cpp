@@ -22,6 +22,7 @@
 #include <memory>
 #include <thread>
 #include <chrono>
+#include <iomanip>
 #include <sstream>
 
 using namespace eprosima::fastdds::dds;
@@ -87,6 +88,89 @@ TEST_F(LogTests, reporting_options)
     ASSERT_EQ(entry.context.function, nullptr);
 }
 
+struct LoggedType
+{
+    int value;
+};
+
+std::ostream& operator <<(
+        std::ostream& output,
+        const LoggedType& logged)
+{
+    return output << "LoggedType(" << logged.value << ")";
+}
+
+TEST_F(LogTests, message_arguments)
+{
+    const std::string text("string");
+    const char* c_string = "c_string";
+    char char_array[] = "char_array";
+    const short negative_short = -7;
+    const unsigned long long big = 18446744073709551615ull;
+    const float float_value = 1.5f;
+    const double double_value = 0.125;
+    const bool flag = true;
+    const LoggedType logged{42};
+
+    std::stringstream expected;
+    expected << text << ' ' << c_string << char_array << negative_short << big << -3 << 7u << 'x' << float_value <<
+        double_value << flag << std::boolalpha << flag << std::hex << 255 << std::dec << logged << std::endl;
+
+    logError(Arguments, text << ' ' << c_string << char_array << negative_short << big << -3 << 7u << 'x' <<
+            float_value << double_value << flag << std::boolalpha << flag << std::hex << 255 << std::dec << logged <<
+            std::endl);
+
+    auto consumedEntries = HELPER_WaitForEntries(1);
+    ASSERT_EQ(1u, consumedEntries.size());
+    EXPECT_EQ(expected.str(), consumedEntries.back().message);
+}
+
+TEST_F(LogTests, format_manipulators)
+{
+    const LoggedType logged{42};
+    const std::string text("text");
+
+    std::stringstream expected;
+    expected << std::setw(5) << 42 << '|' << std::setfill('*') << std::setw(4) << 'x' << '|' << std::left <<
+        std::setw(7) << text << '|' << std::setw(6) << "c" << "d" << '|' << std::right << std::setw(16) <<
+        logged << '|' << std::fixed << std::setprecision(2) << 3.14159 << '|' << std::setw(3) << 1u << "end" <<
+        '|' << std::setprecision(9) << 1.0f / 3.0f << std::setbase(16) << 255;
+
+    logError(Manipulators, std::setw(5) << 42 << '|' << std::setfill('*') << std::setw(4) << 'x' << '|' <<
+            std::left << std::setw(7) << text << '|' << std::setw(6) << "c" << "d" << '|' << std::right <<
+            std::setw(16) << logged << '|' << std::fixed << std::setprecision(2) << 3.14159 << '|' <<
+            std::setw(3) << 1u << "end" << '|' << std::setprecision(9) << 1.0f / 3.0f << std::setbase(16) << 255);
+
+    auto consumedEntries = HELPER_WaitForEntries(1);
+    ASSERT_EQ(1u, consumedEntries.size());
+    EXPECT_EQ(expected.str(), consumedEntries.back().message);
+}
+
+TEST_F(LogTests, filters_changed_after_logging)
+{
+    logError(GoodCategory, "Logged before any filter");
+    logError(BadCategory, "Logged before any filter");
+    auto consumedEntries = HELPER_WaitForEntries(2);
+    ASSERT_EQ(2u, consumedEntries.size());
+
+    Log::SetCategoryFilter(std::regex("(Good)"));
+    logError(GoodCategory, "Logged with the category filter");
+    logError(BadCategory, "If you're seeing this, something went wrong");
+    consumedEntries = HELPER_WaitForEntries(4);
+    ASSERT_EQ(3u, consumedEntries.size());
+
+    Log::SetFilenameFilter(std::regex("(NotThisFile)"));
+    logError(GoodCategory, "If you're seeing this, something went wrong");
+    consumedEntries = HELPER_WaitForEntries(4);
+    ASSERT_EQ(3u, consumedEntries.size());
+
+    Log::Reset();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(mockConsumer = new MockConsumer()));
+    logError(BadCategory, "Logged after resetting the filters");
+    consumedEntries = HELPER_WaitForEntries(1);
+    ASSERT_EQ(1u, consumedEntries.size());
+}
+
 TEST_F(LogTests, multithreaded_logging)
 {
     vector<unique_ptr<thread>> threads;
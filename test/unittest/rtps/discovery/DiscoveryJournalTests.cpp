@@ -0,0 +1,237 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <rtps/builtin/discovery/database/backup/DiscoveryJournal.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using namespace eprosima::fastrtps::rtps;
+
+// Size of a record without payload, including its size prefix
+static constexpr size_t empty_record_size = 4 + 112;
+
+class DiscoveryJournalTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        std::remove(file_name);
+    }
+
+    void TearDown() override
+    {
+        clear_changes();
+        std::remove(file_name);
+    }
+
+    void clear_changes()
+    {
+        for (CacheChange_t* change : changes)
+        {
+            delete change;
+        }
+        changes.clear();
+    }
+
+    static void fill_change(
+            CacheChange_t& change,
+            uint32_t payload_length,
+            octet seed)
+    {
+        change.kind = NOT_ALIVE_DISPOSED;
+        change.writerGUID.guidPrefix.value[3] = seed;
+        change.writerGUID.entityId.value[3] = 0xC2;
+        change.instanceHandle.value[5] = seed;
+        change.sequenceNumber = SequenceNumber_t(2, seed);
+        change.isRead = true;
+        change.sourceTimestamp.seconds(11);
+        change.sourceTimestamp.fraction(12);
+        change.receptionTimestamp.seconds(13);
+        change.receptionTimestamp.fraction(14);
+        change.write_params.sample_identity().writer_guid() = change.writerGUID;
+        change.write_params.sample_identity().sequence_number() = SequenceNumber_t(0, 5);
+        change.write_params.related_sample_identity().sequence_number() = SequenceNumber_t(0, 6);
+        change.serializedPayload.encapsulation = 3;
+        change.serializedPayload.reserve(payload_length);
+        change.serializedPayload.length = payload_length;
+        for (uint32_t i = 0; i < payload_length; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(seed + i);
+        }
+    }
+
+    static std::vector<char> file_contents()
+    {
+        std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    static void write_file(
+            const std::vector<char>& contents)
+    {
+        std::ofstream file(file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    // Writes two records, the second one with a payload of 10 bytes
+    void write_journal()
+    {
+        CacheChange_t first;
+        CacheChange_t second;
+        fill_change(first, 0, 1);
+        fill_change(second, 10, 2);
+
+        DiscoveryJournal journal;
+        ASSERT_TRUE(journal.open(file_name));
+        journal.append(first);
+        journal.append(second);
+        journal.close();
+    }
+
+    static constexpr const char* file_name = "DiscoveryJournalTests.journal";
+
+    std::vector<CacheChange_t*> changes;
+};
+
+constexpr const char* DiscoveryJournalTests::file_name;
+
+TEST_F(DiscoveryJournalTests, records_are_read_back)
+{
+    CacheChange_t change;
+    fill_change(change, 10, 2);
+    write_journal();
+
+    ASSERT_TRUE(DiscoveryJournal::read(file_name, changes));
+    ASSERT_EQ(2u, changes.size());
+    EXPECT_EQ(0u, changes[0]->serializedPayload.length);
+
+    const CacheChange_t& read = *changes[1];
+    EXPECT_EQ(change.kind, read.kind);
+    EXPECT_EQ(change.writerGUID, read.writerGUID);
+    EXPECT_EQ(change.instanceHandle, read.instanceHandle);
+    EXPECT_EQ(change.sequenceNumber, read.sequenceNumber);
+    EXPECT_EQ(change.isRead, read.isRead);
+    EXPECT_EQ(change.sourceTimestamp, read.sourceTimestamp);
+    EXPECT_EQ(change.receptionTimestamp, read.receptionTimestamp);
+    EXPECT_EQ(change.write_params.sample_identity(), read.write_params.sample_identity());
+    EXPECT_EQ(change.write_params.related_sample_identity(), read.write_params.related_sample_identity());
+    EXPECT_EQ(change.serializedPayload.encapsulation, read.serializedPayload.encapsulation);
+    ASSERT_EQ(change.serializedPayload.length, read.serializedPayload.length);
+    EXPECT_EQ(0, memcmp(change.serializedPayload.data, read.serializedPayload.data, read.serializedPayload.length));
+}
+
+TEST_F(DiscoveryJournalTests, record_format)
+{
+    write_journal();
+
+    std::vector<char> contents = file_contents();
+    ASSERT_EQ(2 * empty_record_size + 10, contents.size());
+
+    // Each record starts with its size, not counting the size itself, followed by the kind of the change
+    uint32_t record_size = 0;
+    memcpy(&record_size, contents.data(), sizeof(record_size));
+    EXPECT_EQ(empty_record_size - 4, record_size);
+    EXPECT_EQ(static_cast<char>(NOT_ALIVE_DISPOSED), contents[4]);
+
+    memcpy(&record_size, contents.data() + empty_record_size, sizeof(record_size));
+    EXPECT_EQ(empty_record_size - 4 + 10, record_size);
+
+    // The payload closes the record
+    EXPECT_EQ(2 + 9, contents.back());
+
+    // Reopening the journal keeps its records and their size
+    DiscoveryJournal journal;
+    ASSERT_TRUE(journal.open(file_name));
+    EXPECT_EQ(contents.size(), journal.size());
+}
+
+TEST_F(DiscoveryJournalTests, missing_journal_is_not_read)
+{
+    EXPECT_FALSE(DiscoveryJournal::read(file_name, changes));
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST_F(DiscoveryJournalTests, torn_trailing_record_is_discarded)
+{
+    write_journal();
+    std::vector<char> contents = file_contents();
+
+    // Cut inside the payload, inside the header and inside the size of the last record
+    for (size_t cut : {size_t(3), size_t(20), empty_record_size + 10 - 2})
+    {
+        write_file(std::vector<char>(contents.begin(), contents.end() - static_cast<std::ptrdiff_t>(cut)));
+        ASSERT_TRUE(DiscoveryJournal::read(file_name, changes));
+        EXPECT_EQ(1u, changes.size()) << "cut " << cut;
+        clear_changes();
+    }
+}
+
+TEST_F(DiscoveryJournalTests, corrupt_record_size_stops_reading)
+{
+    write_journal();
+    std::vector<char> contents = file_contents();
+    std::vector<char> corrupt = contents;
+
+    // Huge size on the last record: rejected without trying to allocate it
+    uint32_t record_size = 0xFFFFFFF0u;
+    memcpy(corrupt.data() + empty_record_size, &record_size, sizeof(record_size));
+    write_file(corrupt);
+    ASSERT_TRUE(DiscoveryJournal::read(file_name, changes));
+    EXPECT_EQ(1u, changes.size());
+    clear_changes();
+
+    // Size that fits in the file but does not match the length of the payload
+    corrupt = contents;
+    record_size = empty_record_size - 4 + 5;
+    memcpy(corrupt.data() + empty_record_size, &record_size, sizeof(record_size));
+    write_file(corrupt);
+    ASSERT_TRUE(DiscoveryJournal::read(file_name, changes));
+    EXPECT_EQ(1u, changes.size());
+    clear_changes();
+
+    // Size smaller than a record header on the first record
+    corrupt = contents;
+    record_size = 3;
+    memcpy(corrupt.data(), &record_size, sizeof(record_size));
+    write_file(corrupt);
+    ASSERT_TRUE(DiscoveryJournal::read(file_name, changes));
+    EXPECT_TRUE(changes.empty());
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
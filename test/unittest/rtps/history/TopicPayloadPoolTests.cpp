@@ -406,6 +406,76 @@ TEST_P(TopicPayloadPoolTests, release_history_writer_finite_size)
     do_history_test(reserve_size, reserve_max_size, false);
 }
 
+TEST(TopicPayloadPoolArenaTests, invalid_numa_node_is_ignored)
+{
+    for (const char* value : {"", "node1", "1x", "99999999999999999999"})
+    {
+        PropertyPolicy properties;
+        properties.properties().emplace_back("fastdds.payload_arena.numa_node", value);
+        PayloadArenaConfig config = PayloadArenaConfig::from_properties(properties);
+        EXPECT_FALSE(config.enabled) << "numa_node = '" << value << "'";
+        EXPECT_LT(config.numa_node, 0) << "numa_node = '" << value << "'";
+    }
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.payload_arena.numa_node", "1");
+    PayloadArenaConfig config = PayloadArenaConfig::from_properties(properties);
+    EXPECT_TRUE(config.enabled);
+    EXPECT_EQ(config.numa_node, 1);
+}
+
+TEST(TopicPayloadPoolArenaTests, preallocated_payloads_on_arena)
+{
+    constexpr uint32_t num_payloads = 10u;
+    constexpr uint32_t payload_size = 256u;
+
+    PropertyPolicy properties;
+    properties.properties().emplace_back("fastdds.payload_arena.huge_pages", "true");
+    PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, payload_size, num_payloads, 0 };
+    config.payload_arena = PayloadArenaConfig::from_properties(properties);
+    ASSERT_TRUE(config.payload_arena.enabled);
+    ASSERT_TRUE(config.payload_arena.huge_pages);
+    ASSERT_LT(config.payload_arena.numa_node, 0);
+
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), num_payloads);
+    EXPECT_EQ(pool->payload_pool_available_size(), num_payloads);
+
+    // Preallocated payloads are zeroed and carved from a single block
+    std::vector<CacheChange_t> changes(num_payloads);
+    octet* lowest = nullptr;
+    octet* highest = nullptr;
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(pool->get_payload(payload_size, change));
+        ASSERT_EQ(change.serializedPayload.max_size, payload_size);
+        for (uint32_t i = 0; i < payload_size; ++i)
+        {
+            ASSERT_EQ(change.serializedPayload.data[i], 0u);
+        }
+        lowest = (lowest == nullptr || change.serializedPayload.data < lowest) ? change.serializedPayload.data : lowest;
+        highest = (highest == nullptr || change.serializedPayload.data > highest) ?
+                change.serializedPayload.data : highest;
+    }
+    EXPECT_LT(static_cast<size_t>(highest - lowest), static_cast<size_t>(num_payloads * (payload_size + 64u)));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), num_payloads);
+
+    // A payload on the arena moves to the heap when it needs to grow
+    ASSERT_TRUE(pool->release_payload(changes.back()));
+    ASSERT_TRUE(pool->get_payload(payload_size * 4, changes.back()));
+    EXPECT_GE(changes.back().serializedPayload.max_size, payload_size * 4);
+    EXPECT_EQ(pool->payload_pool_allocated_size(), num_payloads);
+
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(change));
+    }
+    ASSERT_TRUE(pool->release_history(config, false));
+    EXPECT_EQ(pool->payload_pool_allocated_size(), 0u);
+    EXPECT_EQ(pool->payload_pool_available_size(), 0u);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
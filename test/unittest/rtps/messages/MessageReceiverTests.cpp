@@ -0,0 +1,196 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using ::testing::NiceMock;
+using ::testing::ReturnRef;
+
+class ReaderRecordingWriters : public RTPSReader
+{
+public:
+
+    ReaderRecordingWriters(
+            const GUID_t& guid)
+    {
+        m_guid = guid;
+        m_att.endpointKind = READER;
+    }
+
+    bool matched_writer_add(
+            const WriterProxyData&) override
+    {
+        return true;
+    }
+
+    bool matched_writer_remove(
+            const GUID_t&,
+            bool) override
+    {
+        return true;
+    }
+
+    bool matched_writer_is_matched(
+            const GUID_t&) override
+    {
+        return true;
+    }
+
+    bool processDataMsg(
+            CacheChange_t* change) override
+    {
+        received_from.push_back(change->writerGUID);
+        return true;
+    }
+
+    std::vector<GUID_t> received_from;
+};
+
+class MessageReceiverTests : public ::testing::Test
+{
+protected:
+
+    MessageReceiverTests()
+        : receiver_(&participant_, 65536)
+        , reader_(GUID_t(local_prefix(), EntityId_t(0x00000107)))
+        , writer_a_(remote_prefix(), EntityId_t(0x00000102))
+        , writer_b_(remote_prefix(), EntityId_t(0x00000202))
+    {
+        EXPECT_CALL(participant_, getGuid()).WillRepeatedly(ReturnRef(participant_guid_));
+        receiver_.associateEndpoint(&reader_);
+    }
+
+    ~MessageReceiverTests()
+    {
+        receiver_.removeEndpoint(&reader_);
+    }
+
+    static GuidPrefix_t local_prefix()
+    {
+        GuidPrefix_t prefix;
+        prefix.value[11] = 1;
+        return prefix;
+    }
+
+    static GuidPrefix_t remote_prefix()
+    {
+        GuidPrefix_t prefix;
+        prefix.value[11] = 2;
+        return prefix;
+    }
+
+    //! Receive a DATA of a writer addressed to unknown readers, as writers send it to multicast locators.
+    void receive_data(
+            const GUID_t& writer_guid)
+    {
+        CDRMessage_t msg(RTPSMESSAGE_DEFAULT_SIZE);
+        const octet header[] = {'R', 'T', 'P', 'S', 2, 3, 0x01, 0x0F};
+        add(msg, header, sizeof(header));
+        add(msg, writer_guid.guidPrefix.value, GuidPrefix_t::size);
+
+        // DATA submessage in little endian, with serialized payload
+        const octet submessage_header[] = {DATA, 0x05, 28, 0, 0, 0, 16, 0};
+        add(msg, submessage_header, sizeof(submessage_header));
+        add(msg, c_EntityId_Unknown.value, EntityId_t::size);
+        add(msg, writer_guid.entityId.value, EntityId_t::size);
+        const octet sequence_number[] = {0, 0, 0, 0, 1, 0, 0, 0};
+        add(msg, sequence_number, sizeof(sequence_number));
+        const octet payload[] = {0, 1, 0, 0, 1, 2, 3, 4};
+        add(msg, payload, sizeof(payload));
+
+        receiver_.processCDRMsg(Locator_t(), &msg);
+    }
+
+    static void add(
+            CDRMessage_t& msg,
+            const octet* data,
+            uint32_t size)
+    {
+        memcpy(&msg.buffer[msg.length], data, size);
+        msg.length += size;
+    }
+
+    NiceMock<RTPSParticipantImpl> participant_;
+    GUID_t participant_guid_ = GUID_t(local_prefix(), c_EntityId_RTPSParticipant);
+    MessageReceiver receiver_;
+    ReaderRecordingWriters reader_;
+    GUID_t writer_a_;
+    GUID_t writer_b_;
+};
+
+TEST_F(MessageReceiverTests, data_to_unknown_readers_is_given_to_matched_readers_only)
+{
+    receiver_.add_matched_writer(&reader_, writer_a_);
+
+    receive_data(writer_a_);
+    receive_data(writer_b_);
+    ASSERT_EQ(1u, reader_.received_from.size());
+    EXPECT_EQ(writer_a_, reader_.received_from[0]);
+
+    receiver_.remove_matched_writer(&reader_, writer_a_);
+
+    receive_data(writer_a_);
+    EXPECT_EQ(1u, reader_.received_from.size());
+}
+
+TEST_F(MessageReceiverTests, data_to_unknown_readers_is_given_to_readers_matching_many_writers)
+{
+    // Enough writers to fill every shard of the index
+    std::vector<GUID_t> writers;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        GUID_t writer = writer_b_;
+        writer.guidPrefix.value[8] = static_cast<octet>(i);
+        writers.push_back(writer);
+        receiver_.add_matched_writer(&reader_, writer);
+    }
+
+    for (const GUID_t& writer : writers)
+    {
+        receive_data(writer);
+    }
+    EXPECT_EQ(writers, reader_.received_from);
+
+    for (const GUID_t& writer : writers)
+    {
+        receiver_.remove_matched_writer(&reader_, writer);
+    }
+    receive_data(writers.front());
+    EXPECT_EQ(writers.size(), reader_.received_from.size());
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
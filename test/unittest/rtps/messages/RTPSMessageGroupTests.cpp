@@ -0,0 +1,235 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/Endpoint.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <cstring>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+using ::testing::NiceMock;
+using ::testing::ReturnRef;
+
+//! Records the messages sent through it, and the number of slices each one was given in.
+class RecordingSender : public RTPSMessageSenderInterface
+{
+public:
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return c_GuidPrefix_Unknown;
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return participants_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return guids_;
+    }
+
+    bool send_slices(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            std::chrono::steady_clock::time_point&) const override
+    {
+        std::vector<octet> message;
+        for (const NetworkBuffer& slice : buffers)
+        {
+            message.insert(message.end(), slice.buffer, slice.buffer + slice.size);
+        }
+        EXPECT_EQ(total_bytes, message.size());
+        messages.push_back(message);
+        slices.push_back(buffers.size());
+        return true;
+    }
+
+    mutable std::vector<std::vector<octet>> messages;
+    mutable std::vector<size_t> slices;
+
+private:
+
+    std::vector<GuidPrefix_t> participants_;
+    std::vector<GUID_t> guids_;
+};
+
+class TestEndpoint : public Endpoint
+{
+public:
+
+    TestEndpoint(
+            RTPSParticipantImpl* participant,
+            const GUID_t& guid)
+    {
+        mp_RTPSParticipant = participant;
+        m_guid = guid;
+        m_att.topicKind = WITH_KEY;
+    }
+
+};
+
+class RTPSMessageGroupTests : public ::testing::Test
+{
+protected:
+
+    RTPSMessageGroupTests()
+        : endpoint_(&participant_, GUID_t(prefix(), EntityId_t(0x00000103)))
+    {
+        EXPECT_CALL(participant_, getGuid()).WillRepeatedly(ReturnRef(participant_guid_));
+    }
+
+    static GuidPrefix_t prefix()
+    {
+        GuidPrefix_t prefix;
+        prefix.value[11] = 1;
+        return prefix;
+    }
+
+    //! Creates an ALIVE change with a payload of the given size.
+    CacheChange_t* change(
+            uint32_t payload_size)
+    {
+        changes_.emplace_back(new CacheChange_t(payload_size));
+        CacheChange_t* ch = changes_.back().get();
+        ch->kind = ALIVE;
+        ch->writerGUID = endpoint_.getGuid();
+        ch->sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(changes_.size()));
+        ch->sourceTimestamp = Time_t(10, 20);
+        ch->instanceHandle.value[0] = static_cast<octet>(changes_.size());
+        ch->serializedPayload.length = payload_size;
+        for (uint32_t i = 0; i < payload_size; ++i)
+        {
+            ch->serializedPayload.data[i] = static_cast<octet>(i * 7 + changes_.size());
+        }
+        return ch;
+    }
+
+    /*!
+     * Sends the same submessages through a group which references the payloads and through a group which copies
+     * them, and checks that both send the same bytes.
+     */
+    template<typename AddSubmessages>
+    void check_same_messages(
+            AddSubmessages add_submessages)
+    {
+        auto max_blocking_time = std::chrono::steady_clock::now() + std::chrono::hours(24);
+
+        RecordingSender gathered;
+        {
+            RTPSMessageGroup group(&participant_, &endpoint_, gathered, max_blocking_time);
+            add_submessages(group);
+        }
+
+        RecordingSender contiguous;
+        {
+            RTPSMessageGroup group(&participant_, &endpoint_, contiguous, max_blocking_time);
+            group.copy_payloads();
+            add_submessages(group);
+        }
+
+        ASSERT_FALSE(gathered.messages.empty());
+        ASSERT_EQ(contiguous.messages.size(), gathered.messages.size());
+        for (size_t i = 0; i < gathered.messages.size(); ++i)
+        {
+            EXPECT_EQ(1u, contiguous.slices[i]);
+            EXPECT_LT(1u, gathered.slices[i]);
+            ASSERT_EQ(contiguous.messages[i].size(), gathered.messages[i].size());
+            EXPECT_EQ(0, memcmp(contiguous.messages[i].data(), gathered.messages[i].data(),
+                    gathered.messages[i].size()));
+        }
+    }
+
+    NiceMock<RTPSParticipantImpl> participant_;
+    GUID_t participant_guid_ = GUID_t(prefix(), c_EntityId_RTPSParticipant);
+    TestEndpoint endpoint_;
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+};
+
+TEST_F(RTPSMessageGroupTests, referenced_data_payloads_are_sent_as_when_copied)
+{
+    // Every alignment of the end of the payload, mixed with payloads too small to be referenced
+    std::vector<CacheChange_t*> to_send = {change(1024), change(100), change(1025), change(1026), change(3),
+                                           change(1027), change(4000)};
+
+    check_same_messages([&](RTPSMessageGroup& group)
+            {
+                for (CacheChange_t* ch : to_send)
+                {
+                    ASSERT_TRUE(group.add_data(*ch, false));
+                }
+            });
+}
+
+TEST_F(RTPSMessageGroupTests, referenced_data_frag_payloads_are_sent_as_when_copied)
+{
+    // The last fragment is not a multiple of 4
+    CacheChange_t* large = change(10003);
+    large->setFragmentSize(1250, true);
+    ASSERT_EQ(9u, large->getFragmentCount());
+
+    check_same_messages([&](RTPSMessageGroup& group)
+            {
+                for (uint32_t fragment = 1; fragment <= large->getFragmentCount(); ++fragment)
+                {
+                    ASSERT_TRUE(group.add_data_frag(*large, fragment, false));
+                }
+            });
+}
+
+TEST_F(RTPSMessageGroupTests, messages_referencing_many_payloads_are_sent_as_when_copied)
+{
+    // More payloads than a message may reference, so the last ones are copied anyway
+    std::vector<CacheChange_t*> to_send;
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        to_send.push_back(change(1024 + i));
+    }
+
+    check_same_messages([&](RTPSMessageGroup& group)
+            {
+                for (CacheChange_t* ch : to_send)
+                {
+                    ASSERT_TRUE(group.add_data(*ch, false));
+                }
+            });
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1189,6 +1189,173 @@ TEST_F(CryptographyPluginTest, transform_SerializedPayload)
     delete shared_secret;
 }
 
+TEST_F(CryptographyPluginTest, transform_SerializedPayload_RekeyedWithSameIds)
+{
+
+    // Participant A owns Writer
+    // Participant B owns Reader
+    eprosima::fastrtps::rtps::security::PKIIdentityHandle* i_handle =
+            new eprosima::fastrtps::rtps::security::PKIIdentityHandle();
+    eprosima::fastrtps::rtps::security::AccessPermissionsHandle* perm_handle =
+            new eprosima::fastrtps::rtps::security::AccessPermissionsHandle();
+    eprosima::fastrtps::rtps::PropertySeq prop_handle;
+    eprosima::fastrtps::rtps::security::ParticipantSecurityAttributes part_sec_attr;
+    eprosima::fastrtps::rtps::security::EndpointSecurityAttributes sec_attrs;
+    eprosima::fastrtps::rtps::security::SharedSecretHandle* shared_secret =
+            new eprosima::fastrtps::rtps::security::SharedSecretHandle();
+
+    eprosima::fastrtps::rtps::security::SecurityException exception;
+
+    part_sec_attr.is_rtps_protected = true;
+    part_sec_attr.plugin_participant_attributes = PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ENCRYPTED |
+            PLUGIN_PARTICIPANT_SECURITY_ATTRIBUTES_FLAG_IS_RTPS_ORIGIN_AUTHENTICATED;
+
+    sec_attrs.is_submessage_protected = true;
+    sec_attrs.is_payload_protected = true;
+    sec_attrs.is_key_protected = true;
+    sec_attrs.plugin_endpoint_attributes = PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ORIGIN_AUTHENTICATED |
+            PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
+
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* participant_A =
+            CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr,
+                    exception);
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* participant_B =
+            CryptoPlugin->keyfactory()->register_local_participant(*i_handle, *perm_handle, prop_handle, part_sec_attr,
+                    exception);
+
+    eprosima::fastrtps::rtps::security::DatareaderCryptoHandle* reader =
+            CryptoPlugin->keyfactory()->register_local_datareader(*participant_A, prop_handle, sec_attrs, exception);
+    eprosima::fastrtps::rtps::security::DatareaderCryptoHandle* writer =
+            CryptoPlugin->keyfactory()->register_local_datawriter(*participant_B, prop_handle, sec_attrs, exception);
+
+    //Fill shared secret with dummy values
+    std::vector<uint8_t> dummy_data, challenge_1, challenge_2;
+    eprosima::fastrtps::rtps::security::SharedSecret::BinaryData binary_data;
+    challenge_1.resize(32);
+    challenge_2.resize(32);
+
+    RAND_bytes(challenge_1.data(), 32);
+    binary_data.name("Challenge1");
+    binary_data.value(challenge_1);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    RAND_bytes(challenge_2.data(), 32);
+    binary_data.name("Challenge2");
+    binary_data.value(challenge_2);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    dummy_data.resize(32);
+    RAND_bytes(dummy_data.data(), 32);
+    binary_data.name("SharedSecret");
+    binary_data.value(dummy_data);
+    (*shared_secret)->data_.push_back(binary_data);
+
+    //Register a remote for both Participants
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* ParticipantA_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_A, *i_handle, *perm_handle,
+                    *shared_secret, exception);
+    eprosima::fastrtps::rtps::security::ParticipantCryptoHandle* ParticipantB_remote =
+            CryptoPlugin->keyfactory()->register_matched_remote_participant(*participant_B, *i_handle, *perm_handle,
+                    *shared_secret, exception);
+
+    //Register DataReader with DataWriter
+    eprosima::fastrtps::rtps::security::DatareaderCryptoHandle* remote_reader =
+            CryptoPlugin->keyfactory()->register_matched_remote_datareader(*writer, *ParticipantB_remote,
+                    *shared_secret, false, exception);
+
+    //Register DataWriter with DataReader
+    eprosima::fastrtps::rtps::security::DatawriterCryptoHandle* remote_writer =
+            CryptoPlugin->keyfactory()->register_matched_remote_datawriter(*reader, *ParticipantA_remote,
+                    *shared_secret, exception);
+
+    //Create CryptoTokens for both Participants
+    eprosima::fastrtps::rtps::security::ParticipantCryptoTokenSeq ParticipantA_CryptoTokens, ParticipantB_CryptoTokens;
+
+    CryptoPlugin->keyexchange()->create_local_participant_crypto_tokens(ParticipantA_CryptoTokens, *participant_A,
+            *ParticipantA_remote, exception);
+    CryptoPlugin->keyexchange()->create_local_participant_crypto_tokens(ParticipantB_CryptoTokens, *participant_B,
+            *ParticipantB_remote, exception);
+
+    //Set ParticipantA token into ParticipantB and viceversa
+    CryptoPlugin->keyexchange()->set_remote_participant_crypto_tokens(*participant_A, *ParticipantA_remote,
+            ParticipantB_CryptoTokens, exception);
+    CryptoPlugin->keyexchange()->set_remote_participant_crypto_tokens(*participant_B, *ParticipantB_remote,
+            ParticipantA_CryptoTokens, exception);
+
+    //Create CryptoTokens for the DataWriter and DataReader
+    eprosima::fastrtps::rtps::security::DatawriterCryptoTokenSeq Writer_CryptoTokens, Reader_CryptoTokens;
+
+    CryptoPlugin->keyexchange()->create_local_datawriter_crypto_tokens(Writer_CryptoTokens, *writer, *remote_reader,
+            exception);
+    CryptoPlugin->keyexchange()->create_local_datareader_crypto_tokens(Reader_CryptoTokens, *reader, *remote_writer,
+            exception);
+
+    //Exchange Datareader and Datawriter Cryptotokens
+    CryptoPlugin->keyexchange()->set_remote_datareader_crypto_tokens(*writer, *remote_reader, Reader_CryptoTokens,
+            exception);
+    CryptoPlugin->keyexchange()->set_remote_datawriter_crypto_tokens(*reader, *remote_writer, Writer_CryptoTokens,
+            exception);
+
+    //Perform sample message exchange
+    eprosima::fastrtps::rtps::SerializedPayload_t plain_payload(18); // Message will have 18 length.
+    eprosima::fastrtps::rtps::SerializedPayload_t encoded_payload(100);
+    // Message will have 18 length + cipher block size.
+    eprosima::fastrtps::rtps::SerializedPayload_t decoded_payload(18 + 32);
+
+    char message[] = "My goose is cooked"; //Length 18
+    memcpy(plain_payload.data, message, 18);
+    plain_payload.length = 18;
+
+    std::vector<uint8_t> inline_qos;
+
+    //Send message to intended participant
+    ASSERT_TRUE(CryptoPlugin->cryptotransform()->encode_serialized_payload(encoded_payload, inline_qos, plain_payload,
+            *writer, exception));
+    encoded_payload.pos = 0;
+    ASSERT_TRUE(CryptoPlugin->cryptotransform()->decode_serialized_payload(decoded_payload, encoded_payload, inline_qos,
+            *reader, *remote_writer, exception));
+    ASSERT_TRUE(memcmp(plain_payload.data, decoded_payload.data, 18) == 0);
+
+    //Replace the key of the DataWriter keeping its ids, as a new token announcing other keys would do
+    eprosima::fastrtps::rtps::security::AESGCMGMAC_WriterCryptoHandle& RemoteWriterH =
+            eprosima::fastrtps::rtps::security::AESGCMGMAC_WriterCryptoHandle::narrow(*remote_writer);
+    eprosima::fastrtps::rtps::security::KeyMaterial_AES_GCM_GMAC& remote_key_mat =
+            RemoteWriterH->Entity2RemoteKeyMaterial.at(0);
+    remote_key_mat.master_sender_key[0] ^= 0xFF;
+
+    //The session derived from the old key must not be used for the new one
+    encoded_payload.pos = 0;
+    decoded_payload.pos = 0;
+    decoded_payload.length = 0;
+    ASSERT_FALSE(CryptoPlugin->cryptotransform()->decode_serialized_payload(decoded_payload, encoded_payload,
+            inline_qos, *reader, *remote_writer, exception));
+
+    //Back to the key the message was encoded with
+    remote_key_mat.master_sender_key[0] ^= 0xFF;
+    encoded_payload.pos = 0;
+    decoded_payload.pos = 0;
+    decoded_payload.length = 0;
+    ASSERT_TRUE(CryptoPlugin->cryptotransform()->decode_serialized_payload(decoded_payload, encoded_payload,
+            inline_qos, *reader, *remote_writer, exception));
+    ASSERT_TRUE(memcmp(plain_payload.data, decoded_payload.data, 18) == 0);
+
+    CryptoPlugin->keyfactory()->unregister_datawriter(writer, exception);
+    CryptoPlugin->keyfactory()->unregister_datawriter(remote_writer, exception);
+
+    CryptoPlugin->keyfactory()->unregister_datareader(reader, exception);
+    CryptoPlugin->keyfactory()->unregister_datareader(remote_reader, exception);
+
+    CryptoPlugin->keyfactory()->unregister_participant(participant_A, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantA_remote, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(participant_B, exception);
+    CryptoPlugin->keyfactory()->unregister_participant(ParticipantB_remote, exception);
+
+    delete i_handle;
+    delete perm_handle;
+    delete shared_secret;
+}
+
 TEST_F(CryptographyPluginTest, transform_Writer_Submesage)
 {
 
@@ -868,6 +868,72 @@ TEST_F(SHMTransportTests, send_and_receive_between_ports)
     sender_thread->join();
 }
 
+TEST_F(SHMTransportTests, send_slices_and_receive_between_ports)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+    octet header[3] = { 'H', 'e', 'l' };
+    octet payload[2] = { 'l', 'o' };
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+
+    // The slices are gathered directly into the shared buffer
+    eprosima::fastrtps::rtps::NetworkBufferList buffers;
+    buffers.emplace_back(header, 3);
+    buffers.emplace_back(payload, 2);
+
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+                sem.post();
+            };
+    msg_recv->setCallback(recCallback);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    auto sendThreadFunction = [&]()
+            {
+                Locators locators_begin(locator_list.begin());
+                Locators locators_end(locator_list.end());
+
+                EXPECT_TRUE(send_resource_list.at(0)->send(buffers, 5, &locators_begin, &locators_end,
+                        (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+            };
+
+    std::unique_ptr<std::thread> sender_thread;
+    sender_thread.reset(new std::thread(sendThreadFunction));
+
+    sem.wait();
+    sender_thread->join();
+
+    // Slices that do not add up to the message size are not sent
+    for (uint32_t total_bytes : {4u, 6u})
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        EXPECT_FALSE(send_resource_list.at(0)->send(buffers, total_bytes, &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+    }
+}
+
 TEST_F(SHMTransportTests, port_and_segment_overflow_discard)
 {
     SharedMemTransportDescriptor my_descriptor;
@@ -959,6 +1025,154 @@ TEST_F(SHMTransportTests, port_and_segment_overflow_discard)
     sem.disable();
 }
 
+TEST_F(SHMTransportTests, hung_listener_does_not_block_heartbeat)
+{
+    SharedMemTransportDescriptor my_descriptor;
+
+    my_descriptor.segment_size(1024);
+    my_descriptor.max_message_size(1024);
+    my_descriptor.port_queue_capacity(4);
+    my_descriptor.healthy_check_timeout_ms(100);
+
+    SharedMemTransport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    // The listener hangs while processing the first message
+    std::atomic<bool> is_first_message_received(false);
+    std::function<void()> recCallback = [&]()
+            {
+                is_first_message_received = true;
+                sem.wait();
+            };
+    msg_recv->setCallback(recCallback);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // Two halves of the segment: one being processed by the listener, and one it will not pop
+    octet data[512] = { 'D', 'a', 't', 'a' };
+    for (int i = 0; i < 2; i++)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        EXPECT_TRUE(send_resource_list.at(0)->send(data, sizeof(data), &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+
+        while (!is_first_message_received)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // A heartbeat is sent without a writer deadline. It waits for the listener no longer than the healthy check
+    // timeout, and then takes the buffer the listener did not pop.
+    octet heartbeat[60] = { 'H', 'B' };
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_TRUE(send_resource_list.at(0)->send(heartbeat, sizeof(heartbeat), &locators_begin, &locators_end,
+                (start + std::chrono::hours(24))));
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    }
+
+    sem.disable();
+}
+
+TEST_F(SHMTransportTests, control_send_waits_healthy_check_timeout_on_full_segment)
+{
+    static constexpr uint32_t healthy_check_timeout_ms = 300;
+
+    SharedMemTransportDescriptor my_descriptor;
+
+    my_descriptor.segment_size(1024);
+    my_descriptor.max_message_size(1024);
+    my_descriptor.port_queue_capacity(4);
+    my_descriptor.healthy_check_timeout_ms(healthy_check_timeout_ms);
+
+    SharedMemTransport transportUnderTest(my_descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t unicastLocator;
+    unicastLocator.kind = LOCATOR_KIND_SHM;
+    unicastLocator.port = g_default_port;
+
+    Semaphore sem;
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    // The listener hangs while processing the first message
+    std::atomic<bool> is_first_message_received(false);
+    std::function<void()> recCallback = [&]()
+            {
+                is_first_message_received = true;
+                sem.wait();
+            };
+    msg_recv->setCallback(recCallback);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.kind = LOCATOR_KIND_SHM;
+    outputChannelLocator.port = g_default_port + 1;
+
+    eprosima::fastrtps::rtps::SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    locator_list.push_back(unicastLocator);
+
+    // Fill the segment with one buffer being processed by the listener, and one it will not pop
+    octet data[512] = { 'D', 'a', 't', 'a' };
+    for (int i = 0; i < 2; i++)
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        EXPECT_TRUE(send_resource_list.at(0)->send(data, sizeof(data), &locators_begin, &locators_end,
+                (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+
+        while (!is_first_message_received)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // Control messages are sent without a writer deadline, so the send blocks the whole healthy check timeout
+    // before discarding the buffer the listener did not pop
+    octet heartbeat[60] = { 'H', 'B' };
+    {
+        Locators locators_begin(locator_list.begin());
+        Locators locators_end(locator_list.end());
+
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_TRUE(send_resource_list.at(0)->send(heartbeat, sizeof(heartbeat), &locators_begin, &locators_end,
+                (start + std::chrono::hours(24))));
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        EXPECT_GE(elapsed, std::chrono::milliseconds(healthy_check_timeout_ms));
+        EXPECT_LT(elapsed, std::chrono::milliseconds(healthy_check_timeout_ms) + std::chrono::seconds(2));
+    }
+
+    sem.disable();
+}
+
 TEST_F(SHMTransportTests, port_mutex_deadlock_recover)
 {
     const std::string domain_name("SHMTests");
@@ -1619,6 +1833,160 @@ TEST_F(SHMTransportTests, buffer_recover)
     thread_listener2.join();
 }
 
+TEST_F(SHMTransportTests, buffer_reuse)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(4096, 16);
+
+    auto buf = segment->alloc_buffer(100u, std::chrono::steady_clock::time_point());
+    void* data = buf->data();
+    buf.reset();
+
+    // Sizes of the same size class reuse the released block
+    buf = segment->alloc_buffer(110u, std::chrono::steady_clock::time_point());
+    EXPECT_EQ(data, buf->data());
+    EXPECT_EQ(110u, buf->size());
+
+    // While in use, the block is not given to another buffer
+    auto buf2 = segment->alloc_buffer(110u, std::chrono::steady_clock::time_point());
+    EXPECT_NE(data, buf2->data());
+    buf.reset();
+    buf2.reset();
+
+    // Cached blocks are given back when a bigger buffer needs their memory
+    buf = segment->alloc_buffer(4096u, std::chrono::steady_clock::time_point());
+    ASSERT_TRUE(buf != nullptr);
+    EXPECT_EQ(4096u, buf->size());
+}
+
+TEST_F(SHMTransportTests, buffer_reuse_after_exact_size_allocation)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    {
+        auto segment = shared_mem_manager->create_segment(256, 16);
+
+        // After the first buffer there is no room for the size class of the second one, only for its exact size
+        auto first = segment->alloc_buffer(100u, std::chrono::steady_clock::time_point());
+        auto exact = segment->alloc_buffer(140u, std::chrono::steady_clock::time_point());
+        void* data = exact->data();
+        exact.reset();
+
+        // The exact block is reused for the largest class fitting on it
+        exact = segment->alloc_buffer(128u, std::chrono::steady_clock::time_point());
+        EXPECT_EQ(data, exact->data());
+    }
+
+    {
+        auto segment = shared_mem_manager->create_segment(256, 16);
+
+        // Buffers smaller than the smallest class never take a smaller block, even when the segment is full
+        auto big = segment->alloc_buffer(200u, std::chrono::steady_clock::time_point());
+        EXPECT_THROW(segment->alloc_buffer(10u, std::chrono::steady_clock::time_point()), std::runtime_error);
+        big.reset();
+
+        auto small = segment->alloc_buffer(10u, std::chrono::steady_clock::time_point());
+        uint8_t* data = static_cast<uint8_t*>(small->data());
+        small.reset();
+
+        // So the block can be reused for a buffer of the whole class without reaching the next block
+        auto larger = segment->alloc_buffer(64u, std::chrono::steady_clock::time_point());
+        auto next = segment->alloc_buffer(64u, std::chrono::steady_clock::time_point());
+        ASSERT_EQ(data, larger->data());
+        uint8_t* next_data = static_cast<uint8_t*>(next->data());
+        EXPECT_TRUE(next_data >= data + 64u || next_data + 64u <= data);
+    }
+}
+
+TEST_F(SHMTransportTests, alloc_buffer_waits_for_listener)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(1024, 1);
+
+    shared_mem_manager->remove_port(1);
+    auto port_write = shared_mem_manager->open_port(1, 8, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    auto port_read = shared_mem_manager->open_port(1, 8, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto listener = port_read->create_listener();
+
+    {
+        auto buf = segment->alloc_buffer(1024u, std::chrono::steady_clock::time_point());
+        *static_cast<uint8_t*>(buf->data()) = 1u;
+        ASSERT_TRUE(port_write->try_push(buf));
+    }
+
+    // The listener takes its time to pop the only buffer of the segment
+    std::atomic<uint8_t> received(0u);
+    auto thread_listener = std::thread([&]
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                        auto buffer = listener->pop();
+                        if (buffer)
+                        {
+                            received.store(*static_cast<uint8_t*>(buffer->data()));
+                        }
+                    });
+
+    // The allocation waits for the listener instead of discarding the buffer it did not pop yet
+    auto start = std::chrono::steady_clock::now();
+    auto buf = segment->alloc_buffer(1024u, start + std::chrono::seconds(5));
+    ASSERT_TRUE(buf != nullptr);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(90));
+
+    thread_listener.join();
+    EXPECT_EQ(1u, received.load());
+}
+
+TEST_F(SHMTransportTests, listener_spin_time)
+{
+    const std::string domain_name("SHMTests");
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(1024, 16);
+
+    shared_mem_manager->remove_port(1);
+    auto port_write = shared_mem_manager->open_port(1, 8, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    auto port_read = shared_mem_manager->open_port(1, 8, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto listener = port_read->create_listener();
+    listener->spin_time(std::chrono::seconds(10));
+
+    std::atomic<uint32_t> received(0u);
+    auto thread_listener = std::thread([&]
+                    {
+                        while (auto buffer = listener->pop())
+                        {
+                            received.fetch_add(*static_cast<uint8_t*>(buffer->data()));
+                        }
+                    });
+
+    // Buffers pushed while the listener spins are received
+    for (uint8_t i = 1u; i <= 3u; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto buf = segment->alloc_buffer(1u, std::chrono::steady_clock::time_point());
+        *static_cast<uint8_t*>(buf->data()) = i;
+        ASSERT_TRUE(port_write->try_push(buf));
+    }
+
+    auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (received.load() < 6u && std::chrono::steady_clock::now() < limit)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(6u, received.load());
+
+    // Closing the listener interrupts the spin
+    auto start = std::chrono::steady_clock::now();
+    listener->close();
+    thread_listener.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
 TEST_F(SHMTransportTests, remote_segments_free)
 {
     const std::string domain_name("SHMTests");
@@ -19,11 +19,17 @@
 #include <thread>
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/IPLocator.h>
-//#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/log/Log.hpp>
 #include <memory>
 #include <asio.hpp>
 #include <MockReceiverResource.h>
 
+#if defined(__linux__)
+#include <atomic>
+#include <dlfcn.h>
+#include <errno.h>
+#include <sys/socket.h>
+#endif // if defined(__linux__)
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -40,6 +46,89 @@ const uint32_t ReceiveBufferCapacity = 65536;
 
 static uint16_t g_default_port = 0;
 
+#if defined(__linux__)
+// Number of upcoming datagram sends of this process that fail as if the socket buffer were full.
+// A negative value makes all of them fail.
+static std::atomic<int> g_failing_sends(0);
+// Number of sends that were made to fail.
+static std::atomic<uint32_t> g_failed_sends(0);
+
+static void fail_next_sends(
+        int count)
+{
+    g_failed_sends = 0;
+    g_failing_sends = count;
+}
+
+static bool socket_buffer_full()
+{
+    int failing = g_failing_sends;
+    while (failing != 0)
+    {
+        if (failing < 0 || g_failing_sends.compare_exchange_weak(failing, failing - 1))
+        {
+            ++g_failed_sends;
+            errno = EAGAIN;
+            return true;
+        }
+    }
+    return false;
+}
+
+extern "C" ssize_t sendto(
+        int fd,
+        const void* buffer,
+        size_t length,
+        int flags,
+        const struct sockaddr* address,
+        socklen_t address_length)
+{
+    using sendto_t = ssize_t (*)(int, const void*, size_t, int, const struct sockaddr*, socklen_t);
+    static sendto_t real_sendto = reinterpret_cast<sendto_t>(dlsym(RTLD_NEXT, "sendto"));
+
+    if (socket_buffer_full())
+    {
+        return -1;
+    }
+    return real_sendto(fd, buffer, length, flags, address, address_length);
+}
+
+extern "C" ssize_t sendmsg(
+        int fd,
+        const struct msghdr* message,
+        int flags)
+{
+    using sendmsg_t = ssize_t (*)(int, const struct msghdr*, int);
+    static sendmsg_t real_sendmsg = reinterpret_cast<sendmsg_t>(dlsym(RTLD_NEXT, "sendmsg"));
+
+    if (socket_buffer_full())
+    {
+        return -1;
+    }
+    return real_sendmsg(fd, message, flags);
+}
+
+extern "C" int sendmmsg(
+        int fd,
+        struct mmsghdr* messages,
+        unsigned int count,
+        int flags)
+{
+    using sendmmsg_t = int (*)(int, struct mmsghdr*, unsigned int, int);
+    static sendmmsg_t real_sendmmsg = reinterpret_cast<sendmmsg_t>(dlsym(RTLD_NEXT, "sendmmsg"));
+
+    if (socket_buffer_full())
+    {
+        return -1;
+    }
+    return real_sendmmsg(fd, messages, count, flags);
+}
+
+// A send that keeps failing for 100 ms backs off up to 1 ms between retries, so it retries at most this many times.
+static const uint32_t MaxRetriesIn100ms = 2 + 6 + 100;
+
+#endif // if defined(__linux__)
+
 uint16_t get_port()
 {
     uint16_t port = static_cast<uint16_t>(GET_PID());
@@ -63,7 +152,7 @@ public:
 
     ~UDPv4Tests()
     {
-        //Log::KillThread();
+        eprosima::fastdds::dds::Log::KillThread();
     }
 
     void HELPER_SetDescriptorDefaults();
@@ -261,6 +350,305 @@ TEST_F(UDPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_i
             &locators_begin, &locators_end, (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
 }
 
+TEST_F(UDPv4Tests, send_with_expired_blocking_time_is_not_dropped_when_socket_is_writable)
+{
+    // Given
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    SendResourceList send_resource_list;
+    Locator_t genericOutputChannelLocator;
+    genericOutputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    genericOutputChannelLocator.port = g_default_port;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, genericOutputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locator_t destinationLocator;
+    destinationLocator.kind = LOCATOR_KIND_UDPv4;
+    destinationLocator.port = g_default_port + 1;
+    IPLocator::setIPv4(destinationLocator, 127, 0, 0, 1);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(destinationLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    // When
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    ASSERT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() - std::chrono::microseconds(100))));
+
+    // Then
+    auto statistics = transportUnderTest.get_send_statistics();
+    EXPECT_EQ(0u, statistics.dropped_would_block);
+    EXPECT_EQ(0u, statistics.blocked_sends);
+}
+
+#if defined(__linux__)
+TEST_F(UDPv4Tests, send_to_several_locators_uses_a_single_fan_out_call)
+{
+    // Given
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    SendResourceList send_resource_list;
+    Locator_t genericOutputChannelLocator;
+    genericOutputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    genericOutputChannelLocator.port = g_default_port;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, genericOutputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    for (uint16_t i = 1; i <= 3; ++i)
+    {
+        Locator_t destinationLocator;
+        destinationLocator.kind = LOCATOR_KIND_UDPv4;
+        destinationLocator.port = g_default_port + i;
+        IPLocator::setIPv4(destinationLocator, 127, 0, 0, 1);
+        locator_list.push_back(destinationLocator);
+    }
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    // When
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    ASSERT_TRUE(send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+
+    // Then
+    auto statistics = transportUnderTest.get_send_statistics();
+    EXPECT_EQ(1u, statistics.fan_out_calls);
+    EXPECT_EQ(3u, statistics.fan_out_datagrams);
+    EXPECT_EQ(3u, statistics.fan_out_max_batch);
+}
+
+TEST_F(UDPv4Tests, send_that_would_block_waits_until_the_caller_deadline_and_drops_the_datagram)
+{
+    // Given
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    SendResourceList send_resource_list;
+    Locator_t genericOutputChannelLocator;
+    genericOutputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    genericOutputChannelLocator.port = g_default_port;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, genericOutputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locator_t destinationLocator;
+    destinationLocator.kind = LOCATOR_KIND_UDPv4;
+    destinationLocator.port = g_default_port + 1;
+    IPLocator::setIPv4(destinationLocator, 127, 0, 0, 1);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(destinationLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    // When
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    fail_next_sends(-1);
+    bool sent = send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end, deadline);
+    auto end = std::chrono::steady_clock::now();
+    g_failing_sends = 0;
+
+    // Then
+    EXPECT_TRUE(sent);
+    EXPECT_GE(end, deadline);
+    EXPECT_LE(g_failed_sends, MaxRetriesIn100ms);
+    auto statistics = transportUnderTest.get_send_statistics();
+    EXPECT_EQ(1u, statistics.blocked_sends);
+    EXPECT_EQ(1u, statistics.dropped_would_block);
+}
+
+TEST_F(UDPv4Tests, send_that_would_block_is_retried_until_the_socket_accepts_it)
+{
+    // Given
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    SendResourceList send_resource_list;
+    Locator_t genericOutputChannelLocator;
+    genericOutputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    genericOutputChannelLocator.port = g_default_port;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, genericOutputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locator_t destinationLocator;
+    destinationLocator.kind = LOCATOR_KIND_UDPv4;
+    destinationLocator.port = g_default_port + 1;
+    IPLocator::setIPv4(destinationLocator, 127, 0, 0, 1);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(destinationLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    // When
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    fail_next_sends(3);
+    bool sent = send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+                    std::chrono::steady_clock::now() + std::chrono::seconds(10));
+    g_failing_sends = 0;
+
+    // Then
+    EXPECT_TRUE(sent);
+    EXPECT_EQ(3u, g_failed_sends);
+    auto statistics = transportUnderTest.get_send_statistics();
+    EXPECT_EQ(1u, statistics.blocked_sends);
+    EXPECT_EQ(0u, statistics.dropped_would_block);
+}
+
+TEST_F(UDPv4Tests, fan_out_that_would_block_waits_once_for_the_caller_deadline)
+{
+    // Given
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    SendResourceList send_resource_list;
+    Locator_t genericOutputChannelLocator;
+    genericOutputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    genericOutputChannelLocator.port = g_default_port;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, genericOutputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    LocatorList_t locator_list;
+    for (uint16_t i = 1; i <= 3; ++i)
+    {
+        Locator_t destinationLocator;
+        destinationLocator.kind = LOCATOR_KIND_UDPv4;
+        destinationLocator.port = g_default_port + i;
+        IPLocator::setIPv4(destinationLocator, 127, 0, 0, 1);
+        locator_list.push_back(destinationLocator);
+    }
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    // When
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    fail_next_sends(-1);
+    send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end, deadline);
+    auto end = std::chrono::steady_clock::now();
+    g_failing_sends = 0;
+
+    // Then the three datagrams share the deadline, instead of waiting for it once each
+    EXPECT_GE(end, deadline);
+    EXPECT_LE(g_failed_sends, MaxRetriesIn100ms);
+    auto statistics = transportUnderTest.get_send_statistics();
+    EXPECT_EQ(1u, statistics.blocked_sends);
+    EXPECT_EQ(3u, statistics.dropped_would_block);
+    EXPECT_EQ(0u, statistics.fan_out_datagrams);
+}
+
+TEST_F(UDPv4Tests, send_that_would_block_with_expired_deadline_is_dropped_without_waiting)
+{
+    // Given
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    SendResourceList send_resource_list;
+    Locator_t genericOutputChannelLocator;
+    genericOutputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    genericOutputChannelLocator.port = g_default_port;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, genericOutputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+
+    Locator_t destinationLocator;
+    destinationLocator.kind = LOCATOR_KIND_UDPv4;
+    destinationLocator.port = g_default_port + 1;
+    IPLocator::setIPv4(destinationLocator, 127, 0, 0, 1);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(destinationLocator);
+    Locators locators_begin(locator_list.begin());
+    Locators locators_end(locator_list.end());
+
+    // When
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    fail_next_sends(-1);
+    send_resource_list.at(0)->send(message, 5, &locators_begin, &locators_end,
+            std::chrono::steady_clock::now() - std::chrono::microseconds(100));
+    g_failing_sends = 0;
+
+    // Then the datagram is attempted once and dropped
+    EXPECT_EQ(1u, g_failed_sends);
+    auto statistics = transportUnderTest.get_send_statistics();
+    EXPECT_EQ(1u, statistics.dropped_would_block);
+}
+
+TEST_F(UDPv4Tests, batched_receive_delivers_every_datagram_in_order_with_its_source)
+{
+    // Given
+    descriptor.receive_batch_size = 4;
+    descriptor.receiveBufferSize = 1024 * 1024;
+    descriptor.interfaceWhiteList.emplace_back("127.0.0.1");
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t unicastLocator;
+    unicastLocator.port = g_default_port;
+    unicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(unicastLocator, "127.0.0.1");
+
+    MockReceiverResource receiver(transportUnderTest, unicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(unicastLocator));
+
+    const uint32_t num_datagrams = 10;
+    std::vector<std::vector<octet>> received;
+    std::vector<Locator_t> sources;
+    Semaphore sem;
+    msg_recv->setCallback([&]()
+            {
+                received.emplace_back(msg_recv->data, msg_recv->data + msg_recv->length);
+                sources.push_back(msg_recv->remote_locator);
+                sem.post();
+            });
+
+    // Datagrams are sent from a known port, so their source can be checked
+    asio::io_service io_service;
+    asio::ip::udp::socket sender(io_service);
+    sender.open(asio::ip::udp::v4());
+    sender.bind(asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), g_default_port + 1));
+    asio::ip::udp::endpoint destination(asio::ip::address_v4::loopback(), g_default_port);
+
+    // When more datagrams than the batch size are queued, with one larger than a reception slot among them
+    std::vector<std::vector<octet>> sent;
+    for (uint32_t i = 0; i < num_datagrams; ++i)
+    {
+        if (i == 5)
+        {
+            // MockReceiverResource opens its channel with 0x8FFF bytes buffers
+            std::vector<octet> oversized(0x8FFF + 100, 0xFF);
+            ASSERT_EQ(oversized.size(), sender.send_to(asio::buffer(oversized), destination));
+        }
+
+        std::vector<octet> datagram(5 + i * 100, static_cast<octet>(i));
+        ASSERT_EQ(datagram.size(), sender.send_to(asio::buffer(datagram), destination));
+        sent.push_back(datagram);
+    }
+
+    for (uint32_t i = 0; i < num_datagrams; ++i)
+    {
+        sem.wait();
+    }
+
+    // Then every datagram fitting on a slot is delivered, in order, and the oversized one is discarded
+    ASSERT_EQ(num_datagrams, received.size());
+    Locator_t expected_source;
+    expected_source.kind = LOCATOR_KIND_UDPv4;
+    expected_source.port = g_default_port + 1;
+    IPLocator::setIPv4(expected_source, 127, 0, 0, 1);
+    for (uint32_t i = 0; i < num_datagrams; ++i)
+    {
+        EXPECT_EQ(sent[i], received[i]);
+        EXPECT_EQ(expected_source, sources[i]);
+    }
+}
+#endif // if defined(__linux__)
+
 TEST_F(UDPv4Tests, RemoteToMainLocal_simply_strips_out_address_leaving_IP_ANY)
 {
     // Given
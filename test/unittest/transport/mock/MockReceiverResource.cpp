@@ -73,9 +73,11 @@ void MockMessageReceiver::setCallback(std::function<void()> cb)
     this->callback = cb;
 }
 
-void MockMessageReceiver::processCDRMsg(const Locator_t&, CDRMessage_t*msg)
+void MockMessageReceiver::processCDRMsg(const Locator_t& loc, CDRMessage_t*msg)
 {
     data = msg->buffer;
+    length = msg->length;
+    remote_locator = loc;
     if (callback != nullptr)
     {
         callback();
@@ -44,6 +44,8 @@ public:
     void processCDRMsg(const Locator_t& loc, CDRMessage_t*msg) override;
     void setCallback(std::function<void()> cb);
     octet* data;
+    uint32_t length = 0;
+    Locator_t remote_locator;
     std::function<void()> callback;
 };
 
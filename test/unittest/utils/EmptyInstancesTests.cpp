@@ -0,0 +1,124 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/common/EmptyInstances.h>
+#include <gtest/gtest.h>
+
+#include <map>
+
+using namespace eprosima::fastrtps;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+
+class EmptyInstancesTests : public ::testing::Test
+{
+protected:
+
+    static InstanceHandle_t make_handle(
+            uint8_t id)
+    {
+        InstanceHandle_t handle;
+        handle.value[0] = id;
+        return handle;
+    }
+
+    void push(
+            uint8_t id)
+    {
+        uut.push(make_handle(id), instances[make_handle(id)]);
+    }
+
+    void erase(
+            uint8_t id)
+    {
+        uut.erase(instances[make_handle(id)]);
+    }
+
+    void expect_front(
+            uint8_t id)
+    {
+        InstanceHandle_t handle;
+        ASSERT_TRUE(uut.front(handle));
+        EXPECT_EQ(make_handle(id), handle);
+    }
+
+    EmptyInstances uut;
+    std::map<InstanceHandle_t, KeyedChanges> instances;
+};
+
+TEST_F(EmptyInstancesTests, empty)
+{
+    InstanceHandle_t handle;
+    EXPECT_FALSE(uut.front(handle));
+    EXPECT_EQ(0u, uut.size());
+
+    // Erasing an instance which is not on the list has no effect
+    erase(1);
+    EXPECT_EQ(0u, uut.size());
+}
+
+TEST_F(EmptyInstancesTests, order)
+{
+    push(3);
+    push(1);
+    push(2);
+    EXPECT_EQ(3u, uut.size());
+    expect_front(3);
+
+    // Pushing an instance already on the list keeps its position
+    push(3);
+    EXPECT_EQ(3u, uut.size());
+    expect_front(3);
+
+    erase(3);
+    EXPECT_FALSE(instances[make_handle(3)].is_empty_listed);
+    expect_front(1);
+
+    // An instance that becomes empty again goes to the end
+    erase(1);
+    push(1);
+    expect_front(2);
+    erase(2);
+    expect_front(1);
+    erase(1);
+
+    InstanceHandle_t handle;
+    EXPECT_FALSE(uut.front(handle));
+}
+
+TEST_F(EmptyInstancesTests, reserve)
+{
+    uut.reserve(2);
+    EXPECT_EQ(0u, uut.size());
+
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        push(i);
+    }
+    EXPECT_EQ(10u, uut.size());
+
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        expect_front(i);
+        erase(i);
+    }
+    EXPECT_EQ(0u, uut.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/collections/InstanceDeadlines.hpp>
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+
+static InstanceHandle_t make_handle(
+        uint8_t id)
+{
+    InstanceHandle_t handle;
+    handle.value[0] = id;
+    return handle;
+}
+
+TEST(InstanceDeadlinesTests, empty)
+{
+    InstanceDeadlines uut;
+    InstanceHandle_t handle;
+    InstanceDeadlines::time_point deadline;
+
+    EXPECT_EQ(0u, uut.size());
+    EXPECT_FALSE(uut.next(handle, deadline));
+}
+
+TEST(InstanceDeadlinesTests, next_is_earliest)
+{
+    InstanceDeadlines uut;
+    InstanceDeadlines::time_point now = std::chrono::steady_clock::now();
+    InstanceHandle_t handle;
+    InstanceDeadlines::time_point deadline;
+
+    uut.add(make_handle(1), now + std::chrono::milliseconds(30));
+    uut.add(make_handle(2), now + std::chrono::milliseconds(10));
+    uut.add(make_handle(3), now + std::chrono::milliseconds(20));
+    EXPECT_EQ(3u, uut.size());
+
+    ASSERT_TRUE(uut.next(handle, deadline));
+    EXPECT_EQ(make_handle(2), handle);
+    EXPECT_EQ(now + std::chrono::milliseconds(10), deadline);
+
+    // Moving the earliest instance forward makes the next one the earliest
+    uut.update(make_handle(2), now + std::chrono::milliseconds(10), now + std::chrono::milliseconds(40));
+    EXPECT_EQ(3u, uut.size());
+    ASSERT_TRUE(uut.next(handle, deadline));
+    EXPECT_EQ(make_handle(3), handle);
+    EXPECT_EQ(now + std::chrono::milliseconds(20), deadline);
+
+    uut.remove(make_handle(3), now + std::chrono::milliseconds(20));
+    ASSERT_TRUE(uut.next(handle, deadline));
+    EXPECT_EQ(make_handle(1), handle);
+
+    uut.clear();
+    EXPECT_FALSE(uut.next(handle, deadline));
+}
+
+TEST(InstanceDeadlinesTests, same_deadline)
+{
+    InstanceDeadlines uut;
+    InstanceDeadlines::time_point now = std::chrono::steady_clock::now();
+    InstanceHandle_t handle;
+    InstanceDeadlines::time_point deadline;
+
+    uut.add(make_handle(2), now);
+    uut.add(make_handle(1), now);
+    EXPECT_EQ(2u, uut.size());
+
+    uut.remove(make_handle(1), now);
+    ASSERT_TRUE(uut.next(handle, deadline));
+    EXPECT_EQ(make_handle(2), handle);
+    EXPECT_EQ(1u, uut.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
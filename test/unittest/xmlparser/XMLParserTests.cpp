@@ -559,6 +559,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <receiveBufferSize>8192</receiveBufferSize>\
                     <TTL>250</TTL>\
                     <non_blocking_send>false</non_blocking_send>\
+                    <receive_batch_size>16</receive_batch_size>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <interfaceWhiteList>\
@@ -600,6 +601,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->TTL, 250u);
         EXPECT_EQ(pUDPv4Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv4Desc->receive_batch_size, 16u);
         EXPECT_EQ(pUDPv4Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv4Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -620,6 +622,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv6Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->TTL, 250u);
         EXPECT_EQ(pUDPv6Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv6Desc->receive_batch_size, 16u);
         EXPECT_EQ(pUDPv6Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv6Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv6Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -734,6 +737,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
+                    <listener_spin_time_us>20</listener_spin_time_us>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                 </transport_descriptor>\
@@ -749,6 +753,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
+        EXPECT_EQ(pSHMDesc->listener_spin_time_us(), 20u);
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
 
@@ -779,6 +784,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "receiveBufferSize",
         "TTL",
         "non_blocking_send",
+        "receive_batch_size",
         "interfaceWhiteList",
         "output_port",
         "bad_element"
@@ -814,6 +820,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "port_queue_capacity",
         "healthy_check_timeout_ms",
         "rtps_dump_file",
+        "listener_spin_time_us",
         "bad_element"
     };
 
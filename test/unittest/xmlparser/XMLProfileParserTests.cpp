@@ -991,6 +991,7 @@ TEST_F(XMLProfileParserTests, SHM_transport_descriptors_config)
     ASSERT_EQ(descriptor->port_queue_capacity(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->healthy_check_timeout_ms(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->rtps_dump_file(), "test_file.dump");
+    ASSERT_EQ(descriptor->listener_spin_time_us(), std::numeric_limits<uint32_t>::max());
     ASSERT_EQ(descriptor->maxMessageSize, 128000u);
     ASSERT_EQ(descriptor->max_message_size(), 128000u);
 }